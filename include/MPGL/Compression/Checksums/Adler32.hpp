@@ -30,10 +30,15 @@
 namespace mpgl {
 
     /**
-     * Calculates the adler32 checksum of the given range
+     * Calculates the adler32 checksum of the given range. The
+     * sums are reduced once per NMAX bytes and the contiguous
+     * ranges are processed with the vector instructions when
+     * the processor supports them
      */
     class Adler32 {
     public:
+        typedef std::size_t                         size_type;
+
         /**
          * Constructs a new Adler32 object
          */
@@ -49,9 +54,58 @@ namespace mpgl {
         template <std::ranges::input_range Range>
             requires ByteInputIterator<std::ranges::iterator_t<Range>>
         [[nodiscard]] constexpr uint32 operator() (
-            Range const& range) const noexcept;
-    private:
+            Range const& range) const noexcept
+                { return (*this)(range, 1); }
+
+        /**
+         * Continues the calculation of the checksum with the
+         * given range. Allows to compute the checksum of the
+         * data that is received in chunks
+         *
+         * @tparam Range the range type
+         * @param range the constant reference to the checked range
+         * @param checksum the adler32 checksum of the preceding data
+         * @return the adler32 checksum
+         */
+        template <std::ranges::input_range Range>
+            requires ByteInputIterator<std::ranges::iterator_t<Range>>
+        [[nodiscard]] constexpr uint32 operator() (
+            Range const& range,
+            uint32 checksum) const noexcept;
+
+        /**
+         * Combines the checksums of two consecutive chunks
+         * of data into the checksum of the whole data. Allows to
+         * compute the checksums of the chunks independently
+         *
+         * @param first the checksum of the first chunk
+         * @param second the checksum of the second chunk
+         * @param secondLength the length of the second chunk
+         * @return the checksum of the concatenated chunks
+         */
+        [[nodiscard]] static uint32 combine(
+            uint32 first,
+            uint32 second,
+            size_type secondLength) noexcept;
+
+        /// The modulus of the sums
         static constexpr const uint32 AdlerBase   = 65521;
+        /// The maximum number of bytes summed without the modulo
+        static constexpr const size_type MaxDeferred = 5552;
+    private:
+        /**
+         * Updates the checksum with the contiguous bytes. Uses
+         * the fastest kernel supported by the processor
+         *
+         * @param checksum the adler32 checksum
+         * @param data the pointer to the bytes
+         * @param length the number of the bytes
+         * @return the updated checksum
+         */
+        [[nodiscard]] static uint32 update(
+            uint32 checksum,
+            uint8 const* data,
+            size_type length) noexcept;
     };
 
     inline constexpr Adler32                        adler32{};
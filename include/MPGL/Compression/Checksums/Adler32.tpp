@@ -30,14 +30,27 @@ namespace mpgl {
     template <std::ranges::input_range Range>
         requires ByteInputIterator<std::ranges::iterator_t<Range>>
     [[nodiscard]] constexpr uint32 Adler32::operator() (
-       Range const& range) const noexcept
+        Range const& range,
+        uint32 checksum) const noexcept
     {
-        uint32 low = 1, high = 0;
-        for (uint8 value : range) {
-            low = (low + value) % AdlerBase;
-            high = (high + low) % AdlerBase;
+        if constexpr (std::ranges::contiguous_range<Range>
+            && std::ranges::sized_range<Range>)
+        {
+            return update(checksum, reinterpret_cast<uint8 const*>(
+                std::ranges::data(range)), std::ranges::size(range));
+        } else {
+            uint32 low = checksum & 0xFFFF, high = checksum >> 16;
+            size_type deferred = 0;
+            for (uint8 value : range) {
+                high += low += value;
+                if (++deferred == MaxDeferred) {
+                    low %= AdlerBase;
+                    high %= AdlerBase;
+                    deferred = 0;
+                }
+            }
+            return ((high % AdlerBase) << 16) | (low % AdlerBase);
         }
-        return (high << 16) | low;
     }
 
 }
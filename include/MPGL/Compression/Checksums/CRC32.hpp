@@ -32,10 +32,15 @@
 namespace mpgl {
 
     /**
-     * Calculates the CRC32 checksum of the given range
+     * Calculates the CRC32 checksum of the given range. The
+     * contiguous ranges are processed sixteen bytes at once
+     * or with the carry-less multiplication and CRC instructions
+     * when the processor supports them
      */
     class CRC32 {
     public:
+        typedef std::size_t                         size_type;
+
         /**
          * Constructs a new CRC32 object
          */
@@ -51,19 +56,95 @@ namespace mpgl {
         template <std::ranges::input_range Range>
             requires ByteInputIterator<std::ranges::iterator_t<Range>>
         [[nodiscard]] constexpr uint32 operator() (
-            Range const& range) const noexcept;
+            Range const& range) const noexcept
+                { return (*this)(range, 0); }
+
+        /**
+         * Continues the calculation of the checksum with the
+         * given range. Allows to compute the checksum of the
+         * data that is received in chunks
+         *
+         * @tparam Range the range type
+         * @param range the constant reference to the checked range
+         * @param checksum the crc32 checksum of the preceding data
+         * @return the crc32 checksum
+         */
+        template <std::ranges::input_range Range>
+            requires ByteInputIterator<std::ranges::iterator_t<Range>>
+        [[nodiscard]] constexpr uint32 operator() (
+            Range const& range,
+            uint32 checksum) const noexcept;
+
+        /**
+         * Combines the checksums of two consecutive chunks
+         * of data into the checksum of the whole data. Allows to
+         * compute the checksums of the chunks independently
+         *
+         * @param first the checksum of the first chunk
+         * @param second the checksum of the second chunk
+         * @param secondLength the length of the second chunk
+         * @return the checksum of the concatenated chunks
+         */
+        [[nodiscard]] static uint32 combine(
+            uint32 first,
+            uint32 second,
+            size_type secondLength) noexcept;
     private:
         typedef std::array<uint32, 256>             LookupTable;
+        typedef std::array<LookupTable, 16>         LookupTables;
 
         /**
-         * Generates a lookup table for crc 32
+         * Generates the lookup tables for crc 32. The n-th table
+         * advances the crc by the byte followed by n zero bytes
          *
-         * @return the lookup table for crc 32
+         * @return the lookup tables for crc 32
          */
-        static constexpr LookupTable generateLookupTable(
+        static constexpr LookupTables generateLookupTables(
             void) noexcept;
 
-        static LookupTable const                    lookup;
+        /**
+         * Updates the crc register with the contiguous bytes.
+         * Uses the fastest kernel supported by the processor
+         *
+         * @param crc the crc register
+         * @param data the pointer to the bytes
+         * @param length the number of the bytes
+         * @return the updated crc register
+         */
+        [[nodiscard]] static uint32 update(
+            uint32 crc,
+            uint8 const* data,
+            size_type length) noexcept;
+
+        /**
+         * Updates the crc register with the contiguous bytes
+         * using the lookup tables
+         *
+         * @param crc the crc register
+         * @param data the pointer to the bytes
+         * @param length the number of the bytes
+         * @return the updated crc register
+         */
+        [[nodiscard]] static uint32 updateSliced(
+            uint32 crc,
+            uint8 const* data,
+            size_type length) noexcept;
+
+        /**
+         * Multiplies two polynomials modulo the crc polynomial
+         *
+         * @param left the first polynomial
+         * @param right the second polynomial
+         * @return the product of the polynomials
+         */
+        [[nodiscard]] static uint32 multiply(
+            uint32 left,
+            uint32 right) noexcept;
+
+        static constexpr const uint32               Polynomial
+            = 0xEDB88320;
+
+        static LookupTables const                   lookup;
     };
 
     inline constexpr CRC32                          crc32{};
@@ -27,20 +27,24 @@
 
 namespace mpgl {
 
-    constexpr CRC32::LookupTable
-        CRC32::generateLookupTable(void) noexcept
+    constexpr CRC32::LookupTables
+        CRC32::generateLookupTables(void) noexcept
     {
-        LookupTable table{};
+        LookupTables tables{};
         for (uint32 i = 0, crc = 0; i < 256; crc = ++i) {
             for (uint8 j = 0; j < 8; ++j) {
                 if (crc & 1)
-                    crc = 0xEDB88320 ^ (crc >> 1);
+                    crc = Polynomial ^ (crc >> 1);
                 else
                     crc >>= 1;
             }
-            table[i] = crc;
+            tables[0][i] = crc;
         }
-        return table;
+        for (std::size_t j = 1; j < tables.size(); ++j)
+            for (uint32 i = 0; i < 256; ++i)
+                tables[j][i] = (tables[j - 1][i] >> 8)
+                    ^ tables[0][tables[j - 1][i] & 0xFF];
+        return tables;
     }
 
 }
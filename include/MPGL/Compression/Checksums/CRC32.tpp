@@ -30,12 +30,21 @@ namespace mpgl {
     template <std::ranges::input_range Range>
         requires ByteInputIterator<std::ranges::iterator_t<Range>>
     [[nodiscard]] constexpr uint32 CRC32::operator() (
-        Range const& range) const noexcept
+        Range const& range,
+        uint32 checksum) const noexcept
     {
-        uint32 crc = 0xFFFFFFFF;
-        for (uint8 value : range)
-            crc = (crc >> 8) ^ lookup[(value ^ crc) & 0xFF];
-        return crc ^ 0xFFFFFFFF;
+        uint32 crc = checksum ^ 0xFFFFFFFF;
+        if constexpr (std::ranges::contiguous_range<Range>
+            && std::ranges::sized_range<Range>)
+        {
+            return update(crc, reinterpret_cast<uint8 const*>(
+                std::ranges::data(range)), std::ranges::size(range))
+                    ^ 0xFFFFFFFF;
+        } else {
+            for (uint8 value : range)
+                crc = (crc >> 8) ^ lookup[0][(value ^ crc) & 0xFF];
+            return crc ^ 0xFFFFFFFF;
+        }
     }
 
 }
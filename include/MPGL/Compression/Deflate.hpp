@@ -0,0 +1,430 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#pragma once
+
+#include <MPGL/Compression/DeflateTables.hpp>
+#include <MPGL/IO/BitWriter.hpp>
+
+#include <vector>
+#include <span>
+
+namespace mpgl {
+
+    /**
+     * Compressor of the DEFLATE compression standard. Finds
+     * the matches using the hash chains and encodes them with
+     * the dynamic Huffman codes. Each block is written in
+     * the cheapest of the dynamic, fixed and stored forms
+     */
+    class Deflate : private DeflateTables {
+    public:
+        typedef std::span<char const>                   InputSpan;
+        typedef std::vector<char>                       Buffer;
+        typedef std::size_t                             size_type;
+
+        /**
+         * The trade-off between the compression ratio
+         * and the compression speed
+         */
+        enum class CompressionLevel : uint8 {
+            /// The data is stored without any compression
+            Store,
+            /// Short hash chains and the greedy matching
+            Fastest,
+            /// Medium hash chains and the greedy matching
+            Fast,
+            /// Medium hash chains and the lazy matching
+            Default,
+            /// Long hash chains and the lazy matching
+            Maximum
+        };
+
+        /**
+         * Constructs a new Deflate object
+         *
+         * @param level the compression level
+         */
+        explicit Deflate(
+            CompressionLevel level = CompressionLevel::Default) noexcept
+                : level{level} {}
+
+        Deflate(Deflate const&) noexcept = default;
+        Deflate(Deflate&&) noexcept = default;
+
+        Deflate& operator=(Deflate const&) noexcept = default;
+        Deflate& operator=(Deflate&&) noexcept = default;
+
+        /**
+         * Compresses the given data
+         *
+         * @param input the compressed data
+         * @return the DEFLATE stream
+         */
+        [[nodiscard]] Buffer operator()(InputSpan input) const;
+
+        /**
+         * Compresses the given data and appends the DEFLATE
+         * stream to the given buffer
+         *
+         * @param input the compressed data
+         * @param output the reference to the output buffer
+         */
+        void operator()(InputSpan input, Buffer& output) const;
+
+        /**
+         * Returns the compression level
+         *
+         * @return the compression level
+         */
+        [[nodiscard]] CompressionLevel getCompressionLevel(
+            void) const noexcept
+                { return level; }
+
+        /**
+         * Destroys the Deflate object
+         */
+        ~Deflate(void) noexcept = default;
+    private:
+        typedef std::back_insert_iterator<Buffer>       OutputIter;
+        typedef BitWriter<OutputIter>                   Writer;
+        typedef std::vector<uint32>                     Frequencies;
+        typedef std::vector<uint8>                      Lengths;
+        typedef std::vector<uint16>                     Codes;
+
+        /**
+         * The literal [when the distance is equal to zero]
+         * or the match
+         */
+        struct Token {
+            /// The literal or the length of the match
+            uint16                                      length;
+            /// The distance of the match
+            uint16                                      distance;
+        };
+
+        typedef std::vector<Token>                      Tokens;
+
+        /**
+         * The symbol of the code lengths alphabet with its
+         * extra bits
+         */
+        struct LengthToken {
+            /// The symbol
+            uint8                                       symbol;
+            /// The extra bits
+            uint8                                       extra;
+        };
+
+        typedef std::vector<LengthToken>                LengthTokens;
+
+        /**
+         * The canonical Huffman code. The codes are stored
+         * with the reversed bit order so they can be written
+         * directly into the bit writer
+         */
+        struct HuffmanCode {
+            Lengths                                     lengths;
+            Codes                                       codes;
+
+            /**
+             * Constructs a new Huffman Code object from
+             * the given code lengths
+             *
+             * @param lengths the code lengths
+             */
+            explicit HuffmanCode(Lengths lengths);
+
+            /**
+             * Constructs the length limited Huffman code for
+             * the given symbols' frequencies
+             *
+             * @param frequencies the constant reference to
+             * the symbols' frequencies
+             * @param maxLength the maximum code length
+             * @return the Huffman code
+             */
+            [[nodiscard]] static HuffmanCode fromFrequencies(
+                Frequencies const& frequencies,
+                uint8 maxLength);
+        };
+
+        /**
+         * The parameters of the match finder
+         */
+        struct Parameters {
+            /// Shortens the search above this match length
+            uint16                                      goodLength;
+            /// Skips the lazy search above this match length
+            uint16                                      maxLazy;
+            /// Stops the search above this match length
+            uint16                                      niceLength;
+            /// The maximum length of the searched hash chain
+            uint16                                      maxChain;
+            /// Whether the lazy matching is used
+            bool                                        lazy;
+        };
+
+        /**
+         * Finds the matches in the previous 32 KiB of the data
+         * using the hash chains of the three-byte sequences
+         */
+        class MatchFinder {
+        public:
+            typedef int64                               Position;
+
+            /// The position that does not exist
+            static constexpr const Position             NoPosition
+                = -1;
+
+            /**
+             * Constructs a new Match Finder object
+             *
+             * @param input the searched data
+             * @param parameters the constant reference to
+             * the match finder parameters
+             */
+            explicit MatchFinder(
+                InputSpan input,
+                Parameters const& parameters);
+
+            /**
+             * Inserts the given position into its hash chain
+             *
+             * @param position the inserted position
+             * @return the previous head of the hash chain
+             */
+            Position insert(size_type position) noexcept;
+
+            /**
+             * Returns the longest match beginning at the given
+             * position that is longer than the given length
+             *
+             * @param position the position of the match
+             * @param candidate the first position in the chain
+             * @param length the minimal length minus one
+             * @return the length and the distance of the match.
+             * The distance is zero if the match was not found
+             */
+            [[nodiscard]] Token findMatch(
+                size_type position,
+                Position candidate,
+                uint16 length) const noexcept;
+        private:
+            typedef std::vector<Position>               Positions;
+
+            /**
+             * Returns the hash of the three bytes at the given
+             * position
+             *
+             * @param position the position
+             * @return the hash
+             */
+            [[nodiscard]] uint32 hash(
+                size_type position) const noexcept;
+
+            /**
+             * Returns the length of the common prefix of
+             * the given positions
+             *
+             * @param first the first position
+             * @param second the second position
+             * @param maxLength the maximum length
+             * @return the length of the common prefix
+             */
+            [[nodiscard]] uint16 matchLength(
+                size_type first,
+                size_type second,
+                uint16 maxLength) const noexcept;
+
+            Positions                                   head;
+            Positions                                   previous;
+            InputSpan                                   input;
+            Parameters const&                           parameters;
+        };
+
+        /**
+         * Writes the data as the stored blocks
+         *
+         * @param input the written data
+         * @param final whether the last block is the final one
+         * @param writer the reference to the bit writer
+         */
+        static void writeStored(
+            InputSpan input,
+            bool final,
+            Writer& writer);
+
+        /**
+         * Compresses the data using the given parameters
+         *
+         * @param input the compressed data
+         * @param parameters the constant reference to
+         * the match finder parameters
+         * @param writer the reference to the bit writer
+         */
+        static void compress(
+            InputSpan input,
+            Parameters const& parameters,
+            Writer& writer);
+
+        /**
+         * Writes the block in the cheapest of the available forms
+         *
+         * @param tokens the constant reference to the tokens
+         * @param input the data encoded by the tokens
+         * @param final whether the block is the final one
+         * @param writer the reference to the bit writer
+         */
+        static void writeBlock(
+            Tokens const& tokens,
+            InputSpan input,
+            bool final,
+            Writer& writer);
+
+        /**
+         * Encodes the code lengths of the dynamic block using
+         * the run-length symbols
+         *
+         * @param lengths the constant reference to the code
+         * lengths
+         * @return the code length tokens
+         */
+        [[nodiscard]] static LengthTokens encodeLengths(
+            Lengths const& lengths);
+
+        /**
+         * Returns the number of bits used by the tokens when
+         * encoded with the given codes
+         *
+         * @param tokens the constant reference to the tokens
+         * @param literals the constant reference to the literal
+         * and length code
+         * @param distances the constant reference to
+         * the distance code
+         * @return the number of bits
+         */
+        [[nodiscard]] static size_type tokensCost(
+            Tokens const& tokens,
+            HuffmanCode const& literals,
+            HuffmanCode const& distances) noexcept;
+
+        /**
+         * Writes the tokens and the end of the block using
+         * the given codes
+         *
+         * @param tokens the constant reference to the tokens
+         * @param literals the constant reference to the literal
+         * and length code
+         * @param distances the constant reference to
+         * the distance code
+         * @param writer the reference to the bit writer
+         */
+        static void writeTokens(
+            Tokens const& tokens,
+            HuffmanCode const& literals,
+            HuffmanCode const& distances,
+            Writer& writer);
+
+        /**
+         * Returns the index of the length code of the given
+         * match length
+         *
+         * @param length the match length
+         * @return the index of the length code
+         */
+        [[nodiscard]] static uint8 lengthCode(
+            uint16 length) noexcept
+                { return lengthCodes[length - MinMatchLength]; }
+
+        /**
+         * Returns the index of the distance code of the given
+         * match distance
+         *
+         * @param distance the match distance
+         * @return the index of the distance code
+         */
+        [[nodiscard]] static uint8 distanceCode(
+            uint16 distance) noexcept;
+
+        /**
+         * Returns the match finder parameters of the given
+         * compression level
+         *
+         * @param level the compression level
+         * @return the match finder parameters
+         */
+        [[nodiscard]] static Parameters const& getParameters(
+            CompressionLevel level) noexcept;
+
+        typedef std::array<uint8, MaxMatchLength - 2>   LengthCodes;
+        typedef std::array<uint8, 512>                  DistanceCodes;
+
+        /**
+         * Builds the table mapping the match lengths onto
+         * the length codes
+         *
+         * @return the length codes table
+         */
+        [[nodiscard]] static LengthCodes createLengthCodes(
+            void) noexcept;
+
+        /**
+         * Builds the table mapping the match distances onto
+         * the distance codes
+         *
+         * @return the distance codes table
+         */
+        [[nodiscard]] static DistanceCodes createDistanceCodes(
+            void) noexcept;
+
+        /// The minimal length of the match
+        static constexpr const uint16                   MinMatchLength
+            = 3;
+        /// The maximum distance of the match
+        static constexpr const size_type                MaxDistance
+            = 32768;
+        /// The maximum number of the tokens in the block
+        static constexpr const size_type                MaxBlockTokens
+            = 16383;
+        /// The maximum length of the stored block
+        static constexpr const size_type                MaxStoredLength
+            = 65535;
+        /// The maximum length of the literal and distance codes
+        static constexpr const uint8                    MaxCodeLength
+            = 15;
+        /// The maximum length of the code lengths codes
+        static constexpr const uint8                    MaxLengthCodeLength
+            = 7;
+
+        static LengthCodes const                        lengthCodes;
+        static DistanceCodes const                      distanceCodes;
+        static HuffmanCode const                        fixedLiteralCode;
+        static HuffmanCode const                        fixedDistanceCode;
+
+        CompressionLevel                                level;
+    };
+
+}
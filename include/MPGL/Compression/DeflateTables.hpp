@@ -0,0 +1,78 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#pragma once
+
+#include <MPGL/Traits/Types.hpp>
+
+#include <utility>
+#include <array>
+
+namespace mpgl {
+
+    /**
+     * Contains the constant tables defined by the DEFLATE
+     * compression standard
+     */
+    struct DeflateTables {
+        /// The token which ends the block
+        static constexpr const uint16                   BlockEnd
+            = 256;
+        /// The maximum length of the literal and length alphabet
+        static constexpr const uint16                   MaxAlphabetLength
+            = 288;
+        /// The maximum length of the match
+        static constexpr const uint16                   MaxMatchLength
+            = 258;
+        /// Extra length bits and the base lengths
+        static constexpr const std::array<
+            std::pair<uint8, uint16>, 29>               extraLength =
+        {
+            std::pair<uint8, uint16>{0, 3}, {0, 4}, {0, 5}, {0, 6},
+            {0, 7}, {0, 8}, {0, 9}, {0, 10}, {1, 11}, {1, 13}, {1, 15},
+            {1, 17}, {2, 19}, {2, 23}, {2, 27}, {2, 31}, {3, 35},
+            {3, 43}, {3, 51}, {3, 59}, {4, 67}, {4, 83}, {4, 99},
+            {4, 115}, {5, 131}, {5, 163}, {5, 195}, {5, 227}, {0, 258}
+        };
+        /// Extra distance bits and the base distances
+        static constexpr const std::array<
+            std::pair<uint8, uint32>, 30>               distances =
+        {
+            std::pair<uint8, uint32>{0, 1}, {0, 2}, {0, 3}, {0, 4},
+            {1, 5}, {1, 7}, {2, 9}, {2, 13}, {3, 17}, {3, 25}, {4, 33},
+            {4, 49}, {5, 65}, {5, 97}, {6, 129}, {6, 193}, {7, 257},
+            {7, 385}, {8, 513}, {8, 769}, {9, 1025}, {9, 1537},
+            {10, 2049}, {10, 3073}, {11, 4097}, {11, 6145}, {12, 8193},
+            {12, 12289}, {13, 16385}, {13, 24577}
+        };
+        /// The order of the dynamic codes
+        static constexpr const std::array<uint8, 19>    dynamicCodesOrder =
+        {
+            16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2,
+            14, 1, 15
+        };
+    };
+
+}
@@ -28,6 +28,8 @@
 #include <MPGL/Exceptions/Inflate/InflateInvalidHeaderException.hpp>
 #include <MPGL/Exceptions/NotSupportedException.hpp>
 #include <MPGL/Compression/Checksums/CRC32.hpp>
+#include <MPGL/Compression/GZIPStreamDecoder.hpp>
+#include <MPGL/Concurrency/Threadpool.hpp>
 #include <MPGL/Compression/Inflate.hpp>
 #include <MPGL/IO/Readers.hpp>
 
@@ -46,6 +48,7 @@ namespace mpgl {
     class GZIPDecoder {
     public:
         typedef std::optional<std::string>              OptString;
+        typedef std::size_t                             size_type;
 
         /**
          * Compression level of the given compressed file
@@ -143,15 +146,35 @@ namespace mpgl {
 
         /**
          * Decompresses the given range and returns the range
-         * containing decompressed data
+         * containing decompressed data. The output is preallocated
+         * with the size saved in the trailer. When the range
+         * contains more than one member the following members are
+         * decompressed as well
          *
          * @throw InflateDataCorruptionException when data is
          * corrupted
          * @return the decompressed data
          */
         [[nodiscard]] Range operator()(void);
+
+        /**
+         * Decompresses all members of the gzip file and returns
+         * the range containing their concatenated data. The
+         * members carrying the BGZF block size are located without
+         * decompressing them and are decompressed concurrently on
+         * the given threadpool. The members following the first
+         * member without the block size are decompressed one
+         * after another
+         *
+         * @throw InflateDataCorruptionException when data is
+         * corrupted
+         * @param threadpool the reference to the threadpool
+         * @return the decompressed data
+         */
+        [[nodiscard]] Range operator()(async::Threadpool& threadpool);
     private:
         typedef PolicyIterRT<Policy, Range>             Iterator;
+        typedef std::optional<size_type>                OptSize;
 
         Range                                           range;
         Iterator                                        rangeIterator;
@@ -203,11 +226,54 @@ namespace mpgl {
         void checkHeaderChecksum(void);
 
         /**
-         * Returns a checksum of the decompressed data
+         * Returns the size of the decompressed data saved in
+         * the trailer. The size is limited by the maximum
+         * compression ratio of the DEFLATE standard so the corrupted
+         * trailer cannot force a huge allocation
+         *
+         * @param offset the offset of the compressed data
+         * @return the expected size of the decompressed data
+         */
+        std::size_t getSizeHint(std::size_t offset);
+
+        /**
+         * Returns the size of the member beginning at the given
+         * position if its header contains the BGZF block size.
+         * Otherwise returns an empty optional
          *
-         * @return the checksum of the decompressed data
+         * @param position the position of the member
+         * @return the optional with the size of the member
          */
-        uint32 getChecksum(void);
+        [[nodiscard]] OptSize getMemberSize(
+            size_type position) const noexcept;
+
+        /**
+         * Decompresses the members beginning at the given position
+         * one after another and appends their data to the given
+         * range
+         *
+         * @throw InflateDataCorruptionException when data is
+         * corrupted
+         * @param position the position of the first member
+         * @param decompressed the reference to the decompressed
+         * data
+         */
+        void decompressMembers(
+            size_type position,
+            Range& decompressed) const;
+
+        /**
+         * Appends the given data to the given range
+         *
+         * @param decompressed the reference to the decompressed
+         * data
+         * @param data the constant reference to the appended data
+         */
+        static void append(Range& decompressed, Range const& data);
+
+        /// The maximum compression ratio of the DEFLATE standard
+        static constexpr const std::size_t              MaxRatio
+            = 1032;
     };
 
 }
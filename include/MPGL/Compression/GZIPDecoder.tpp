@@ -104,20 +104,137 @@ namespace mpgl {
     }
 
     template <ByteFlexibleRange Range, security::SecurityPolicy Policy>
-    uint32 GZIPDecoder<Range, Policy>::getChecksum(void) {
-        return peekType<uint32, false>(range.end() - 8);
+    std::size_t GZIPDecoder<Range, Policy>::getSizeHint(
+        std::size_t offset)
+    {
+        std::size_t size = peekType<uint32, false>(range.end() - 4);
+        return std::min(size, (range.size() - offset) * MaxRatio);
     }
 
     template <ByteFlexibleRange Range, security::SecurityPolicy Policy>
     [[nodiscard]] Range
         GZIPDecoder<Range, Policy>::operator()(void)
     {
-        auto distance = rangeIterator - range.begin();
-        range.erase(range.begin(), range.begin() + distance);
-        uint32 checksum = getChecksum();
-        auto decompressed = Inflate{std::move(range), policy}();
-        if (checksum != crc32(decompressed))
-            throw InflateDataCorruptionException{};
+        if (auto size = getMemberSize(0); size && *size != range.size()) {
+            Range decompressed;
+            decompressMembers(0, decompressed);
+            return decompressed;
+        }
+        std::size_t offset = rangeIterator - getIterator();
+        std::size_t sizeHint = getSizeHint(offset);
+        Inflate inflate{std::move(range), offset, policy};
+        auto [decompressed, computed] = inflate([](auto data, uint32 sum)
+            { return crc32(data, sum); }, 0, sizeHint);
+        range = inflate.release();
+        size_type end = inflate.getOffset() + 8;
+        if (end > range.size() || computed != peekType<uint32, false>(
+            range.begin() + (end - 8)))
+                throw InflateDataCorruptionException{};
+        if (end != range.size())
+            decompressMembers(end, decompressed);
+        return std::move(decompressed);
+    }
+
+    template <ByteFlexibleRange Range, security::SecurityPolicy Policy>
+    [[nodiscard]] GZIPDecoder<Range, Policy>::OptSize
+        GZIPDecoder<Range, Policy>::getMemberSize(
+            size_type position) const noexcept
+    {
+        /// The size of the header preceding the extra fields
+        static constexpr const size_type HeaderSize = 12;
+
+        auto byte = [&](size_type index) -> size_type
+            { return static_cast<uint8>(range.begin()[position + index]); };
+        size_type left = range.size() - position;
+        if (left < HeaderSize || byte(0) != 0x1F || byte(1) != 0x8B
+            || byte(2) != 0x08 || !(byte(3) & 0x04))
+                return {};
+        size_type end = HeaderSize + (byte(10) | (byte(11) << 8));
+        if (end > left)
+            return {};
+        for (size_type i = HeaderSize; i + 4 <= end;) {
+            size_type length = byte(i + 2) | (byte(i + 3) << 8);
+            if (byte(i) == 'B' && byte(i + 1) == 'C' && length == 2
+                && i + 6 <= end)
+            {
+                size_type size = (byte(i + 4) | (byte(i + 5) << 8)) + 1;
+                if (size > left)
+                    return {};
+                return size;
+            }
+            i += 4 + length;
+        }
+        return {};
+    }
+
+    template <ByteFlexibleRange Range, security::SecurityPolicy Policy>
+    void GZIPDecoder<Range, Policy>::append(
+        Range& decompressed,
+        Range const& data)
+    {
+        size_type size = decompressed.size();
+        decompressed.resize(size + data.size());
+        std::ranges::copy(data, decompressed.begin() + size);
+    }
+
+    template <ByteFlexibleRange Range, security::SecurityPolicy Policy>
+    void GZIPDecoder<Range, Policy>::decompressMembers(
+        size_type position,
+        Range& decompressed) const
+    {
+        if constexpr (std::ranges::contiguous_range<Range>) {
+            GZIPStreamDecoder decoder;
+            GZIPStreamDecoder::InputSpan input{
+                reinterpret_cast<char const*>(std::ranges::data(range))
+                    + position, range.size() - position};
+            size_type size = decompressed.size();
+            while (!input.empty()) {
+                if (decompressed.size() == size)
+                    decompressed.resize(std::max(2 * size,
+                        size + 4 * input.size()));
+                auto [consumed, produced, status] = decoder(input,
+                    GZIPStreamDecoder::OutputSpan{reinterpret_cast<char*>(
+                        std::ranges::data(decompressed)) + size,
+                        decompressed.size() - size});
+                input = input.subspan(consumed);
+                size += produced;
+                if (status == GZIPStreamDecoder::Status::Finished)
+                    decoder.reset();
+                else if (status == GZIPStreamDecoder::Status::NeedsInput)
+                    throw InflateDataCorruptionException{};
+            }
+            decompressed.resize(size);
+        } else {
+            Range member;
+            member.resize(range.size() - position);
+            std::copy(range.begin() + position, range.end(),
+                member.begin());
+            append(decompressed,
+                GZIPDecoder{std::move(member), policy}());
+        }
+    }
+
+    template <ByteFlexibleRange Range, security::SecurityPolicy Policy>
+    [[nodiscard]] Range GZIPDecoder<Range, Policy>::operator()(
+        async::Threadpool& threadpool)
+    {
+        std::vector<std::future<Range>> members;
+        size_type position = 0;
+        for (OptSize size; (size = getMemberSize(position));
+            position += *size)
+        {
+            Range member;
+            member.resize(*size);
+            std::copy_n(range.begin() + position, *size, member.begin());
+            members.push_back(threadpool.appendTask(
+                [member = std::move(member), policy = policy]() mutable
+                    { return GZIPDecoder{std::move(member), policy}(); }));
+        }
+        Range decompressed;
+        for (auto& member : members)
+            append(decompressed, member.get());
+        if (position != range.size())
+            decompressMembers(position, decompressed);
         return decompressed;
     }
 
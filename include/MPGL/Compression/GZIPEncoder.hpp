@@ -0,0 +1,149 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#pragma once
+
+#include <MPGL/Concurrency/Threadpool.hpp>
+#include <MPGL/Compression/Deflate.hpp>
+
+#include <optional>
+#include <string>
+
+namespace mpgl {
+
+    /**
+     * Compresses the data into the single member gzip stream.
+     * Writes the gzip header, the DEFLATE stream and the crc32
+     * checksum with the size of the data
+     */
+    class GZIPEncoder {
+    public:
+        typedef Deflate::InputSpan                      InputSpan;
+        typedef Deflate::Buffer                         Buffer;
+        typedef Deflate::CompressionLevel               CompressionLevel;
+        typedef std::optional<std::string>              OptString;
+        typedef Deflate::size_type                      size_type;
+
+        /// The maximum size of the data in the BGZF member
+        static constexpr const size_type                BlockSize
+            = 0xFF00;
+
+        /**
+         * Constructs a new GZIP Encoder object
+         *
+         * @param level the compression level
+         * @param oryginalName the optional with the oryginal
+         * file name saved in the header
+         * @param modificationTime the last modification time
+         * of the data saved in the header
+         */
+        explicit GZIPEncoder(
+            CompressionLevel level = CompressionLevel::Default,
+            OptString oryginalName = {},
+            uint32 modificationTime = 0)
+                : oryginalName{std::move(oryginalName)},
+                deflate{level}, modificationTime{modificationTime} {}
+
+        /**
+         * Compresses the given data into the gzip stream
+         *
+         * @param input the compressed data
+         * @return the gzip stream
+         */
+        [[nodiscard]] Buffer operator()(InputSpan input) const;
+
+        /**
+         * Compresses the given data into the multi-member gzip
+         * stream. The data is split into blocks which are
+         * compressed concurrently on the given threadpool into
+         * the independent members. Each member carries its size
+         * in the BGZF extra field, so the stream can be
+         * decompressed concurrently as well
+         *
+         * @param input the compressed data
+         * @param threadpool the reference to the threadpool
+         * @return the gzip stream
+         */
+        [[nodiscard]] Buffer operator()(
+            InputSpan input,
+            async::Threadpool& threadpool) const;
+
+        /**
+         * Returns the compression level
+         *
+         * @return the compression level
+         */
+        [[nodiscard]] CompressionLevel getCompressionLevel(
+            void) const noexcept
+                { return deflate.getCompressionLevel(); }
+
+        /**
+         * Returns the optional with the oryginal file name
+         *
+         * @return the optional with the oryginal file name
+         */
+        [[nodiscard]] OptString const&
+            getOryginalName(void) const noexcept
+                { return oryginalName; }
+
+        /**
+         * Returns the last modification time of the data
+         *
+         * @return the last modification time of the data
+         */
+        [[nodiscard]] uint32
+            getModificationTime(void) const noexcept
+                { return modificationTime; }
+    private:
+        /**
+         * Appends the given value in the little endian order
+         *
+         * @param value the appended value
+         * @param output the reference to the output buffer
+         */
+        static void saveLittleEndian(uint32 value, Buffer& output);
+
+        /**
+         * Appends the gzip member with the given data
+         *
+         * @param input the compressed data
+         * @param output the reference to the output buffer
+         * @param blockSize whether the member carries its size
+         * in the BGZF extra field
+         * @param name whether the member carries the oryginal
+         * file name
+         */
+        void writeMember(
+            InputSpan input,
+            Buffer& output,
+            bool blockSize,
+            bool name) const;
+
+        OptString                                       oryginalName;
+        Deflate                                         deflate;
+        uint32                                          modificationTime;
+    };
+
+}
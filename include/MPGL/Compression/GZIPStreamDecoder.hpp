@@ -0,0 +1,186 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#pragma once
+
+#include <MPGL/Compression/InflateStream.hpp>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace mpgl {
+
+    /**
+     * Resumable decompressor of the gzip streams. Parses
+     * the gzip header and trailer and decompresses the data
+     * using the DEFLATE stream decompressor. The data can be
+     * supplied in chunks of any size. Decompresses one gzip
+     * member; the following members can be decompressed after
+     * resetting the decoder
+     */
+    class GZIPStreamDecoder {
+    public:
+        typedef InflateStream::InputSpan                InputSpan;
+        typedef InflateStream::OutputSpan               OutputSpan;
+        typedef InflateStream::size_type                size_type;
+        typedef InflateStream::Status                   Status;
+        typedef InflateStream::Result                   Result;
+        typedef std::optional<std::string>              OptString;
+
+        /**
+         * Constructs a new GZIP Stream Decoder object
+         */
+        explicit GZIPStreamDecoder(void) = default;
+
+        /**
+         * Decompresses the given chunk of the compressed data
+         * into the given output buffer. Stops when the input is
+         * exhausted, the output is full or the member has ended.
+         * The bytes following the member are not consumed
+         *
+         * @throw InflateInvalidHeaderException when header magic
+         * number is invalid
+         * @throw InflateDataCorruptionException when the data,
+         * the header or the trailer is corrupted
+         * @throw NotSupportedException when the member uses
+         * other compression than DEFLATE
+         * @param input the chunk of the compressed data
+         * @param output the output buffer
+         * @return the result of the decompression step
+         */
+        [[nodiscard]] Result operator()(
+            InputSpan input,
+            OutputSpan output);
+
+        /**
+         * Returns whether the end of the member has been reached
+         *
+         * @return if the end of the member has been reached
+         */
+        [[nodiscard]] bool isFinished(void) const noexcept
+            { return state == State::Finished; }
+
+        /**
+         * Returns last modification time of the data. Valid
+         * after the header has been parsed
+         *
+         * @return the last modification time of the data
+         */
+        [[nodiscard]] uint32
+            getModificationTime(void) const noexcept
+                { return modificationTime; }
+
+        /**
+         * Returns an optional with the oryginal file name.
+         * If this data is not included then returns an empty
+         * optional
+         *
+         * @return the optional with oryginal file name
+         */
+        [[nodiscard]] OptString const&
+            getOryginalName(void) const noexcept
+                { return oryginalName; }
+
+        /**
+         * Returns an optional with the data's comment.
+         * If this data is not included then returns an empty
+         * optional
+         *
+         * @return the optional with the comment
+         */
+        [[nodiscard]] OptString const&
+            getComment(void) const noexcept
+                { return comment; }
+
+        /**
+         * Resets the decoder so it can decompress a new member
+         */
+        void reset(void) noexcept;
+
+        /**
+         * Destroys the GZIP Stream Decoder object
+         */
+        ~GZIPStreamDecoder(void) noexcept = default;
+    private:
+        /**
+         * The part of the stream that is parsed next
+         */
+        enum class State : uint8 {
+            Header,
+            Data,
+            Trailer,
+            Finished
+        };
+
+        typedef std::vector<char>                       Pending;
+        typedef std::optional<size_type>                OptSize;
+
+        /**
+         * Moves the input bytes to the pending buffer and
+         * parses the header. Returns the number of the consumed
+         * input bytes
+         *
+         * @param input the chunk of the compressed data
+         * @return the number of the consumed input bytes
+         */
+        size_type readHeader(InputSpan input);
+
+        /**
+         * Parses the header saved in the pending buffer. Returns
+         * the length of the header or an empty optional when
+         * the header is not complete
+         *
+         * @return the length of the header
+         */
+        OptSize parseHeader(void);
+
+        /**
+         * Parses the zero-terminated string starting at the
+         * given position of the pending buffer
+         *
+         * @param position the reference to the position
+         * @return the parsed string or an empty optional when
+         * the string is not complete
+         */
+        OptString parseString(size_type& position) const;
+
+        InflateStream                                   inflate;
+        Pending                                         pending;
+        OptString                                       oryginalName;
+        OptString                                       comment;
+        uint32                                          checksum = 0;
+        uint32                                          size = 0;
+        uint32                                          modificationTime = 0;
+        State                                           state
+            = State::Header;
+
+        static constexpr const uint8                    HeaderLength
+            = 10;
+        static constexpr const uint8                    TrailerLength
+            = 8;
+    };
+
+}
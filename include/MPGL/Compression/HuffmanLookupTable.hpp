@@ -0,0 +1,276 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#pragma once
+
+#include <MPGL/Exceptions/HuffmanTree/HuffmanTreeUnknownToken.hpp>
+#include <MPGL/Traits/Concepts.hpp>
+#include <MPGL/IO/BitReader.hpp>
+#include <MPGL/IO/Readers.hpp>
+
+#include <utility>
+#include <vector>
+#include <array>
+
+namespace mpgl {
+
+    /**
+     * Decodes the canonical huffman codes using the flat lookup
+     * table. The table consists of the primary table indexed
+     * by the next bits of the stream and the overflow sub-tables
+     * used by the codes longer than the primary table index.
+     * Each token is resolved in one or two memory accesses
+     *
+     * @tparam BigEndian indicates if the codes are saved in the
+     * big-endian manner [JPEG]. Otherwise the first bit of the
+     * code is the least significant bit of the stream [DEFLATE]
+     */
+    template <bool BigEndian = false>
+    class HuffmanLookupTable {
+    public:
+        typedef std::vector<uint8>                  LengthsVector;
+        typedef std::vector<uint16>                 SymbolsVector;
+
+        /// The maximum length of the supported code
+        static constexpr const uint8                MaxCodeLength = 16;
+        /// The default size of the primary table index
+        static constexpr const uint8                DefaultPrimaryBits
+            = 9;
+
+        /**
+         * Constructs a new Huffman Lookup Table object from
+         * the given token lengths range
+         *
+         * @tparam LengthRange the length range type
+         * @param lengths the constant reference to the range
+         * object containing token sizes
+         * @param primaryBits the size of the primary table index
+         */
+        template <ForwardConvertible<uint8> LengthRange>
+        explicit HuffmanLookupTable(
+            LengthRange const& lengths,
+            uint8 primaryBits = DefaultPrimaryBits);
+
+        /**
+         * Constructs a new Huffman Lookup Table object from
+         * the given token lengths vector
+         *
+         * @param lengths the constant reference to the vector
+         * containing token sizes
+         * @param primaryBits the size of the primary table index
+         */
+        explicit HuffmanLookupTable(
+            LengthsVector const& lengths,
+            uint8 primaryBits = DefaultPrimaryBits);
+
+        /**
+         * Constructs a new Huffman Lookup Table object from the
+         * given characters and the number of tokens with the
+         * length of counted range index
+         *
+         * @tparam CountedRange the size range type
+         * @tparam CharRange the characters range type
+         * @param counted the constant reference to the
+         * size range object
+         * @param characters the constant reference to the
+         * characters range object
+         * @param primaryBits the size of the primary table index
+         */
+        template <RandomAccessConvertible<uint8> CountedRange,
+            ForwardConvertible<uint16> CharRange>
+        explicit HuffmanLookupTable(
+            CountedRange const& counted,
+            CharRange const& characters,
+            uint8 primaryBits = DefaultPrimaryBits);
+
+        /**
+         * Constructs a new Huffman Lookup Table object from the
+         * given characters and the number of tokens with the
+         * length of counted vector index
+         *
+         * @param counted the constant reference to the
+         * size vector
+         * @param characters the constant reference to the
+         * characters vector
+         * @param primaryBits the size of the primary table index
+         */
+        explicit HuffmanLookupTable(
+            LengthsVector const& counted,
+            SymbolsVector const& characters,
+            uint8 primaryBits = DefaultPrimaryBits);
+
+        HuffmanLookupTable(HuffmanLookupTable const&) = default;
+        HuffmanLookupTable(HuffmanLookupTable&&) noexcept = default;
+
+        HuffmanLookupTable& operator=(
+            HuffmanLookupTable const&) = default;
+        HuffmanLookupTable& operator=(
+            HuffmanLookupTable&&) noexcept = default;
+
+        /**
+         * Decodes the symbol under the given iterator
+         * and returns decoded token
+         *
+         * @throw HuffmanTreeUnknownToken when given
+         * symbol is unknown
+         * @tparam Iter the iterator type
+         * @param iterator the reference to the iterator
+         * @return the decoded token
+         */
+        template <BitInputIterator Iter>
+        [[nodiscard]] uint16 operator()(Iter& iterator) const;
+
+        /**
+         * Decodes the symbol under the given bit reader
+         * and returns decoded token
+         *
+         * @throw HuffmanTreeUnknownToken when given
+         * symbol is unknown
+         * @tparam Iter the reader's iterator type
+         * @tparam Sent the reader's sentinel type
+         * @param reader the reference to the bit reader
+         * @return the decoded token
+         */
+        template <ByteInputIterator Iter, std::sentinel_for<Iter> Sent>
+        [[nodiscard]] uint16 operator()(
+            BitReader<Iter, Sent, BigEndian>& reader) const;
+
+        /**
+         * Decodes the symbol from the given bits. The bits have
+         * to contain the next MaxCodeLength bits of the stream
+         * in the table's bit order [the big-endian bits are
+         * aligned to the most significant bit]. Returns the
+         * symbol and the length of its code. The length is equal
+         * to zero when the code is unknown
+         *
+         * @param bits the next bits of the stream
+         * @return the pair containing the symbol and its length
+         */
+        [[nodiscard]] std::pair<uint16, uint8> decode(
+            uint32 bits) const noexcept;
+
+        /**
+         * Returns a table used by the fixed DEFLATE literal
+         * and length coding
+         *
+         * @return the fixed literal and length table
+         */
+        [[nodiscard]] static HuffmanLookupTable
+            createDeflateTable(void) requires (!BigEndian);
+
+        /**
+         * Returns a table used by the fixed DEFLATE distance
+         * coding
+         *
+         * @return the fixed distance table
+         */
+        [[nodiscard]] static HuffmanLookupTable
+            createDeflateDistanceTable(void) requires (!BigEndian);
+
+        /**
+         * Destroys the Huffman Lookup Table object
+         */
+        ~HuffmanLookupTable(void) noexcept = default;
+    private:
+        /**
+         * The entry of the lookup table. When the sub-table
+         * bits are non-zero then the entry links to the sub-table
+         * that begins at the symbol index
+         */
+        struct Entry {
+            uint16                                  symbol = 0;
+            uint8                                   length = 0;
+            uint8                                   subtableBits = 0;
+        };
+
+        /**
+         * The token with its canonical code
+         */
+        struct Token {
+            uint16                                  symbol;
+            uint8                                   length;
+            uint32                                  code;
+        };
+
+        typedef std::vector<Entry>                  Entries;
+        typedef std::vector<Token>                  Tokens;
+
+        /**
+         * Assigns the canonical codes to the given tokens.
+         * Tokens have to be sorted by their code length. Drops
+         * the tokens that do not fit in their code length
+         *
+         * @param tokens the reference to the tokens vector
+         */
+        static void assignCodes(Tokens& tokens) noexcept;
+
+        /**
+         * Returns the index of the primary table entry of
+         * the given code
+         *
+         * @param code the code
+         * @param length the length of the code
+         * @return the index of the primary table entry
+         */
+        uint32 primaryIndex(uint32 code, uint8 length) const noexcept;
+
+        /**
+         * Builds the lookup table from the given tokens
+         *
+         * @param tokens the constant reference to the tokens
+         * vector
+         */
+        void buildTable(Tokens const& tokens);
+
+        /**
+         * Allocates the sub-tables for the codes longer than
+         * the primary table index
+         *
+         * @param tokens the constant reference to the tokens
+         * vector
+         */
+        void allocateSubtables(Tokens const& tokens);
+
+        /**
+         * Fills the table entries with the given token
+         *
+         * @param token the constant reference to the token
+         */
+        void emplaceToken(Token const& token);
+
+        /**
+         * Fills the sub-table entries with the given token
+         *
+         * @param token the constant reference to the token
+         */
+        void emplaceLongToken(Token const& token);
+
+        Entries                                     entries;
+        uint8                                       primaryBits;
+    };
+
+}
+
+#include <MPGL/Compression/HuffmanLookupTable.tpp>
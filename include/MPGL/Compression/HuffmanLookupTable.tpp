@@ -0,0 +1,111 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#pragma once
+
+namespace mpgl {
+
+    template <bool BigEndian>
+    template <ForwardConvertible<uint8> LengthRange>
+    HuffmanLookupTable<BigEndian>::HuffmanLookupTable(
+        LengthRange const& lengths,
+        uint8 primaryBits)
+            : HuffmanLookupTable{LengthsVector(
+                std::ranges::begin(lengths), std::ranges::end(lengths)),
+                primaryBits} {}
+
+    template <bool BigEndian>
+    template <RandomAccessConvertible<uint8> CountedRange,
+        ForwardConvertible<uint16> CharRange>
+    HuffmanLookupTable<BigEndian>::HuffmanLookupTable(
+        CountedRange const& counted,
+        CharRange const& characters,
+        uint8 primaryBits)
+            : HuffmanLookupTable{
+                LengthsVector(std::ranges::begin(counted),
+                    std::ranges::end(counted)),
+                SymbolsVector(std::ranges::begin(characters),
+                    std::ranges::end(characters)),
+                primaryBits} {}
+
+    template <bool BigEndian>
+    template <BitInputIterator Iter>
+    [[nodiscard]] uint16 HuffmanLookupTable<BigEndian>::operator()(
+        Iter& iterator) const
+    {
+        auto peek = [&iterator](uint8 length) -> uint32 {
+            if constexpr (BigEndian)
+                return peekRNBits<uint32>(length, iterator);
+            else
+                return peekNBits<uint32>(length, iterator);
+        };
+        Entry entry = entries[peek(primaryBits)];
+        if (entry.subtableBits) {
+            std::ranges::advance(iterator, primaryBits);
+            entry = entries[entry.symbol + peek(entry.subtableBits)];
+            if (!entry.length)
+                throw HuffmanTreeUnknownToken{};
+            std::ranges::advance(iterator, entry.length - primaryBits);
+        } else if (entry.length)
+            std::ranges::advance(iterator, entry.length);
+        else
+            throw HuffmanTreeUnknownToken{};
+        return entry.symbol;
+    }
+
+    template <bool BigEndian>
+    template <ByteInputIterator Iter, std::sentinel_for<Iter> Sent>
+    [[nodiscard]] uint16 HuffmanLookupTable<BigEndian>::operator()(
+        BitReader<Iter, Sent, BigEndian>& reader) const
+    {
+        auto [symbol, length] = decode(reader.peekBits(MaxCodeLength));
+        if (!length)
+            throw HuffmanTreeUnknownToken{};
+        reader.skipBits(length);
+        return symbol;
+    }
+
+    template <bool BigEndian>
+    [[nodiscard]] std::pair<uint16, uint8>
+        HuffmanLookupTable<BigEndian>::decode(
+            uint32 bits) const noexcept
+    {
+        Entry entry;
+        if constexpr (BigEndian) {
+            entry = entries[bits >> (MaxCodeLength - primaryBits)];
+            if (entry.subtableBits)
+                entry = entries[entry.symbol + ((bits >> (MaxCodeLength
+                    - primaryBits - entry.subtableBits))
+                    & ((1u << entry.subtableBits) - 1))];
+        } else {
+            entry = entries[bits & ((1u << primaryBits) - 1)];
+            if (entry.subtableBits)
+                entry = entries[entry.symbol + ((bits >> primaryBits)
+                    & ((1u << entry.subtableBits) - 1))];
+        }
+        return {entry.symbol, entry.length};
+    }
+
+}
@@ -28,9 +28,12 @@
 #include <MPGL/Exceptions/Inflate/InflateDataCorruptionException.hpp>
 #include <MPGL/Exceptions/SecurityUnknownPolicyException.hpp>
 #include <MPGL/Utility/Tokens/Security.hpp>
-#include <MPGL/Compression/HuffmanTree.hpp>
+#include <MPGL/Compression/HuffmanLookupTable.hpp>
+#include <MPGL/Compression/DeflateTables.hpp>
 #include <MPGL/Iterators/SafeIterator.hpp>
-#include <MPGL/IO/Readers.hpp>
+#include <MPGL/IO/BitReader.hpp>
+
+#include <ranges>
 
 namespace mpgl {
 
@@ -42,8 +45,13 @@ namespace mpgl {
      */
     template <ByteFlexibleRange Range,
         security::SecurityPolicy Policy = Secured>
-    class Inflate {
+    class Inflate : private DeflateTables {
     public:
+        typedef std::ranges::subrange<
+            typename Range::iterator>                   Subrange;
+        typedef uint32 (*Checksum)(Subrange, uint32);
+        typedef std::pair<Range, uint32>                ChecksummedRange;
+
         /**
          * Constructs a new Inflate object from the given
          * range universal reference and policy token
@@ -54,73 +62,242 @@ namespace mpgl {
          */
         explicit Inflate(Range&& range, Policy policy = {});
 
+        /**
+         * Constructs a new Inflate object from the given
+         * range universal reference and policy token. The
+         * compressed data begins at the given offset of the
+         * range
+         *
+         * @param range the universal reference to the decompressed
+         * object
+         * @param offset the offset of the compressed data
+         * @param policy the secure policy token
+         */
+        explicit Inflate(
+            Range&& range,
+            std::size_t offset,
+            Policy policy = {});
+
         /**
          * Decompresses the given range and returns the range
-         * containing decompressed data
+         * containing decompressed data. The output is preallocated
+         * with the given expected size of the decompressed data
          *
          * @throw InflateDataCorruptionException when headers
          * are corrupted
+         * @param sizeHint the expected size of the decompressed
+         * data
          * @return the decompressed data
          */
-        [[nodiscard]] Range operator()(void);
+        [[nodiscard]] Range operator()(std::size_t sizeHint = 0);
+
+        /**
+         * Decompresses the given range and returns the range
+         * containing decompressed data with its checksum. The
+         * checksum is updated with the small chunks of the data
+         * right after they are decompressed, while they are still
+         * in the cache
+         *
+         * @throw InflateDataCorruptionException when headers
+         * are corrupted
+         * @param checksum the function updating the checksum
+         * @param initial the initial value of the checksum
+         * @param sizeHint the expected size of the decompressed
+         * data
+         * @return the decompressed data and its checksum
+         */
+        [[nodiscard]] ChecksummedRange operator()(
+            Checksum checksum,
+            uint32 initial,
+            std::size_t sizeHint = 0);
+
+        /**
+         * Returns the offset of the compressed data. After the
+         * decompression it points to the first byte following
+         * the decompressed DEFLATE stream
+         *
+         * @return the offset of the compressed data
+         */
+        [[nodiscard]] std::size_t getOffset(void) const noexcept
+            { return offset; }
+
+        /**
+         * Moves the compressed range out of the object. Allows to
+         * access the data following the DEFLATE stream after
+         * the decompression
+         *
+         * @return the compressed range
+         */
+        [[nodiscard]] Range release(void) noexcept
+            { return std::move(range); }
     private:
         typedef PolicyIterRT<Policy, Range>             Iterator;
-        typedef LittleEndianInputBitIter<Iterator>      BitIter;
-        typedef HuffmanTree<uint16>::Decoder            Decoder;
+        typedef LittleEndianBitReader<Iterator>         Reader;
+        typedef HuffmanLookupTable<>                    Decoder;
         typedef std::vector<uint16>                     VectorU16;
+        typedef typename Range::iterator                OutputIter;
 
         /**
-         * Returns an iterator to the compressed range
+         * The decompressed data. Keeps the range resized ahead of
+         * the written data, so the literals and the matches are
+         * written in place with a single bounds check each
+         */
+        class Output {
+        public:
+            /**
+             * Constructs a new Output object
+             *
+             * @param range the reference to the decompressed
+             * data range
+             * @param sizeHint the expected size of the decompressed
+             * data
+             */
+            explicit Output(Range& range, std::size_t sizeHint);
+
+            /**
+             * Constructs a new Output object which updates
+             * the checksum with the written data
+             *
+             * @param range the reference to the decompressed
+             * data range
+             * @param sizeHint the expected size of the decompressed
+             * data
+             * @param checksum the function updating the checksum
+             * @param initial the initial value of the checksum
+             */
+            explicit Output(
+                Range& range,
+                std::size_t sizeHint,
+                Checksum checksum,
+                uint32 initial);
+
+            /**
+             * Appends the literal to the decompressed data
+             *
+             * @param literal the literal
+             */
+            void push(uint8 literal);
+
+            /**
+             * Appends the previous occurence of the decompressed
+             * data. The non overlapping matches are copied at once
+             * and the overlapping ones are replicated with
+             * the growing chunks of the repeating pattern
+             *
+             * @throw InflateDataCorruptionException when
+             * the distance exceeds the decompressed data
+             * @param distance the distance of the match
+             * @param length the length of the match
+             */
+            void copyMatch(std::size_t distance, std::size_t length);
+
+            /**
+             * Appends the given number of the not initialized
+             * bytes to the decompressed data
+             *
+             * @param length the number of bytes
+             * @return the iterator to the first appended byte
+             */
+            [[nodiscard]] OutputIter append(std::size_t length);
+
+            /**
+             * Updates the checksum with the data written since
+             * the previous update
+             */
+            void updateChecksum(void);
+
+            /**
+             * Returns the checksum of the written data. Valid
+             * after the output has been finished
+             *
+             * @return the checksum of the written data
+             */
+            [[nodiscard]] uint32 getChecksum(void) const noexcept
+                { return checksumValue; }
+
+            /**
+             * Updates the checksum and shrinks the range to
+             * the written data
+             */
+            void finish(void);
+        private:
+            /**
+             * Resizes the range so it can hold the given number
+             * of the additional bytes
+             *
+             * @param length the number of the additional bytes
+             */
+            void grow(std::size_t length);
+
+            /// The minimal capacity of the output
+            static constexpr const std::size_t          MinCapacity
+                = 32768;
+
+            /// The number of bytes after which the checksum is updated
+            static constexpr const std::size_t          ChecksumChunk
+                = 16384;
+
+            Range&                                      range;
+            std::size_t                                 size = 0;
+            std::size_t                                 checked = 0;
+            Checksum                                    checksum
+                = nullptr;
+            uint32                                      checksumValue
+                = 0;
+        };
+
+        /**
+         * Returns a bit reader of the compressed range
          *
-         * @return the iterator to the compressed range
+         * @return the bit reader of the compressed range
          */
-        Iterator getIterator(void);
+        Reader getReader(void);
 
         /**
          * Decompresses a block of compressed data
          *
-         * @param iterator the reference to the bit iterator
+         * @param reader the reference to the bit reader
          * @param decompressed the reference to the decompressed
          * data object
          * @return if the block is not the final one
          */
-        bool readBlock(BitIter& iterator, Range& decompressed) const;
+        bool readBlock(Reader& reader, Output& decompressed) const;
 
         /**
          * Decompresses the fixed block
          *
-         * @param iterator the reference to the bit iterator
+         * @param reader the reference to the bit reader
          * @param decompressed the reference to the decompressed
          * data object
          */
         void decompressFixedBlock(
-            BitIter& iterator,
-            Range& decompressed) const;
+            Reader& reader,
+            Output& decompressed) const;
 
         /**
          * Decompresses the element of fixed block containing data
          * about previous occurence of decompressed data
          *
          * @param token the distance token
-         * @param iterator the reference to the bit iterator
+         * @param reader the reference to the bit reader
          * @param decompressed the reference to the decompressed
          * data object
          */
         void decompressFixedDistance(
             uint16 token,
-            BitIter& iterator,
-            Range& decompressed) const;
+            Reader& reader,
+            Output& decompressed) const;
 
         /**
          * Decompresses the dynamic block
          *
-         * @param iterator the reference to the bit iterator
+         * @param reader the reference to the bit reader
          * @param decompressed the reference to the decompressed
          * data object
          */
         void decompressDynamicBlock(
-            BitIter& iterator,
-            Range& decompressed) const;
+            Reader& reader,
+            Output& decompressed) const;
 
         /**
          * Generates the dynamic block huffman trees and decoders
@@ -128,14 +305,14 @@ namespace mpgl {
          * @param decoder the constant reference to the main decoder
          * @param literals the number of literals
          * @param distances the number of distances
-         * @param iterator the reference to the bit iterator
+         * @param reader the reference to the bit reader
          * @return the pair containing normal and distance decoder
          */
         std::pair<Decoder, Decoder> generateDynamicTrees(
             Decoder const& decoder,
             uint32 literals,
             uint32 distances,
-            BitIter& iterator) const;
+            Reader& reader) const;
 
         /**
          * Parses the bit lengths of tokens in the dynamic
@@ -144,21 +321,21 @@ namespace mpgl {
          * @param decoder the constant reference to the main decoder
          * @param literals the number of literals
          * @param distances the number of distances
-         * @param iterator the reference to the bit iterator
+         * @param reader the reference to the bit reader
          * @return the vector containing bit lengths of tokens
          */
         VectorU16 readBitLengths(
             Decoder const& decoder,
             uint32 literals,
             uint32 distances,
-            BitIter& iterator) const;
+            Reader& reader) const;
 
         /**
          * Parses the length of the code in the dynamic huffman tree
          *
          * @param repeater the reference to the counter which
          * copies given token the given number of times
-         * @param iterator the reference to the bit iterator
+         * @param reader the reference to the bit reader
          * @param bitLengths the constant reference to the bit lengths
          * vector
          * @param token the token
@@ -166,7 +343,7 @@ namespace mpgl {
          */
         uint16 readCodeLength(
             std::size_t& repeater,
-            BitIter& iterator,
+            Reader& reader,
             VectorU16 const& bitLengths,
             uint16 token) const;
 
@@ -177,22 +354,22 @@ namespace mpgl {
          * decoder
          * @param distanceDecoder the constant reference to the
          * distance decoder
-         * @param iterator the reference to the bit iterator
+         * @param reader the reference to the bit reader
          * @param decompressed the reference to the decompressed
          * data object
          */
         void dynamicBlockLoop(
             Decoder const& mainDecoder,
             Decoder const& distanceDecoder,
-            BitIter& iterator,
-            Range& decompressed) const;
+            Reader& reader,
+            Output& decompressed) const;
 
         /**
          * Decompresses the element of the dynamic block containing
          * data about previous occurence of decompressed data
          *
          * @param token the distance token
-         * @param iterator the reference to the bit iterator
+         * @param reader the reference to the bit reader
          * @param distanceDecoder the constant reference to the
          * distance decoder
          * @param decompressed the reference to the decompressed
@@ -200,56 +377,28 @@ namespace mpgl {
          */
         void decompressDynamicDistance(
             uint16 token,
-            BitIter& iterator,
+            Reader& reader,
             Decoder const& distanceDecoder,
-            Range& decompressed) const;
+            Output& decompressed) const;
 
         /**
          * Copies the uncompressed data block to the output range
          *
-         * @param iterator the reference to the bit iterator
+         * @param reader the reference to the bit reader
          * @param decompressed the reference to the decompressed
          * data object
          */
         void copyNotCompressed(
-            BitIter& iterator,
-            Range& decompressed) const;
+            Reader& reader,
+            Output& decompressed) const;
 
         Range                                           range;
+        std::size_t                                     offset;
 
         /// The fixed block decoder
-        static Decoder                                  fixedCodeDecoder;
-        static constexpr const uint16                   MaxAlphabetLength
-            = 288;
-        static constexpr const uint16                   BlockEnd
-            = 256;
-        /// Extra distance bits lengths
-        static constexpr const std::array<
-            std::pair<uint8, uint16>, 29>               extraLength =
-        {
-            std::pair<uint8, uint8>{0, 3}, {0, 4}, {0, 5}, {0, 6},
-            {0, 7}, {0, 8}, {0, 9}, {0, 10}, {1, 11}, {1, 13}, {1, 15},
-            {1, 17}, {2, 19}, {2, 23}, {2, 27}, {2, 31}, {3, 35},
-            {3, 43}, {3, 51}, {3, 59}, {4, 67}, {4, 83}, {4, 99},
-            {4, 115}, {5, 131}, {5, 163}, {5, 195}, {5, 227}, {0, 258}
-        };
-        /// Extra distance bits distances
-        static constexpr const std::array<
-            std::pair<uint8, uint32>, 30>               distances =
-        {
-            std::pair<uint8, uint32>{0, 1}, {0, 2}, {0, 3}, {0, 4},
-            {1, 5}, {1, 7}, {2, 9}, {2, 13}, {3, 17}, {3, 25}, {4, 33},
-            {4, 49}, {5, 65}, {5, 97}, {6, 129}, {6, 193}, {7, 257},
-            {7, 385}, {8, 513}, {8, 769}, {9, 1025}, {9, 1537},
-            {10, 2049}, {10, 3073}, {11, 4097}, {11, 6145}, {12, 8193},
-            {12, 12289}, {13, 16385}, {13, 24577}
-        };
-        /// The order of the dynamic codes
-        static constexpr const std::array<uint8, 19>    dynamicCodesOrder =
-        {
-            16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2,
-            14, 1, 15
-        };
+        static Decoder const                            fixedCodeDecoder;
+        /// The fixed block distance decoder
+        static Decoder const                            fixedDistanceDecoder;
     };
 
 }
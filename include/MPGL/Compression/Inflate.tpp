@@ -25,66 +25,194 @@
  */
 #pragma once
 
+#include <algorithm>
+
 namespace mpgl {
 
     template <ByteFlexibleRange Range, security::SecurityPolicy Policy>
-    HuffmanTree<uint16>::Decoder
-        Inflate<Range, Policy>::fixedCodeDecoder{};
+    Inflate<Range, Policy>::Decoder const
+        Inflate<Range, Policy>::fixedCodeDecoder
+            = Decoder::createDeflateTable();
+
+    template <ByteFlexibleRange Range, security::SecurityPolicy Policy>
+    Inflate<Range, Policy>::Decoder const
+        Inflate<Range, Policy>::fixedDistanceDecoder
+            = Decoder::createDeflateDistanceTable();
 
     template <ByteFlexibleRange Range, security::SecurityPolicy Policy>
     Inflate<Range, Policy>::Inflate(
         Range&& range,
         [[maybe_unused]] Policy policy)
-            : range{std::forward<Range>(range)} {}
+            : range{std::forward<Range>(range)}, offset{0} {}
 
     template <ByteFlexibleRange Range, security::SecurityPolicy Policy>
-    Inflate<Range, Policy>::Iterator
-        Inflate<Range, Policy>::getIterator(void)
+    Inflate<Range, Policy>::Inflate(
+        Range&& range,
+        std::size_t offset,
+        [[maybe_unused]] Policy policy)
+            : range{std::forward<Range>(range)}, offset{offset} {}
+
+    template <ByteFlexibleRange Range, security::SecurityPolicy Policy>
+    Inflate<Range, Policy>::Output::Output(
+        Range& range,
+        std::size_t sizeHint)
+            : range{range}
+    {
+        range.resize(std::max(sizeHint, MinCapacity));
+    }
+
+    template <ByteFlexibleRange Range, security::SecurityPolicy Policy>
+    Inflate<Range, Policy>::Output::Output(
+        Range& range,
+        std::size_t sizeHint,
+        Checksum checksum,
+        uint32 initial)
+            : Output{range, sizeHint}
     {
-        return makeIterator<Policy>(range.begin(), range.end() - 4);
+        this->checksum = checksum;
+        checksumValue = initial;
+    }
+
+    template <ByteFlexibleRange Range, security::SecurityPolicy Policy>
+    void Inflate<Range, Policy>::Output::updateChecksum(void) {
+        if (checksum && checked != size) {
+            checksumValue = checksum(Subrange{range.begin() + checked,
+                range.begin() + size}, checksumValue);
+            checked = size;
+        }
+    }
+
+    template <ByteFlexibleRange Range, security::SecurityPolicy Policy>
+    void Inflate<Range, Policy>::Output::grow(std::size_t length) {
+        range.resize(std::max(2 * range.size(), size + length));
+    }
+
+    template <ByteFlexibleRange Range, security::SecurityPolicy Policy>
+    void Inflate<Range, Policy>::Output::push(uint8 literal) {
+        if (size == range.size())
+            grow(1);
+        range[size++] = literal;
+    }
+
+    template <ByteFlexibleRange Range, security::SecurityPolicy Policy>
+    void Inflate<Range, Policy>::Output::copyMatch(
+        std::size_t distance,
+        std::size_t length)
+    {
+        if (distance > size)
+            throw InflateDataCorruptionException{};
+        if (range.size() - size < length)
+            grow(length);
+        auto target = range.begin() + size;
+        auto source = target - distance;
+        size += length;
+        if (distance >= length) {
+            std::copy_n(source, length, target);
+        } else if (distance == 1) {
+            std::fill_n(target, length, *source);
+        } else {
+            // each copy doubles the replicated pattern
+            std::copy_n(source, distance, target);
+            for (std::size_t copied = distance; copied < length;
+                copied *= 2)
+            {
+                std::copy_n(target, std::min(copied, length - copied),
+                    target + copied);
+            }
+        }
+        if (size - checked >= ChecksumChunk)
+            updateChecksum();
+    }
+
+    template <ByteFlexibleRange Range, security::SecurityPolicy Policy>
+    [[nodiscard]] Inflate<Range, Policy>::OutputIter
+        Inflate<Range, Policy>::Output::append(std::size_t length)
+    {
+        if (range.size() - size < length)
+            grow(length);
+        size += length;
+        return range.begin() + (size - length);
+    }
+
+    template <ByteFlexibleRange Range, security::SecurityPolicy Policy>
+    void Inflate<Range, Policy>::Output::finish(void) {
+        updateChecksum();
+        range.resize(size);
+    }
+
+    template <ByteFlexibleRange Range, security::SecurityPolicy Policy>
+    Inflate<Range, Policy>::Reader
+        Inflate<Range, Policy>::getReader(void)
+    {
+        if (offset > range.size())
+            throw InflateDataCorruptionException{};
+        return Reader{makeIterator<Policy>(range.begin() + offset,
+            range.end()), makeIterator<Policy>(range.end(), range.end())};
     }
 
     template <ByteFlexibleRange Range, security::SecurityPolicy Policy>
     [[nodiscard]] Range Inflate<Range, Policy>::operator() (
-        void)
+        std::size_t sizeHint)
+    {
+        return std::move((*this)(nullptr, 0, sizeHint).first);
+    }
+
+    template <ByteFlexibleRange Range, security::SecurityPolicy Policy>
+    [[nodiscard]] Inflate<Range, Policy>::ChecksummedRange
+        Inflate<Range, Policy>::operator() (
+            Checksum checksum,
+            uint32 initial,
+            std::size_t sizeHint)
     {
-        BitIter iterator{getIterator()};
-        Range decompressed;
-        while (readBlock(iterator, decompressed));
-        return decompressed;
+        Reader reader = getReader();
+        ChecksummedRange result;
+        Output output{result.first, sizeHint, checksum, initial};
+        try {
+            while (readBlock(reader, output))
+                output.updateChecksum();
+        } catch (BitReaderOutOfRangeException const&) {
+            throw InflateDataCorruptionException{};
+        }
+        offset = reader.getIter() - makeIterator<Policy>(
+            range.begin(), range.end());
+        output.finish();
+        result.second = output.getChecksum();
+        return result;
     }
 
     template <ByteFlexibleRange Range, security::SecurityPolicy Policy>
     [[nodiscard]] bool Inflate<Range, Policy>::readBlock(
-        BitIter& iterator,
-        Range& decompressed) const
+        Reader& reader,
+        Output& decompressed) const
     {
-        bool isFinal = *iterator++;
-        if (*iterator++) {
-            if (*iterator++)
+        auto header = reader.readBits(3);
+        switch (header >> 1) {
+            case 0:
+                copyNotCompressed(reader, decompressed);
+                break;
+            case 1:
+                decompressFixedBlock(reader, decompressed);
+                break;
+            case 2:
+                decompressDynamicBlock(reader, decompressed);
+                break;
+            default:
                 throw InflateDataCorruptionException{};
-            else
-                decompressFixedBlock(iterator, decompressed);
-        } else {
-            if (*iterator++)
-                decompressDynamicBlock(iterator, decompressed);
-            else
-                copyNotCompressed(iterator, decompressed);
         }
-        return !isFinal;
+        return !(header & 1);
     }
 
     template <ByteFlexibleRange Range, security::SecurityPolicy Policy>
     void Inflate<Range, Policy>::decompressFixedBlock(
-        BitIter& iterator,
-        Range& decompressed) const
+        Reader& reader,
+        Output& decompressed) const
     {
-        auto token = fixedCodeDecoder(iterator);
-        for (;token != BlockEnd; token = fixedCodeDecoder(iterator)) {
+        auto token = fixedCodeDecoder(reader);
+        for (;token != BlockEnd; token = fixedCodeDecoder(reader)) {
             if (token < BlockEnd)
-                decompressed.push_back(token);
+                decompressed.push(static_cast<uint8>(token));
             else
-                decompressFixedDistance(token - 257, iterator,
+                decompressFixedDistance(token - 257, reader,
                     decompressed);
         }
     }
@@ -92,34 +220,33 @@ namespace mpgl {
     template <ByteFlexibleRange Range, security::SecurityPolicy Policy>
     void Inflate<Range, Policy>::decompressFixedDistance(
         uint16 token,
-        BitIter& iterator,
-        Range& decompressed) const
+        Reader& reader,
+        Output& decompressed) const
     {
         auto [lenBits, length] = extraLength.at(token);
-        length += readNBits<uint16>(lenBits, iterator);
-        uint16 distanceToken = readRNBits<uint8>(5, iterator);
+        length += static_cast<uint16>(reader.readBits(lenBits));
+        uint16 distanceToken = fixedDistanceDecoder(reader);
         auto [distBits, distance] = distances.at(distanceToken);
-        distance += readNBits<uint32>(distBits, iterator);
-        uint32 offset = decompressed.size() - distance;
-        for (uint32 i = 0; i < length; ++i)
-            decompressed.push_back(decompressed.at(offset + i));
+        distance += static_cast<uint32>(reader.readBits(distBits));
+        decompressed.copyMatch(distance, length);
     }
 
     template <ByteFlexibleRange Range, security::SecurityPolicy Policy>
     void Inflate<Range, Policy>::decompressDynamicBlock(
-        BitIter& iterator,
-        Range& decompressed) const
+        Reader& reader,
+        Output& decompressed) const
     {
-        uint16 literals = 257 + readNBits<uint16>(5, iterator);
-        uint8 distances = 1 + readNBits<uint8>(5, iterator);
-        uint8 codeLength = 4 + readNBits<uint8>(4, iterator);
+        uint16 literals = 257 + static_cast<uint16>(reader.readBits(5));
+        uint8 distances = 1 + static_cast<uint8>(reader.readBits(5));
+        uint8 codeLength = 4 + static_cast<uint8>(reader.readBits(4));
         std::array<uint16, 19> codes{};
         for (uint16 i = 0;i < codeLength; ++i)
-            codes[dynamicCodesOrder[i]] = readNBits<uint8>(3, iterator);
-        Decoder mainDecoder{HuffmanTree<uint16>{codes}};
+            codes[dynamicCodesOrder[i]] = static_cast<uint8>(
+                reader.readBits(3));
+        Decoder mainDecoder{codes};
         auto [treeDecoder, distanceDecoder] = generateDynamicTrees(
-            mainDecoder, literals, distances, iterator);
-        dynamicBlockLoop(treeDecoder, distanceDecoder, iterator,
+            mainDecoder, literals, distances, reader);
+        dynamicBlockLoop(treeDecoder, distanceDecoder, reader,
             decompressed);
     }
 
@@ -130,16 +257,15 @@ namespace mpgl {
                 Decoder const& decoder,
                 uint32 literals,
                 uint32 distances,
-                BitIter& iterator) const
+                Reader& reader) const
     {
         VectorU16 distanceLength, bitLengths = readBitLengths(
-            decoder, literals, distances, iterator);
+            decoder, literals, distances, reader);
         std::copy(bitLengths.begin() + literals, bitLengths.begin()
             + literals + 32, std::back_inserter(distanceLength));
         bitLengths.resize(MaxAlphabetLength);
         std::fill(bitLengths.begin() + literals, bitLengths.end(), 0);
-        return {HuffmanTree<uint16>{bitLengths},
-            HuffmanTree<uint16>{distanceLength}};
+        return {Decoder{bitLengths}, Decoder{distanceLength}};
     }
 
     template <ByteFlexibleRange Range, security::SecurityPolicy Policy>
@@ -148,14 +274,14 @@ namespace mpgl {
             Decoder const& decoder,
             uint32 literals,
             uint32 distances,
-            BitIter& iterator) const
+            Reader& reader) const
     {
         VectorU16 bitLengths;
         bitLengths.reserve(MaxAlphabetLength);
         std::size_t repeater = 0;
         while (bitLengths.size() < literals + distances) {
             auto token = readCodeLength(repeater,
-                iterator, bitLengths, decoder(iterator));
+                reader, bitLengths, decoder(reader));
             while (repeater--)
                 bitLengths.push_back(token);
         }
@@ -166,19 +292,21 @@ namespace mpgl {
     template <ByteFlexibleRange Range, security::SecurityPolicy Policy>
     uint16 Inflate<Range, Policy>::readCodeLength(
         std::size_t& repeater,
-        BitIter& iter,
+        Reader& reader,
         VectorU16 const& bitLengths,
         uint16 token) const
     {
         switch (token) {
             case 16:
-                repeater = 3 + readNBits<uint8>(2, iter);
+                if (bitLengths.empty())
+                    throw InflateDataCorruptionException{};
+                repeater = 3 + static_cast<uint8>(reader.readBits(2));
                 return bitLengths.back();
             case 17:
-                repeater = 3 + readNBits<uint8>(3, iter);
+                repeater = 3 + static_cast<uint8>(reader.readBits(3));
                 return 0;
             case 18:
-                repeater = 11 + readNBits<uint8>(7, iter);
+                repeater = 11 + static_cast<uint8>(reader.readBits(7));
                 return 0;
             default:
                 repeater = 1;
@@ -190,15 +318,15 @@ namespace mpgl {
     void Inflate<Range, Policy>::dynamicBlockLoop(
         Decoder const& mainDecoder,
         Decoder const& distanceDecoder,
-        BitIter& iterator,
-        Range& decompressed) const
+        Reader& reader,
+        Output& decompressed) const
     {
-        auto token = mainDecoder(iterator);
-        for (;token != BlockEnd; token = mainDecoder(iterator)) {
+        auto token = mainDecoder(reader);
+        for (;token != BlockEnd; token = mainDecoder(reader)) {
             if (token < BlockEnd)
-                decompressed.push_back(token);
+                decompressed.push(static_cast<uint8>(token));
             else
-                decompressDynamicDistance(token - 257, iterator,
+                decompressDynamicDistance(token - 257, reader,
                     distanceDecoder, decompressed);
         }
     }
@@ -206,35 +334,31 @@ namespace mpgl {
     template <ByteFlexibleRange Range, security::SecurityPolicy Policy>
     void Inflate<Range, Policy>::decompressDynamicDistance(
         uint16 token,
-        BitIter& iterator,
+        Reader& reader,
         Decoder const& distanceDecoder,
-        Range& decompressed) const
+        Output& decompressed) const
     {
         auto [addbits, addLength] = extraLength.at(token);
-        uint32 length = addLength + readNBits<uint32>(
-            addbits, iterator);
-        uint32 distanceToken = distanceDecoder(iterator);
+        uint32 length = addLength + static_cast<uint32>(
+            reader.readBits(addbits));
+        uint32 distanceToken = distanceDecoder(reader);
         auto [distBits, distLength] = distances.at(distanceToken);
-        uint32 distance = distLength + readNBits<uint32>(
-            distBits, iterator);
-        std::size_t offset = decompressed.size() - distance;
-        for (uint32 i = 0; i < length; ++i)
-            decompressed.push_back(decompressed.at(offset + i));
+        uint32 distance = distLength + static_cast<uint32>(
+            reader.readBits(distBits));
+        decompressed.copyMatch(distance, length);
     }
 
     template <ByteFlexibleRange Range, security::SecurityPolicy Policy>
     void Inflate<Range, Policy>::copyNotCompressed(
-        BitIter& iterator,
-        Range& decompressed) const
+        Reader& reader,
+        Output& decompressed) const
     {
-        iterator.skipToNextByte();
-        uint16 length = readType<uint16, true>(iterator);
-        uint16 complement = readType<uint16, true>(iterator);
+        reader.skipToNextByte();
+        uint16 length = static_cast<uint16>(reader.readBits(16));
+        uint16 complement = static_cast<uint16>(reader.readBits(16));
         if (length != 0xFFFF - complement)
             throw InflateDataCorruptionException{};
-        decompressed.reserve(decompressed.size() + length);
-        for (uint32 i = 0; i < length; ++i)
-            decompressed.push_back(static_cast<char>(iterator.readByte()));
+        reader.copyBytes(length, decompressed.append(length));
     }
 
 }
@@ -0,0 +1,398 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#pragma once
+
+#include <MPGL/Compression/HuffmanLookupTable.hpp>
+#include <MPGL/Compression/DeflateTables.hpp>
+
+#include <optional>
+#include <vector>
+#include <span>
+
+namespace mpgl {
+
+    /**
+     * Resumable decompressor of the DEFLATE compression standard.
+     * Accepts the compressed data in chunks and writes the
+     * decompressed data into the caller-supplied buffers.
+     * Keeps only the 32 KiB sliding window of the previously
+     * decompressed data so the memory usage does not depend
+     * on the size of the stream
+     */
+    class InflateStream : private DeflateTables {
+    public:
+        typedef std::span<char const>                   InputSpan;
+        typedef std::span<char>                         OutputSpan;
+        typedef std::size_t                             size_type;
+
+        /**
+         * The reason why the decompression step has stopped
+         */
+        enum class Status : uint8 {
+            /// The whole input has been consumed
+            NeedsInput,
+            /// The output buffer is full
+            NeedsOutput,
+            /// The end of the DEFLATE stream has been reached
+            Finished
+        };
+
+        /**
+         * The result of the decompression step
+         */
+        struct Result {
+            /// The number of the consumed input bytes
+            size_type                                   consumed;
+            /// The number of the written output bytes
+            size_type                                   produced;
+            /// The reason why the step has stopped
+            Status                                      status;
+        };
+
+        /// The size of the sliding window
+        static constexpr const size_type                WindowSize
+            = 32768;
+
+        /**
+         * Constructs a new Inflate Stream object
+         */
+        explicit InflateStream(void);
+
+        InflateStream(InflateStream const&) = default;
+        InflateStream(InflateStream&&) noexcept = default;
+
+        InflateStream& operator=(InflateStream const&) = default;
+        InflateStream& operator=(InflateStream&&) noexcept = default;
+
+        /**
+         * Decompresses the given chunk of the compressed data
+         * into the given output buffer. Stops when the input is
+         * exhausted, the output is full or the stream has ended.
+         * The bytes following the end of the stream are not
+         * consumed
+         *
+         * @throw InflateDataCorruptionException when the data
+         * is corrupted
+         * @param input the chunk of the compressed data
+         * @param output the output buffer
+         * @return the result of the decompression step
+         */
+        [[nodiscard]] Result operator()(
+            InputSpan input,
+            OutputSpan output);
+
+        /**
+         * Returns whether the end of the stream has been reached
+         *
+         * @return if the end of the stream has been reached
+         */
+        [[nodiscard]] bool isFinished(void) const noexcept
+            { return state == State::Finished; }
+
+        /**
+         * Resets the stream so it can decompress a new
+         * DEFLATE stream
+         */
+        void reset(void) noexcept;
+
+        /**
+         * Destroys the Inflate Stream object
+         */
+        ~InflateStream(void) noexcept = default;
+    private:
+        typedef HuffmanLookupTable<>                    Decoder;
+        typedef std::optional<Decoder>                  OptDecoder;
+        typedef std::pair<uint16, uint8>                Symbol;
+        typedef std::optional<Symbol>                   OptSymbol;
+
+        /**
+         * The part of the stream that is parsed next
+         */
+        enum class State : uint8 {
+            BlockHeader,
+            StoredHeader,
+            StoredCopy,
+            TableHeader,
+            CodeLengthCodes,
+            CodeLengths,
+            Codes,
+            Distance,
+            Copy,
+            Finished
+        };
+
+        /**
+         * The buffers used in the current decompression step
+         */
+        struct Buffers {
+            InputSpan                                   input;
+            OutputSpan                                  output;
+            size_type                                   inputPosition = 0;
+            size_type                                   outputPosition = 0;
+            Status                                      status
+                = Status::NeedsInput;
+
+            /**
+             * Returns the number of the remaining input bytes
+             *
+             * @return the number of the remaining input bytes
+             */
+            [[nodiscard]] size_type inputLeft(void) const noexcept
+                { return input.size() - inputPosition; }
+
+            /**
+             * Returns the number of the remaining output bytes
+             *
+             * @return the number of the remaining output bytes
+             */
+            [[nodiscard]] size_type outputLeft(void) const noexcept
+                { return output.size() - outputPosition; }
+        };
+
+        /**
+         * Parses the next part of the stream
+         *
+         * @param buffers the reference to the step buffers
+         * @return if the decompression can be continued
+         */
+        bool step(Buffers& buffers);
+
+        /**
+         * Parses the header of the block
+         *
+         * @param buffers the reference to the step buffers
+         * @return if the decompression can be continued
+         */
+        bool readBlockHeader(Buffers& buffers);
+
+        /**
+         * Parses the length of the not compressed block
+         *
+         * @param buffers the reference to the step buffers
+         * @return if the decompression can be continued
+         */
+        bool readStoredHeader(Buffers& buffers);
+
+        /**
+         * Copies the not compressed block to the output
+         *
+         * @param buffers the reference to the step buffers
+         * @return if the decompression can be continued
+         */
+        bool copyStored(Buffers& buffers);
+
+        /**
+         * Parses the header of the dynamic block
+         *
+         * @param buffers the reference to the step buffers
+         * @return if the decompression can be continued
+         */
+        bool readTableHeader(Buffers& buffers);
+
+        /**
+         * Parses the code lengths of the code length alphabet
+         *
+         * @param buffers the reference to the step buffers
+         * @return if the decompression can be continued
+         */
+        bool readCodeLengthCodes(Buffers& buffers);
+
+        /**
+         * Parses the code lengths of the dynamic block alphabets
+         *
+         * @param buffers the reference to the step buffers
+         * @return if the decompression can be continued
+         */
+        bool readCodeLengths(Buffers& buffers);
+
+        /**
+         * Decompresses the literals and the match lengths
+         *
+         * @param buffers the reference to the step buffers
+         * @return if the decompression can be continued
+         */
+        bool readCodes(Buffers& buffers);
+
+        /**
+         * Parses the distance of the match
+         *
+         * @param buffers the reference to the step buffers
+         * @return if the decompression can be continued
+         */
+        bool readDistance(Buffers& buffers);
+
+        /**
+         * Copies the match to the output
+         *
+         * @param buffers the reference to the step buffers
+         * @return if the decompression can be continued
+         */
+        bool copyMatch(Buffers& buffers);
+
+        /**
+         * Decompresses the codes as long as the input and the
+         * output buffers are large enough to contain the longest
+         * token. Refills the bit buffer with whole words and
+         * skips the per-bit availability checks
+         *
+         * @param buffers the reference to the step buffers
+         */
+        void fastLoop(Buffers& buffers);
+
+        /**
+         * Builds the dynamic decoders from the parsed code lengths
+         */
+        void buildDynamicDecoders(void);
+
+        /**
+         * Finishes the current block
+         */
+        void endBlock(void) noexcept;
+
+        /**
+         * Moves the next byte of the input to the bit buffer
+         *
+         * @param buffers the reference to the step buffers
+         * @return if the input was not empty
+         */
+        bool pullByte(Buffers& buffers) noexcept;
+
+        /**
+         * Ensures that the bit buffer contains at least the given
+         * number of bits
+         *
+         * @param buffers the reference to the step buffers
+         * @param length the number of needed bits
+         * @return if the bit buffer contains enough bits
+         */
+        bool needBits(Buffers& buffers, uint8 length) noexcept;
+
+        /**
+         * Consumes the given number of bits from the bit buffer
+         *
+         * @param length the number of bits
+         * @return the consumed bits
+         */
+        uint32 takeBits(uint8 length) noexcept;
+
+        /**
+         * Returns the next symbol of the given decoder without
+         * consuming its code. Returns an empty optional when
+         * the input does not contain the whole code
+         *
+         * @throw InflateDataCorruptionException when the code
+         * is unknown
+         * @param buffers the reference to the step buffers
+         * @param decoder the constant reference to the decoder
+         * @return the optional with the symbol and its length
+         */
+        OptSymbol peekSymbol(
+            Buffers& buffers,
+            Decoder const& decoder);
+
+        /**
+         * Returns the byte located at the given distance before
+         * the current output position
+         *
+         * @param buffers the constant reference to the step buffers
+         * @param distance the distance
+         * @return the byte at the given distance
+         */
+        char historyByte(
+            Buffers const& buffers,
+            size_type distance) const noexcept;
+
+        /**
+         * Checks whether the given distance points inside the
+         * already decompressed data
+         *
+         * @throw InflateDataCorruptionException when the distance
+         * is too far
+         * @param buffers the constant reference to the step buffers
+         */
+        void checkDistance(Buffers const& buffers) const;
+
+        /**
+         * Saves the end of the written output inside the
+         * sliding window
+         *
+         * @param produced the constant reference to the written
+         * output
+         */
+        void updateWindow(OutputSpan const& produced) noexcept;
+
+        /**
+         * Returns the decoder of the literals and lengths of
+         * the current block
+         *
+         * @return the decoder of the literals and lengths
+         */
+        Decoder const& lengthDecoder(void) const noexcept
+            { return fixedBlock ? fixedCodeDecoder : *dynamicCodeDecoder; }
+
+        /**
+         * Returns the decoder of the distances of the current
+         * block
+         *
+         * @return the decoder of the distances
+         */
+        Decoder const& distanceDecoder(void) const noexcept {
+            return fixedBlock ? fixedDistanceDecoder
+                : *dynamicDistanceDecoder;
+        }
+
+        typedef std::vector<char>                       Window;
+        typedef std::array<uint8, 19>                   CodeLengthCodes;
+        typedef std::vector<uint8>                      CodeLengths;
+
+        Window                                          window;
+        CodeLengths                                     codeLengths;
+        CodeLengthCodes                                 codeLengthCodes;
+        OptDecoder                                      codeLengthDecoder;
+        OptDecoder                                      dynamicCodeDecoder;
+        OptDecoder                                      dynamicDistanceDecoder;
+        uint64                                          bitBuffer;
+        size_type                                       windowPosition;
+        size_type                                       windowFill;
+        uint32                                          matchDistance;
+        uint16                                          matchLength;
+        uint16                                          storedLength;
+        uint16                                          literalCount;
+        uint16                                          distanceCount;
+        uint16                                          index;
+        uint8                                           bitCount;
+        uint8                                           codeLengthCount;
+        State                                           state;
+        bool                                            finalBlock;
+        bool                                            fixedBlock;
+
+        /// The fixed block decoder
+        static Decoder const                            fixedCodeDecoder;
+        /// The fixed block distance decoder
+        static Decoder const                            fixedDistanceDecoder;
+    };
+
+}
@@ -85,13 +85,16 @@ namespace mpgl {
 
         /**
          * Decompresses the given range and returns the range
-         * containing decompressed data
+         * containing decompressed data. The output is preallocated
+         * with the given expected size of the decompressed data
          *
          * @throw InflateDataCorruptionException when data is
          * corrupted
+         * @param sizeHint the expected size of the decompressed
+         * data
          * @return the decompressed data
          */
-        [[nodiscard]] Range operator()(void);
+        [[nodiscard]] Range operator()(std::size_t sizeHint = 0);
     private:
         typedef PolicyIterRT<Policy, Range>             Iterator;
 
@@ -86,15 +86,16 @@ namespace mpgl {
 
     template <ByteFlexibleRange Range, security::SecurityPolicy Policy>
     [[nodiscard]] Range ZlibDecoder<Range, Policy>::operator() (
-        void)
+        std::size_t sizeHint)
     {
-        auto distance = rangeIterator - getIterator();
-        range.erase(range.begin(), range.begin() + distance);
+        std::size_t offset = rangeIterator - getIterator();
         uint32 checksum = getChecksum();
-        auto decompressed = Inflate{std::move(range), policy}();
-        if (adler32(decompressed) != checksum)
+        auto [decompressed, computed] = Inflate{std::move(range),
+            offset, policy}([](auto data, uint32 sum)
+                { return adler32(data, sum); }, 1, sizeHint);
+        if (computed != checksum)
             throw InflateDataCorruptionException{};
-        return decompressed;
+        return std::move(decompressed);
     }
 
 }
@@ -0,0 +1,72 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#pragma once
+
+#include <MPGL/Compression/Deflate.hpp>
+
+namespace mpgl {
+
+    /**
+     * Compresses the data into the zlib stream. Writes
+     * the zlib header, the DEFLATE stream and the adler32
+     * checksum of the data
+     */
+    class ZlibEncoder {
+    public:
+        typedef Deflate::InputSpan                      InputSpan;
+        typedef Deflate::Buffer                         Buffer;
+        typedef Deflate::CompressionLevel               CompressionLevel;
+
+        /**
+         * Constructs a new Zlib Encoder object
+         *
+         * @param level the compression level
+         */
+        explicit ZlibEncoder(
+            CompressionLevel level = CompressionLevel::Default) noexcept
+                : deflate{level} {}
+
+        /**
+         * Compresses the given data into the zlib stream
+         *
+         * @param input the compressed data
+         * @return the zlib stream
+         */
+        [[nodiscard]] Buffer operator()(InputSpan input) const;
+
+        /**
+         * Returns the compression level
+         *
+         * @return the compression level
+         */
+        [[nodiscard]] CompressionLevel getCompressionLevel(
+            void) const noexcept
+                { return deflate.getCompressionLevel(); }
+    private:
+        Deflate                                         deflate;
+    };
+
+}
@@ -0,0 +1,123 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#pragma once
+
+#include <MPGL/Compression/InflateStream.hpp>
+
+namespace mpgl {
+
+    /**
+     * Resumable decompressor of the zlib streams. Parses
+     * the zlib header and the trailing checksum and decompresses
+     * the data using the DEFLATE stream decompressor. The data
+     * can be supplied in chunks of any size
+     */
+    class ZlibStreamDecoder {
+    public:
+        typedef InflateStream::InputSpan                InputSpan;
+        typedef InflateStream::OutputSpan               OutputSpan;
+        typedef InflateStream::size_type                size_type;
+        typedef InflateStream::Status                   Status;
+        typedef InflateStream::Result                   Result;
+
+        /**
+         * Constructs a new Zlib Stream Decoder object
+         */
+        explicit ZlibStreamDecoder(void) = default;
+
+        /**
+         * Decompresses the given chunk of the compressed data
+         * into the given output buffer. Stops when the input is
+         * exhausted, the output is full or the stream has ended
+         *
+         * @throw InflateInvalidHeaderException when header magic
+         * number is invalid
+         * @throw InflateDataCorruptionException when the data
+         * or its checksum is corrupted
+         * @throw NotSupportedException when the given stream
+         * uses dictionaries
+         * @param input the chunk of the compressed data
+         * @param output the output buffer
+         * @return the result of the decompression step
+         */
+        [[nodiscard]] Result operator()(
+            InputSpan input,
+            OutputSpan output);
+
+        /**
+         * Returns whether the end of the stream has been reached
+         *
+         * @return if the end of the stream has been reached
+         */
+        [[nodiscard]] bool isFinished(void) const noexcept
+            { return state == State::Finished; }
+
+        /**
+         * Resets the decoder so it can decompress a new stream
+         */
+        void reset(void) noexcept;
+
+        /**
+         * Destroys the Zlib Stream Decoder object
+         */
+        ~ZlibStreamDecoder(void) noexcept = default;
+    private:
+        /**
+         * The part of the stream that is parsed next
+         */
+        enum class State : uint8 {
+            Header,
+            Data,
+            Trailer,
+            Finished
+        };
+
+        typedef std::array<char, 4>                     Pending;
+
+        /**
+         * Moves the input bytes to the pending buffer until
+         * it contains the given number of bytes
+         *
+         * @param input the chunk of the compressed data
+         * @param size the expected number of the pending bytes
+         * @return the number of the consumed input bytes
+         */
+        size_type fillPending(InputSpan input, uint8 size) noexcept;
+
+        /**
+         * Parses the zlib header saved in the pending buffer
+         */
+        void parseHeader(void) const;
+
+        InflateStream                                   inflate;
+        Pending                                         pending = {};
+        uint32                                          checksum = 1;
+        uint8                                           pendingSize = 0;
+        State                                           state
+            = State::Header;
+    };
+
+}
@@ -98,6 +98,25 @@ namespace mpgl {
             std::size_t height,
             void const* imagePtr) const noexcept;
 
+        /**
+         * Replaces the part of the texture buffer object with
+         * the given image
+         *
+         * @param format the format of the image
+         * @param x the horizontal offset of the replaced part
+         * @param y the vertical offset of the replaced part
+         * @param width the width of the image
+         * @param height the height of the image
+         * @param imagePtr the constant pointer to the image
+         */
+        void loadSubImage(
+            PixelFormat const& format,
+            std::size_t x,
+            std::size_t y,
+            std::size_t width,
+            std::size_t height,
+            void const* imagePtr) const noexcept;
+
         /**
          * Generates mipmaps
          */
@@ -145,6 +145,22 @@ namespace mpgl {
             uint32 size,
             DataType dataType) const noexcept;
 
+        /**
+         * Draws the given part of the attached vertex buffer and
+         * element buffer on the screen
+         *
+         * @param mode the drawing mode
+         * @param size the number of drawed indices
+         * @param dataType the type of the indices
+         * @param offset the offset of the first drawed index
+         * in bytes
+         */
+        void drawElements(
+            DrawMode mode,
+            uint32 size,
+            DataType dataType,
+            std::size_t offset) const noexcept;
+
         /**
          * Draws instances of the attached vertex buffer on the
          * screen
@@ -0,0 +1,265 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#pragma once
+
+#include <MPGL/Core/Shaders/ShaderProgram.hpp>
+
+#include <string_view>
+
+namespace mpgl {
+
+    /**
+     * Persistent cache of the linked shader programs' binaries.
+     * The binaries are saved in the given directory under the key
+     * computed from the shaders' sources, the driver's vendor,
+     * renderer and version and the supported binary formats, so
+     * changing any of them invalidates the cached binary. The
+     * rejected or corrupted binaries are removed and the program
+     * is compiled from the sources. The cache is disabled when
+     * the directory is empty or the driver does not support
+     * the program binaries
+     *
+     * The cached file layout [all numbers are little-endian]:
+     * magic, version, reserved, key, binary format, binary
+     * length, binary checksum and the binary
+     */
+    class ProgramCache {
+    public:
+        typedef std::string                         Path;
+        typedef std::string_view                    Source;
+        typedef std::vector<uint32>                 Formats;
+        typedef uint64                              Key;
+
+        /**
+         * The description of the driver compiling the programs
+         */
+        struct Driver {
+            /// The vendor of the driver
+            std::string                             vendor;
+            /// The renderer of the driver
+            std::string                             renderer;
+            /// The version of the OpenGL implementation
+            std::string                             version;
+            /// The supported program binary formats
+            Formats                                 formats;
+        };
+
+        /**
+         * Constructs a new Program Cache object. Queries
+         * the driver's description from the OpenGL
+         *
+         * @param directory the directory of the cache, an empty
+         * path disables the cache
+         * @param functions the constant reference to the table
+         * of the OpenGL functions
+         */
+        explicit ProgramCache(
+            Path const& directory = {},
+            ShaderFunctions const& functions
+                = ShaderFunctions::openGL());
+
+        /**
+         * Constructs a new Program Cache object for the given
+         * driver
+         *
+         * @param directory the directory of the cache, an empty
+         * path disables the cache
+         * @param driver the description of the driver
+         * @param functions the constant reference to the table
+         * of the OpenGL functions
+         */
+        explicit ProgramCache(
+            Path const& directory,
+            Driver driver,
+            ShaderFunctions const& functions);
+
+        /**
+         * Returns the program compiled from the given sources.
+         * Loads the program from the cached binary when it is
+         * present and accepted by the driver, otherwise compiles
+         * and links the program and saves its binary
+         *
+         * @throw ShaderCompilationException when there is an error
+         * in shader compilation
+         * @throw ShaderProgramLinkingException when there is an error
+         * in shader program linking
+         * @param name the name of the program
+         * @param vertex the code of the vertex shader ended with 0
+         * @param fragment the code of the fragment shader ended
+         * with 0
+         * @return the linked shader program
+         */
+        [[nodiscard]] ShaderProgram operator() (
+            std::string const& name,
+            Source vertex,
+            Source fragment);
+
+        /**
+         * Loads the program from the cached binary with the given
+         * key. Returns an empty optional and removes the binary
+         * when it is corrupted or rejected by the driver
+         *
+         * @param key the key of the program
+         * @return the optional with the linked shader program
+         */
+        [[nodiscard]] std::optional<ShaderProgram> load(Key key);
+
+        /**
+         * Saves the binary of the given linked program under
+         * the given key
+         *
+         * @param key the key of the program
+         * @param program the constant reference to the program
+         * @return if the binary has been saved
+         */
+        bool store(Key key, ShaderProgram const& program);
+
+        /**
+         * Removes the cached binary with the given key
+         *
+         * @param key the key of the program
+         */
+        void invalidate(Key key) const;
+
+        /**
+         * Removes all of the cached binaries
+         */
+        void clear(void) const;
+
+        /**
+         * Returns the key of the program compiled from the given
+         * sources by the cache's driver
+         *
+         * @param vertex the code of the vertex shader
+         * @param fragment the code of the fragment shader
+         * @return the key of the program
+         */
+        [[nodiscard]] Key makeKey(
+            Source vertex,
+            Source fragment) const noexcept
+                { return makeKey(vertex, fragment, driver); }
+
+        /**
+         * Returns the key of the program compiled from the given
+         * sources by the given driver
+         *
+         * @param vertex the code of the vertex shader
+         * @param fragment the code of the fragment shader
+         * @param driver the constant reference to the driver
+         * @return the key of the program
+         */
+        [[nodiscard]] static Key makeKey(
+            Source vertex,
+            Source fragment,
+            Driver const& driver) noexcept;
+
+        /**
+         * Returns the path of the cached binary with the given key
+         *
+         * @param key the key of the program
+         * @return the path of the cached binary
+         */
+        [[nodiscard]] Path getPath(Key key) const;
+
+        /**
+         * Returns whether the cache is enabled
+         *
+         * @return if the cache is enabled
+         */
+        [[nodiscard]] bool isEnabled(void) const noexcept
+            { return enabled; }
+
+        /**
+         * Returns the constant reference to the driver's
+         * description
+         *
+         * @return the constant reference to the driver's
+         * description
+         */
+        [[nodiscard]] Driver const& getDriver(void) const noexcept
+            { return driver; }
+
+        /**
+         * Returns the constant reference to the cache's directory
+         *
+         * @return the constant reference to the cache's directory
+         */
+        [[nodiscard]] Path const& getDirectory(void) const noexcept
+            { return directory; }
+    private:
+        typedef std::vector<char>                   Buffer;
+
+        /**
+         * Queries the driver's description from the OpenGL.
+         * Returns the description without formats when
+         * the program binaries are not supported
+         *
+         * @param directory the directory of the cache
+         * @param functions the constant reference to the table
+         * of the OpenGL functions
+         * @return the description of the driver
+         */
+        static Driver queryDriver(
+            Path const& directory,
+            ShaderFunctions const& functions);
+
+        /**
+         * Compiles and links the program from the given sources
+         *
+         * @param name the name of the program
+         * @param vertex the code of the vertex shader
+         * @param fragment the code of the fragment shader
+         * @return the linked shader program
+         */
+        ShaderProgram compile(
+            std::string const& name,
+            Source vertex,
+            Source fragment) const;
+
+        /**
+         * Saves the given value in the little-endian order
+         *
+         * @tparam Tp the value's type
+         * @param value the saved value
+         * @param output the reference to the output buffer
+         */
+        template <std::unsigned_integral Tp>
+        static void saveLittleEndian(Tp value, Buffer& output);
+
+        Driver                                      driver;
+        Path                                        directory;
+        ShaderFunctions const*                      functions;
+        bool                                        enabled;
+
+        /// The magic number of the cached binary ["MPSB"]
+        static constexpr const uint32               Magic = 0x4253504D;
+        /// The version of the cached binary's layout
+        static constexpr const uint16               Version = 1;
+        /// The size of the cached binary's header
+        static constexpr const std::size_t          HeaderSize = 28;
+    };
+
+}
@@ -0,0 +1,276 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#pragma once
+
+#include <MPGL/Compression/GZIPStreamDecoder.hpp>
+#include <MPGL/IO/MappedFile.hpp>
+
+#include <string_view>
+
+namespace mpgl {
+
+    /**
+     * Index-only view of the SLGZ shader package. The package is
+     * decompressed only until its header is known, the rest of it
+     * is decompressed on demand into the single buffer that holds
+     * the whole package. The shaders' names and codes are views
+     * into this buffer so no shader is copied
+     *
+     * The package layout [all numbers are little-endian]: gzip
+     * compressed header records [offset, length, zero-terminated
+     * name] ended with the zero offset and followed by the
+     * shaders' codes. The offsets are relative to the end of
+     * the header and start from one
+     */
+    class SLGZPackage {
+    public:
+        typedef std::string                         Path;
+        typedef std::string_view                    Name;
+        typedef std::string_view                    Source;
+        typedef std::size_t                         size_type;
+
+        /**
+         * The header record of the packed shader
+         */
+        struct Entry {
+            /// The name of the shader
+            Name                                    name;
+            /// The offset of the code in the decompressed package
+            size_type                               offset;
+            /// The length of the code
+            size_type                               length;
+        };
+
+        typedef std::vector<Entry>                  Index;
+        typedef Index::const_iterator               const_iterator;
+
+        /**
+         * Opens the SLGZ package and decompresses its header
+         *
+         * @throw SLGZFileCorruptionException when the file does
+         * not exist or is corrupted
+         * @param path the path to the package
+         */
+        explicit SLGZPackage(Path const& path);
+
+        /**
+         * Decompresses the header of the given SLGZ package
+         *
+         * @throw SLGZFileCorruptionException when the package
+         * is corrupted
+         * @param file the rvalue reference to the package content
+         * @param path the path used in the error messages
+         */
+        explicit SLGZPackage(MappedFile&& file, Path const& path);
+
+        SLGZPackage(SLGZPackage const&) = delete;
+        SLGZPackage(SLGZPackage&&) noexcept = default;
+
+        SLGZPackage& operator=(SLGZPackage const&) = delete;
+        SLGZPackage& operator=(SLGZPackage&&) noexcept = default;
+
+        /**
+         * Returns the code of the shader with the given name
+         * or an empty optional when the package does not contain
+         * it. Decompresses the package up to the end of the code
+         *
+         * @throw SLGZFileCorruptionException when the package
+         * is corrupted
+         * @param name the name of the shader
+         * @return the optional with the code of the shader
+         */
+        [[nodiscard]] std::optional<Source> find(Name name);
+
+        /**
+         * Returns the code of the given shader. Decompresses
+         * the package up to the end of the code
+         *
+         * @throw SLGZFileCorruptionException when the package
+         * is corrupted
+         * @param entry the constant reference to the package's
+         * entry
+         * @return the code of the shader
+         */
+        [[nodiscard]] Source operator[] (Entry const& entry);
+
+        /**
+         * Returns the iterator to the entry of the shader with
+         * the given name or the end iterator when the package
+         * does not contain it. Does not decompress the package
+         *
+         * @param name the name of the shader
+         * @return the iterator to the shader's entry
+         */
+        [[nodiscard]] const_iterator lookup(Name name) const noexcept;
+
+        /**
+         * Returns whether the package contains the shader with
+         * the given name
+         *
+         * @param name the name of the shader
+         * @return if the package contains the shader
+         */
+        [[nodiscard]] bool contains(Name name) const noexcept;
+
+        /**
+         * Decompresses the rest of the package and verifies
+         * its checksum
+         *
+         * @throw SLGZFileCorruptionException when the package
+         * is corrupted
+         */
+        void decompress(void);
+
+        /**
+         * Returns whether the whole package has been decompressed
+         *
+         * @return if the whole package has been decompressed
+         */
+        [[nodiscard]] bool isDecompressed(void) const noexcept
+            { return decoder.isFinished(); }
+
+        /**
+         * Returns the number of the decompressed bytes
+         *
+         * @return the number of the decompressed bytes
+         */
+        [[nodiscard]] size_type decompressedSize(void) const noexcept
+            { return produced; }
+
+        /**
+         * Returns the number of the shaders in the package
+         *
+         * @return the number of the shaders
+         */
+        [[nodiscard]] size_type size(void) const noexcept
+            { return index.size(); }
+
+        /**
+         * Returns whether the package is empty
+         *
+         * @return if the package is empty
+         */
+        [[nodiscard]] bool empty(void) const noexcept
+            { return index.empty(); }
+
+        /**
+         * Returns the iterator to the first entry
+         *
+         * @return the iterator to the first entry
+         */
+        [[nodiscard]] const_iterator begin(void) const noexcept
+            { return index.begin(); }
+
+        /**
+         * Returns the iterator past the last entry
+         *
+         * @return the iterator past the last entry
+         */
+        [[nodiscard]] const_iterator end(void) const noexcept
+            { return index.end(); }
+
+        /**
+         * Destroys the SLGZ Package object
+         */
+        ~SLGZPackage(void) noexcept = default;
+    private:
+        typedef std::vector<char>                   Buffer;
+        typedef std::optional<size_type>            OptSize;
+
+        /**
+         * Returns the size of the decompressed package saved
+         * in the gzip trailer
+         *
+         * @throw SLGZFileCorruptionException when the size
+         * exceeds the maximum compression ratio
+         * @return the size of the decompressed package
+         */
+        size_type readSize(void) const;
+
+        /**
+         * Decompresses the package until its header is known
+         * and builds the sorted index
+         *
+         * @throw SLGZFileCorruptionException when the header
+         * is corrupted
+         */
+        void readIndex(void);
+
+        /**
+         * Parses the decompressed part of the header. Returns
+         * the length of the header or an empty optional when
+         * the header is not complete yet
+         *
+         * @return the length of the header
+         */
+        OptSize parseHeader(void);
+
+        /**
+         * Validates the index records, converts their offsets
+         * into the buffer's offsets and sorts them by name
+         *
+         * @throw SLGZFileCorruptionException when the record
+         * exceeds the package
+         * @param headerLength the length of the header
+         */
+        void buildIndex(size_type headerLength);
+
+        /**
+         * Decompresses the package until the given number
+         * of the bytes is decompressed
+         *
+         * @param limit the number of the decompressed bytes
+         */
+        void decompressUntil(size_type limit);
+
+        /**
+         * Performs one decompression step into the given part
+         * of the buffer
+         *
+         * @param output the output buffer
+         * @return the status of the decompression step
+         */
+        GZIPStreamDecoder::Status step(
+            GZIPStreamDecoder::OutputSpan output);
+
+        MappedFile                                  file;
+        Buffer                                      buffer;
+        Index                                       index;
+        GZIPStreamDecoder                           decoder;
+        Path                                        path;
+        size_type                                   consumed = 0;
+        size_type                                   produced = 0;
+
+        /// The number of bytes decompressed at once while the
+        /// header is being read
+        static constexpr const size_type            ChunkSize = 4096;
+        /// The maximum compression ratio of the DEFLATE standard
+        static constexpr const size_type            MaxRatio = 1032;
+        /// The offsets are shifted by one to reserve the zero
+        static constexpr const size_type            OFFSET = 1;
+    };
+
+}
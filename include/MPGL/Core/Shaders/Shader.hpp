@@ -29,7 +29,7 @@
 #include <concepts>
 #include <string>
 
-#include <MPGL/Traits/Types.hpp>
+#include <MPGL/Core/Shaders/ShaderFunctions.hpp>
 
 namespace mpgl {
 
@@ -49,8 +49,13 @@ namespace mpgl {
          * loaded from file or shader cannot be compiled
          * @param shaderPath the constant reference to the string
          * with shader's path
+         * @param functions the constant reference to the table
+         * of the OpenGL functions
          */
-        explicit Shader(std::string shaderPath);
+        explicit Shader(
+            std::string shaderPath,
+            ShaderFunctions const& functions
+                = ShaderFunctions::openGL());
 
         /**
          * Constructs a new Shader object. Loads the shader from
@@ -63,11 +68,16 @@ namespace mpgl {
          * @tparam Range the range's type
          * @param range the universal reference to the range with
          * shader
+         * @param functions the constant reference to the table
+         * of the OpenGL functions
          */
         template <std::ranges::contiguous_range Range>
             requires std::same_as<std::ranges::range_value_t<Range>,
                 char>
-        explicit Shader(Range&& range);
+        explicit Shader(
+            Range&& range,
+            ShaderFunctions const& functions
+                = ShaderFunctions::openGL());
 
         Shader(Shader const& shader) noexcept = delete;
 
@@ -104,6 +114,7 @@ namespace mpgl {
          */
         ~Shader(void) noexcept;
     private:
+        ShaderFunctions const*          functions;
         uint32                          shaderID;
 
         /**
@@ -32,8 +32,11 @@ namespace mpgl {
     template <bool ShaderType>
     template <std::ranges::contiguous_range Range>
         requires std::same_as<std::ranges::range_value_t<Range>, char>
-    Shader<ShaderType>::Shader(Range&& range)
-        : shaderID{glCreateShader(shaderType())}
+    Shader<ShaderType>::Shader(
+        Range&& range,
+        ShaderFunctions const& functions)
+            : functions{&functions},
+            shaderID{functions.createShader(shaderType())}
     {
         if (*(std::ranges::end(range) - 1))
             throw ShaderMissingSentinelException{};
@@ -46,8 +49,8 @@ namespace mpgl {
             char>
     void Shader<ShaderType>::loadShader(Range&& range) {
         const char* codePointer = std::ranges::data(range);
-        glShaderSource(shaderID, 1, &codePointer, nullptr);
-        glCompileShader(shaderID);
+        functions->shaderSource(shaderID, 1, &codePointer, nullptr);
+        functions->compileShader(shaderID);
         verifyCompilationStatus();
     }
 
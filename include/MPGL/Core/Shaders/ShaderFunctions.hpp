@@ -0,0 +1,95 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#pragma once
+
+#include <MPGL/Traits/Types.hpp>
+
+namespace mpgl {
+
+    /**
+     * The table of the OpenGL functions used to compile, link
+     * and cache the shaders. The shaders and the shader programs
+     * call the OpenGL through this table so it can be replaced
+     * with a stub when no OpenGL context is available
+     */
+    struct ShaderFunctions {
+        /// Creates the shader object [glCreateShader]
+        uint32 (*createShader)(uint32 type);
+        /// Sets the source of the shader [glShaderSource]
+        void (*shaderSource)(uint32 shader, int32 count,
+            char const* const* sources, int32 const* lengths);
+        /// Compiles the shader [glCompileShader]
+        void (*compileShader)(uint32 shader);
+        /// Queries the shader parameter [glGetShaderiv]
+        void (*getShaderiv)(uint32 shader, uint32 parameter,
+            int32* value);
+        /// Returns the shader's information log [glGetShaderInfoLog]
+        void (*getShaderInfoLog)(uint32 shader, int32 size,
+            int32* length, char* log);
+        /// Deletes the shader object [glDeleteShader]
+        void (*deleteShader)(uint32 shader);
+        /// Creates the program object [glCreateProgram]
+        uint32 (*createProgram)(void);
+        /// Attaches the shader to the program [glAttachShader]
+        void (*attachShader)(uint32 program, uint32 shader);
+        /// Links the program [glLinkProgram]
+        void (*linkProgram)(uint32 program);
+        /// Queries the program parameter [glGetProgramiv]
+        void (*getProgramiv)(uint32 program, uint32 parameter,
+            int32* value);
+        /// Returns the program's information log [glGetProgramInfoLog]
+        void (*getProgramInfoLog)(uint32 program, int32 size,
+            int32* length, char* log);
+        /// Deletes the program object [glDeleteProgram]
+        void (*deleteProgram)(uint32 program);
+        /// Returns whether the program binaries functions
+        /// are loaded
+        bool (*hasProgramBinary)(void);
+        /// Sets the program parameter [glProgramParameteri]
+        void (*programParameteri)(uint32 program, uint32 parameter,
+            int32 value);
+        /// Returns the program's binary [glGetProgramBinary]
+        void (*getProgramBinary)(uint32 program, int32 size,
+            int32* length, uint32* format, void* binary);
+        /// Loads the program's binary [glProgramBinary]
+        void (*programBinary)(uint32 program, uint32 format,
+            void const* binary, int32 length);
+        /// Queries the integer state [glGetIntegerv]
+        void (*getIntegerv)(uint32 parameter, int32* values);
+        /// Returns the context's string [glGetString]
+        char const* (*getString)(uint32 name);
+
+        /**
+         * Returns the table calling the functions of the current
+         * OpenGL context
+         *
+         * @return the constant reference to the OpenGL table
+         */
+        [[nodiscard]] static ShaderFunctions const&
+            openGL(void) noexcept;
+    };
+
+}
@@ -25,9 +25,11 @@
  */
 #pragma once
 
-#include <MPGL/Core/Shaders/ShaderProgram.hpp>
-#include <MPGL/Core/Shaders/SLGZLoader.hpp>
+#include <MPGL/Core/Shaders/ProgramCache.hpp>
+#include <MPGL/Core/Shaders/SLGZPackage.hpp>
 
+#include <variant>
+#include <memory>
 #include <string>
 #include <vector>
 #include <map>
@@ -35,30 +37,49 @@
 namespace mpgl {
 
     /**
-     * Loads and stores shader programs found in designated
-     * folder
+     * Finds the shader programs in the designated folders and
+     * packages. The programs are compiled and linked on their
+     * first lookup or up front when they are warmed up. The copies
+     * of the library share the found sources and the compiled
+     * programs
      */
     class ShaderLibrary {
     public:
         typedef std::map<std::string, ShaderProgram>    ProgramMap;
         typedef std::string                             Path;
         typedef std::vector<std::string>                Paths;
+        typedef std::vector<std::string>                Names;
 
         /**
-         * Initializes and saves all of the found shader programs.
-         * Raises exception when shaders are invalid
+         * Finds all of the shader programs in the given locations
+         * and compiles the warmed up ones. Raises exception when
+         * shaders are invalid
          *
          * @param locations a constant reference to the vector
          * containing looked directories or slgz packages
+         * @param warmUp a constant reference to the vector
+         * with names of the programs compiled up front
+         * @param cacheDirectory a constant reference to the path
+         * of the program binary cache, an empty path disables
+         * the cache
+         * @param functions the constant reference to the table
+         * of the OpenGL functions used to compile the programs
          * @throw ShaderLibraryInvalidShadersException when there
          * are shaders without pair
          * @throw ShaderCompilationException when there is an error
-         * in shader compilation
+         * in warmed up shader compilation
          * @throw ShaderProgramLinkingException when there is an error
-         * in shader program linking
+         * in warmed up shader program linking
+         * @throw std::out_of_range when there is no shader program
+         * with warmed up name
          * @throw std::filesystem errors during file IO
          */
-        explicit ShaderLibrary(Paths const& locations);
+        explicit ShaderLibrary(
+            Paths const& locations,
+            Names const& warmUp = {},
+            Path const& cacheDirectory = {},
+            ShaderFunctions const& functions
+                = ShaderFunctions::openGL());
 
         using const_iterator = typename ProgramMap::const_iterator;
         using const_reverse_iterator
@@ -66,98 +87,195 @@ namespace mpgl {
 
         /**
          * Returns a constant iterator to the begining of the
-         * shaders map
+         * compiled shaders map
          *
          * @return the constant iterator to the begining of the
-         * shaders map
+         * compiled shaders map
          */
         [[nodiscard]] const_iterator begin(void) const noexcept
-            { return programs.begin(); }
+            { return library->programs.begin(); }
 
         /**
-         * Returns a constant iterator to the end of the shaders map
+         * Returns a constant iterator to the end of the compiled
+         * shaders map
          *
          * @return the constant iterator to the end of the
-         * shaders map
+         * compiled shaders map
          */
         [[nodiscard]] const_iterator end(void) const noexcept
-            { return programs.end(); }
+            { return library->programs.end(); }
 
         /**
          * Returns a constant iterator to the begining of the
-         * shaders map
+         * compiled shaders map
          *
          * @return the constant iterator to the begining of the
-         * shaders map
+         * compiled shaders map
          */
         [[nodiscard]] const_iterator cbegin(void) const noexcept
-            { return programs.begin(); }
+            { return library->programs.begin(); }
 
         /**
-         * Returns a constant iterator to the end of the shaders map
+         * Returns a constant iterator to the end of the compiled
+         * shaders map
          *
          * @return the constant iterator to the end of the
-         * shaders map
+         * compiled shaders map
          */
         [[nodiscard]] const_iterator cend(void) const noexcept
-            { return programs.end(); }
+            { return library->programs.end(); }
 
         /**
          * Returns a constant reverse iterator to the end of the
-         * shaders map
+         * compiled shaders map
          *
          * @return the constant reverse iterator to the end of the
-         * shaders map
+         * compiled shaders map
          */
         [[nodiscard]] const_reverse_iterator rbegin(void) const noexcept
-            { return programs.rbegin(); }
+            { return library->programs.rbegin(); }
 
         /**
          * Returns a constant reverse iterator to the begining of the
-         * shaders map
+         * compiled shaders map
          *
          * @return the constant reverse iterator to the begining of the
-         * shaders map
+         * compiled shaders map
          */
         [[nodiscard]] const_reverse_iterator rend(void) const noexcept
-            { return programs.rend(); }
+            { return library->programs.rend(); }
 
         /**
          * Returns a constant reverse iterator to the end of the
-         * shaders map
+         * compiled shaders map
          *
          * @return the constant reverse iterator to the end of the
-         * shaders map
+         * compiled shaders map
          */
         [[nodiscard]] const_reverse_iterator crbegin(void) const noexcept
-            { return programs.rbegin(); }
+            { return library->programs.rbegin(); }
 
         /**
          * Returns a constant reverse iterator to the begining of the
-         * shaders map
+         * compiled shaders map
          *
          * @return the constant reverse iterator to the begining of the
-         * shaders map
+         * compiled shaders map
          */
         [[nodiscard]] const_reverse_iterator crend(void) const noexcept
-            { return programs.rend(); }
+            { return library->programs.rend(); }
 
         /**
          * Returns a constant reference to the program with the given
-         * name
+         * name. Compiles and links the program on its first lookup
          *
          * @param name the name of the shader program
          * @throw std::out_of_range when there is no shader program
          * with given name
+         * @throw ShaderCompilationException when there is an error
+         * in shader compilation
+         * @throw ShaderProgramLinkingException when there is an error
+         * in shader program linking
          * @return the constant reference to the program
          */
         [[nodiscard]] ShaderProgram const& operator[] (
-            std::string const& name) const
-                { return programs.at(name); }
+            std::string const& name) const;
+
+        /**
+         * Compiles and links the programs with the given names
+         * that have not been compiled yet
+         *
+         * @param names a constant reference to the vector with
+         * names of the shader programs
+         * @throw std::out_of_range when there is no shader program
+         * with given name
+         * @throw ShaderCompilationException when there is an error
+         * in shader compilation
+         * @throw ShaderProgramLinkingException when there is an error
+         * in shader program linking
+         */
+        void warmUp(Names const& names) const;
+
+        /**
+         * Returns whether the library contains the program with
+         * the given name
+         *
+         * @param name the name of the shader program
+         * @return if the library contains the program
+         */
+        [[nodiscard]] bool contains(
+            std::string const& name) const noexcept
+                { return library->sources.contains(name); }
+
+        /**
+         * Returns whether the program with the given name has
+         * been already compiled
+         *
+         * @param name the name of the shader program
+         * @return if the program has been compiled
+         */
+        [[nodiscard]] bool isCompiled(
+            std::string const& name) const noexcept
+                { return library->programs.contains(name); }
     private:
-        using ShaderMap = typename SLGZLoader<>::ShaderMap;
+        /**
+         * The paths to the vertex and fragment shaders' files
+         */
+        struct FileSources {
+            /// The path to the vertex shader
+            Path                                        vertex;
+            /// The path to the fragment shader
+            Path                                        fragment;
+        };
 
-        ProgramMap                                      programs;
+        /**
+         * The vertex and fragment shaders in the SLGZ package
+         */
+        struct PackedSources {
+            /// The index of the package
+            std::size_t                                 package;
+            /// The vertex shader's entry
+            SLGZPackage::Entry                          vertex;
+            /// The fragment shader's entry
+            SLGZPackage::Entry                          fragment;
+        };
+
+        typedef std::variant<FileSources, PackedSources> Sources;
+        typedef std::map<std::string, Sources>          SourceMap;
+        typedef std::vector<SLGZPackage>                Packages;
+
+        /**
+         * The state shared by the copies of the library
+         */
+        struct Library {
+            /// The compiled programs
+            ProgramMap                                  programs;
+            /// The sources of the found programs
+            SourceMap                                   sources;
+            /// The opened SLGZ packages
+            Packages                                    packages;
+            /// The cache of the programs' binaries
+            ProgramCache                                cache;
+        };
+
+        std::shared_ptr<Library>                        library;
+
+        /**
+         * Compiles and links the program with the given sources
+         * or loads it from the program binary cache
+         *
+         * @throw ShaderCompilationException when the shader
+         * cannot be loaded from a file or compiled
+         * @throw ShaderProgramLinkingException when there is an error
+         * in shader program linking
+         * @param name the name of the shader program
+         * @param sources the constant reference to the program's
+         * sources
+         * @return the linked shader program
+         */
+        ShaderProgram compile(
+            std::string const& name,
+            Sources const& sources) const;
 
         /**
          * Returns a vector with shader names
@@ -171,14 +289,14 @@ namespace mpgl {
         /**
          * Returns a vector with shader names
          *
-         * @param path a constant reference to a map with
-         * shaders
+         * @param package a constant reference to the shaders
+         * package
          * @return the vector with shader names
          */
-        Paths getShaderList(ShaderMap const& map) const;
+        Paths getShaderList(SLGZPackage const& package) const;
 
         /**
-         * Loads shaders from the given directory
+         * Finds shaders in the given directory
          *
          * @param path a constant reference to a string with
          * the looked directory path
@@ -186,8 +304,11 @@ namespace mpgl {
         void loadShaderDirectory(Path const& path);
 
         /**
-         * Loads shaders from the given GZLS package
+         * Finds shaders in the given GZLS package
          *
+         * @throw ShaderLibraryInvalidShadersException when there
+         * are shaders without pair or outside of the vertex and
+         * fragment directories
          * @param path a constant reference to a string with
          * the looked GZLS package path
          */
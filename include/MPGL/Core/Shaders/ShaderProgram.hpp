@@ -30,7 +30,10 @@
 #include <MPGL/Traits/Concepts.hpp>
 #include <MPGL/Core/Color.hpp>
 
+#include <optional>
 #include <memory>
+#include <vector>
+#include <span>
 
 namespace mpgl {
 
@@ -44,10 +47,27 @@ namespace mpgl {
      */
     class ShaderProgram {
     public:
+        typedef std::span<char const>       BinarySpan;
+
+        /**
+         * The driver-specific binary of the linked program
+         */
+        struct Binary {
+            /// The format of the binary
+            uint32                          format;
+            /// The binary data
+            std::vector<char>               data;
+        };
+
         /**
          * Constructs a new Shader Program object
+         *
+         * @param functions the constant reference to the table
+         * of the OpenGL functions
          */
-        explicit ShaderProgram(void) noexcept;
+        explicit ShaderProgram(
+            ShaderFunctions const& functions
+                = ShaderFunctions::openGL()) noexcept;
 
         /**
          * Constructs a new Shader Program object from the
@@ -57,10 +77,14 @@ namespace mpgl {
          * shader
          * @param fragment the constant reference to the fragment
          * shader
+         * @param functions the constant reference to the table
+         * of the OpenGL functions
          */
         explicit ShaderProgram(
             VertexShader const& vertex,
-            FragmentShader const& fragment) noexcept;
+            FragmentShader const& fragment,
+            ShaderFunctions const& functions
+                = ShaderFunctions::openGL()) noexcept;
 
         /**
          * Attaches the shader of the given type to the shader program
@@ -81,6 +105,37 @@ namespace mpgl {
          */
         void link(std::string const& programName = {}) const;
 
+        /**
+         * Hints the driver that the program's binary will be
+         * retrieved. Has to be called before linking
+         */
+        void setRetrievable(void) const noexcept;
+
+        /**
+         * Returns the binary of the linked program or an empty
+         * optional when the driver does not provide it
+         *
+         * @return the optional with the program's binary
+         */
+        [[nodiscard]] std::optional<Binary> getBinary(void) const;
+
+        /**
+         * Creates the shader program from the given binary.
+         * Returns an empty optional when the driver rejects
+         * the binary
+         *
+         * @param format the format of the binary
+         * @param binary the span with the binary data
+         * @param functions the constant reference to the table
+         * of the OpenGL functions
+         * @return the optional with the linked shader program
+         */
+        [[nodiscard]] static std::optional<ShaderProgram> fromBinary(
+            uint32 format,
+            BinarySpan binary,
+            ShaderFunctions const& functions
+                = ShaderFunctions::openGL());
+
         /**
          * Returns whether the shader program exist and is linked
          *
@@ -104,6 +159,18 @@ namespace mpgl {
 
         friend class ShaderLocation;
     private:
+        /**
+         * Constructs a new Shader Program object managing
+         * the given OpenGL program
+         *
+         * @param programID the id of the OpenGL program
+         * @param functions the constant reference to the table
+         * of the OpenGL functions
+         */
+        explicit ShaderProgram(
+            uint32 programID,
+            ShaderFunctions const& functions) noexcept;
+
         /**
          * Program called upon shader program id destruction
          */
@@ -111,8 +178,13 @@ namespace mpgl {
         public:
             /**
              * Constructs a new Program Deleter object
+             *
+             * @param functions the constant reference to the table
+             * of the OpenGL functions
              */
-            explicit ProgramDeleter(void) noexcept = default;
+            explicit ProgramDeleter(
+                ShaderFunctions const& functions) noexcept
+                    : functions{&functions} {}
 
             /**
              * Called upon the destruction of the shader program id
@@ -122,6 +194,8 @@ namespace mpgl {
              * @param ptr the pointer with shader program id
              */
             void operator()(uint32* ptr) const noexcept;
+        private:
+            ShaderFunctions const*          functions;
         };
 
         /**
@@ -141,6 +215,7 @@ namespace mpgl {
         bool isLinked(void) const noexcept;
 
         std::shared_ptr<uint32>             shaderProgramID;
+        ShaderFunctions const*              functions;
 
         static uint32                       lastProgramID;
     };
@@ -31,7 +31,7 @@ namespace mpgl {
     void ShaderProgram::attachShader(
         Shader<Type> const& shader) const noexcept
     {
-        glAttachShader(*shaderProgramID, shader.getShader());
+        functions->attachShader(*shaderProgramID, shader.getShader());
     }
 
 }
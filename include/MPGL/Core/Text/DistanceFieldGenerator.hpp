@@ -0,0 +1,148 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#pragma once
+
+#include <MPGL/Core/Text/FontComponents.hpp>
+#include <MPGL/Core/Text/GlyphContour.hpp>
+#include <MPGL/Collections/Bitmap.hpp>
+
+namespace mpgl {
+
+    /**
+     * Generates a signed distance field of a vectorized glyph.
+     * Each pixel holds the distance from its center to the
+     * nearest edge of the outline, mapped so that 128 lies on
+     * the edge, the greater values lie inside the glyph and
+     * the field saturates at the given spread. The bitmap is
+     * surrounded by the margin as wide as the spread
+     */
+    class DistanceFieldGenerator {
+    public:
+        typedef std::size_t                     size_type;
+
+        /**
+         * Constructs a new Distance Field Generator object with
+         * given font data, glyph data, glyph's size and the
+         * spread of the field
+         *
+         * @param mainData the font's data
+         * @param glyph the glyph's data
+         * @param size the size of the glyph
+         * @param spread the distance in pixels at which the field
+         * saturates
+         */
+        explicit DistanceFieldGenerator(
+            FontData const& mainData,
+            GlyphData const& glyph,
+            size_type size,
+            size_type spread);
+
+        /**
+         * Generates the distance field of the glyph
+         *
+         * @return the bitmap containing the distance field
+         */
+        [[nodiscard]] Bitmap operator() (void) const noexcept;
+    private:
+        /**
+         * Represents the straight edge of the flattened outline
+         */
+        struct Edge {
+            Vector2f                            begin;
+            Vector2f                            end;
+        };
+
+        typedef ContourPoints                   Contour;
+        typedef std::vector<Edge>               Edges;
+
+        Edges                                   edges;
+        FontData const&                         mainData;
+        GlyphData const&                        glyph;
+        size_type                               size;
+        size_type                               spread;
+
+        /**
+         * Flattens the glyph's contours into the edges
+         */
+        void separateContours(void);
+
+        /**
+         * Flattens the given contour into the edges. The contour
+         * may begin with the control point
+         *
+         * @param contour the constant reference to the contour
+         */
+        void addContour(Contour const& contour);
+
+        /**
+         * Flattens the quadratic bézier curve into the edges
+         *
+         * @param begin the curve's first vertex
+         * @param control the curve's control point
+         * @param end the curve's last vertex
+         */
+        void addCurve(
+            Vector2f const& begin,
+            Vector2f const& control,
+            Vector2f const& end);
+
+        /**
+         * Maps the point from the font units into the bitmap
+         *
+         * @param position the point in the font units
+         * @return the point in the bitmap
+         */
+        [[nodiscard]] Vector2f remapPoint(
+            Vector2si const& position) const noexcept;
+
+        /**
+         * Returns the signed distance between the given point
+         * and the outline. The distance is positive inside
+         * the glyph
+         *
+         * @param point the constant reference to the point
+         * @return the signed distance
+         */
+        [[nodiscard]] float32 signedDistance(
+            Vector2f const& point) const noexcept;
+
+        /**
+         * Returns the squared distance between the given point
+         * and the edge
+         *
+         * @param edge the constant reference to the edge
+         * @param point the constant reference to the point
+         * @return the squared distance
+         */
+        [[nodiscard]] static float32 squaredDistance(
+            Edge const& edge,
+            Vector2f const& point) noexcept;
+
+        /// The maximal distance between the curve and its edges
+        static constexpr float32                Tolerance = 0.125f;
+    };
+
+}
@@ -106,6 +106,8 @@ namespace mpgl {
         typedef std::vector<std::string>        Files;
         typedef std::map<Type const,
             std::string const>                  TypeMap;
+        typedef std::vector<std::pair<Type,
+            std::string>>                       Selection;
 
         /**
          * Stores the basic font's data. Allows for easy
@@ -124,34 +126,48 @@ namespace mpgl {
         ContainerPtr                            pointer;
 
         /**
-         * Finds the given subfont in the given files and loads
+         * Finds the given subfont in the given files and selects
          * it when it is possible
          *
          * @param files the searched files
          * @param signatures the subfont signature
+         * @param selection the selected subfonts
          * @param type the subfont type signature
          * @param flag the subfont type flag
          */
         void findSubfont(
             Files& files,
             Files& signatures,
+            Selection& selection,
             std::string const& type,
             Type const& flag);
 
         /**
-         * Adds the given subfont to the font collection
+         * Selects the given subfont to be loaded
          *
          * @param position the position of subfont name in files
          * @param files the searched files
          * @param signatures the subfont signature
+         * @param selection the selected subfonts
          * @param flag the subfont type flag
          */
         void addSubfont(
             std::size_t position,
             Files& files,
             Files& signatures,
+            Selection& selection,
             Type const& flag);
 
+        /**
+         * Reads all of the selected subfonts' files at once and
+         * loads the subfonts as soon as their files are read
+         *
+         * @throw TTFLoaderFileCorruptionException when the subfont
+         * file cannot be read or is corrupted
+         * @param selection the selected subfonts
+         */
+        void loadSubfonts(Selection const& selection);
+
         static const TypeMap                typeVector;
     };
 
@@ -27,6 +27,7 @@
 
 #include <MPGL/Core/Text/VectorizedGlyph.hpp>
 
+#include <vector>
 #include <map>
 
 namespace mpgl {
@@ -78,40 +79,89 @@ namespace mpgl {
     };
 
     /**
-     * Provides information about font's kern table
+     * Stores the font's kerning pairs in a flat open addressing
+     * hash table keyed by the pair of glyph indices. The lookup
+     * takes constant time and does not allocate
      */
-    struct KernTable {
-        typedef std::map<uint32, int16> DistanceMap;
+    class Kern {
+    public:
+        typedef std::pair<uint32, int16>        KernPair;
+        typedef std::vector<KernPair>           Pairs;
 
-        DistanceMap                         distance;
-        bool                                axis;
+        /**
+         * Constructs a new empty Kern object
+         */
+        explicit Kern(void) noexcept = default;
 
         /**
-         * Constructs a new Kern Table object. Loads
-         * the kern table from the given iterator
+         * Constructs a new Kern object from the given pairs. The
+         * pairs are keyed by the left glyph index shifted by
+         * 16 bits and summed with the right glyph index. The
+         * distances of the repeated pairs are summed
          *
-         * @tparam Iter the iterator type
-         * @param iter the reference to the iterator object
+         * @param pairs the constant reference to the kerning pairs
          */
-        template <ByteInputIterator Iter>
-        explicit KernTable(Iter& iter);
+        explicit Kern(Pairs const& pairs);
 
         /**
-         * Construct a new empty Kern Table object
+         * Returns the kerning distance between the glyphs with
+         * given indices in the font units. Returns zero if
+         * the pair is not kerned
+         *
+         * @param left the left glyph index
+         * @param right the right glyph index
+         * @return the kerning distance
          */
-        explicit KernTable(void) noexcept = default;
+        [[nodiscard]] int16 operator() (
+            uint16 left,
+            uint16 right) const noexcept;
 
         /**
-         * Sets the kern table axis
+         * Returns the number of kerning pairs
          *
-         * @param coverage the kern table coverage
+         * @return the number of kerning pairs
+         */
+        [[nodiscard]] std::size_t size(void) const noexcept
+            { return count; }
+
+        /**
+         * Returns whether the kern does not contain any pairs
+         *
+         * @return if the kern does not contain any pairs
+         */
+        [[nodiscard]] bool empty(void) const noexcept
+            { return !count; }
+    private:
+        /**
+         * The hash table's slot
          */
-        void setAxis(uint16 const& coverage) noexcept;
+        struct Entry {
+            uint32                          key;
+            int16                           distance;
+        };
+
+        typedef std::vector<Entry>          Entries;
+
+        Entries                             entries;
+        std::size_t                         count = 0;
+        uint32                              mask = 0;
+        uint8                               shift = 0;
+
+        /**
+         * Returns the hash table's slot of the given key
+         *
+         * @param key the pair's key
+         * @return the slot's index
+         */
+        [[nodiscard]] uint32 slot(uint32 key) const noexcept
+            { return (key * HashFactor) >> shift; }
+
+        /// Marks the empty slot. Glyph index 0xFFFF is never valid
+        static constexpr uint32             EmptyKey = 0xFFFFFFFF;
+        /// The fibonacci hashing factor
+        static constexpr uint32             HashFactor = 0x9E3779B1;
     };
 
-    typedef std::vector<KernTable>          Kern;
     typedef std::map<uint16, GlyphData>     GlyphMap;
 
 }
-
-#include <MPGL/Core/Text/FontComponents.tpp>
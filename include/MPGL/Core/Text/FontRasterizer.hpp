@@ -26,17 +26,21 @@
 #pragma once
 
 #include <MPGL/Core/Text/FontComponents.hpp>
-#include <MPGL/Core/Context/Context.hpp>
+#include <MPGL/Core/Text/GlyphContour.hpp>
 #include <MPGL/Collections/Bitmap.hpp>
 
-#include <array>
+#include <vector>
 
 namespace mpgl {
 
     /**
-     * Rasterizes a vectorized glyph into a bitmap object
+     * Rasterizes a vectorized glyph into a bitmap object. Each
+     * pixel receives the exact area of its square covered by
+     * the glyph's outline. The signed areas of the outline's
+     * edges are accumulated per cell in a single pass and then
+     * summed up along the rows, so no supersampling is needed
      */
-    class FontRasterizer : private GraphicalObject {
+    class FontRasterizer {
     public:
         typedef std::size_t                     size_type;
 
@@ -61,52 +65,17 @@ namespace mpgl {
          */
         Bitmap operator() (void) noexcept;
     private:
-        /**
-         * Represents a point on the vectorized glyph. Provides
-         * information whether this point is the control point
-         * of the quadratic bézier curve
-         */
-        struct Point {
-            Vector2f                            position;
-            bool                                onCurve;
-
-            /**
-             * Construct a new Point object with given position
-             * and information whether the point is the control
-             * point
-             *
-             * @param position the point's position
-             * @param onCurve if point is the control point
-             */
-            explicit Point(
-                Vector2f position,
-                bool onCurve) noexcept
-                    : position{position}, onCurve{onCurve} {}
-        };
-
-        typedef VectorizedGlyph::Point          GlyphPoint;
-        typedef std::vector<GlyphPoint>         GlyphContour;
-        typedef std::vector<Point>              Contour;
+        typedef ContourPoints                   Contour;
         typedef std::vector<Contour>            Contours;
-        typedef std::vector<uint8>              PixelRow;
-        typedef std::optional<PixelRow>         CanvaRow;
-        typedef Bitmap::iterator::value_type    BitmapRow;
-        typedef Vector2<uint16>                 Position;
-        typedef Bitmap::pixel                   Pixel;
-
-        typedef void(FontRasterizer::*PixelSetter)(
-            Bitmap& canva, Vector2<uint16> const& position);
+        typedef std::vector<float32>            Accumulator;
+        typedef Vector2<size_type>              Dimensions;
 
         Contours                                contours;
-        Contour                                 primitiveQueue;
-        Position                                lastPosition;
-        Position                                firstConoturPixel;
-        PixelSetter                             pixelSetter;
+        Accumulator                             accumulator;
+        Dimensions                              dimensions;
         size_type                               size;
-        uint8                                   aaCoefficient;
         FontData const&                         mainData;
         GlyphData const&                        glyph;
-        bool                                    ascending;
 
         /**
          * Separates the glyph's contrours
@@ -116,23 +85,11 @@ namespace mpgl {
         void separateContours(GlyphData const& glyph);
 
         /**
-         * Adds a point to the contour
+         * Returns the dimensions of the glyph's bitmap
          *
-         * @param contour the reference to the glyph's contour
-         * @param point the constant reference to the
-         * contour's point
+         * @return the dimensions of the glyph's bitmap
          */
-        void addPoint(
-            Contour& contour,
-            GlyphPoint const& point);
-
-        /**
-         * Prepares a canva on which the glyph is going to be
-         * drawn
-         *
-         * @return the glyph's bitmap
-         */
-        Bitmap prepareCanva(void) const noexcept;
+        Dimensions canvaDimensions(void) const noexcept;
 
         /**
          * Remaps the points into the local system
@@ -145,240 +102,47 @@ namespace mpgl {
             Vector2si const& position) const noexcept;
 
         /**
-         * Draws the glyph's contoures and sets flags on the bitmap
+         * Draws the closed glyph's contour into the accumulator.
+         * The contour may begin with the control point
          *
          * @param contour the constant reference to the
-         * glyph's contoures
-         * @param canva the reference to the glyph's bitmap
-         */
-        void drawContourAndSetFlags(
-            Contour const& contour,
-            Bitmap& canva) noexcept;
-
-        /**
-         * Adds the point to the queue. If there is enough points
-         * then draws the primitive of a deduced type
-         *
-         * @param canva the reference to the glyph's bitmap
-         * @param point the constant reference to the outline's
-         * point
-         */
-        void drawPrimitive(
-            Bitmap& canva,
-            Point const& point) noexcept;
-
-        /**
-         * Draws a line on the glyph's bitmap
-         *
-         * @param canva the reference to the glyph's bitmap
+         * glyph's contour
          */
-        void drawLine(Bitmap& canva) noexcept;
+        void drawContour(Contour const& contour) noexcept;
 
         /**
-         * Draws a quadratic bézier curve on the glyph's bitmap
-         *
-         * @param canva the reference to the glyph's bitmap
-         */
-        void drawBezierCurve(Bitmap& canva) noexcept;
-
-        /**
-         * Returns the number of samples for a quadratic bézier
-         * curve with given vertices
+         * Accumulates the signed area covered by the line
          *
          * @param firstVertex the first vertex position
-         * @param secondVertex the control vertex position
-         * @param thirdVertex the last vertex position
-         * @return the number of samples
-         */
-        std::size_t getBezierSamples(
-            Vector2f const& firstVertex,
-            Vector2f const& secondVertex,
-            Vector2f const& thirdVertex) const noexcept;
-
-        /**
-         * Clears the primitives queue
-         */
-        void clearQueue(void) noexcept;
-
-        /**
-         * Draws a line with respect to the given axis
-         *
-         * @tparam Axis the axis identifier
-         * @param canva the reference to the glyph's bitmap
-         * @param firstVertex the first vertex position
          * @param secondVertex the last vertex position
          */
-        template <bool Axis>
-        void drawLineByAxis(
-            Bitmap& canva,
+        void drawLine(
             Vector2f const& firstVertex,
             Vector2f const& secondVertex) noexcept;
 
         /**
-         * Returns a line drawing function
+         * Flattens the quadratic bézier curve and accumulates
+         * the signed area covered by its segments
          *
-         * @tparam Axis the axis identifier
-         * @param canva the reference to the glyph's bitmap
          * @param firstVertex the first vertex position
-         * @param secondVertex the last vertex position
-         * @return the line drawing functor
+         * @param secondVertex the control vertex position
+         * @param thirdVertex the last vertex position
          */
-        template <bool Axis>
-        auto getLinearFunction(
-            Bitmap& canva,
+        void drawBezierCurve(
             Vector2f const& firstVertex,
-            Vector2f const& secondVertex) noexcept;
-
-        /**
-         * Draws a positive contour with given functor
-         *
-         * @tparam Function the functor type
-         * @param begin the begin of the contour
-         * @param end the end of the contour
-         * @param function the contour drawing functor
-         */
-        template <std::invocable<uint16> Function>
-        void positiveContour(
-            float32 begin,
-            float32 end,
-            Function function) noexcept;
-
-        /**
-         * Draws a negative contour with given functor
-         *
-         * @tparam Function the functor type
-         * @param begin the begin of the contour
-         * @param end the end of the contour
-         * @param function the contour drawing functor
-         */
-        template <std::invocable<uint16> Function>
-        void negativeContour(
-            float32 begin,
-            float32 end,
-            Function function) noexcept;
-
-        /**
-         * Sets the pixel on the glyph's bitmap
-         *
-         * @tparam Axis the axis identifier
-         * @param canva the reference to the glyph's bitmap
-         * @param x the x position
-         * @param y the y position
-         */
-        template <bool Axis>
-        void setCanvaPixel(
-            Bitmap& canva,
-            uint16 x,
-            float32 y) noexcept;
-
-        /**
-         * Returns the rounded coords with respect to the given
-         * axis
-         *
-         * @tparam Axis the axis identifier
-         * @param x the x position
-         * @param y the y position
-         * @return the position vector
-         */
-        template <bool Axis>
-        Vector2<uint16> getCoords(
-            uint16 x,
-            float32 y) const noexcept;
-
-        /**
-         * Corrects when the comparing functor returns true
-         *
-         * @tparam Compare the comparing functor type
-         * @param bitmap the reference to the glyph's bitmap
-         * @param lastPosition the last pixel position
-         * @param position the current pixel positon
-         * @param compare the comparing functor
-         */
-        template <std::relation<uint16, uint16> Compare>
-        void correctWhenTrue(
-            Bitmap& bitmap,
-            Vector2<uint16> const& lastPosition,
-            Vector2<uint16> const& position,
-            Compare compare) noexcept;
-
-        /**
-         * The default pixel setter
-         *
-         * @param canva the reference to the glyph's bitmap
-         * @param position the pixel's position
-         */
-        void defaultPixelSetter(
-            Bitmap& canva,
-            Vector2<uint16> const& position) noexcept;
-
-        /**
-         * The deducing pixel setter [used at the begining
-         * of the contour]
-         *
-         * @param canva the reference to the glyph's bitmap
-         * @param position the pixel's position
-         */
-        void deducingPixelSetter(
-            Bitmap& canva,
-            Vector2<uint16> const& position) noexcept;
-
-        /**
-         * Fills the space between flags on the bitmap
-         *
-         * @param canva the reference to the glyph's bitmap
-         */
-        void fillContour(Bitmap& canva) const noexcept;
-
-        /**
-         * Preforms anti-aliasing on the bitmap
-         *
-         * @param canva the reference to the glyph's bitmap
-         * @return the anti-aliased bitmap
-         */
-        Bitmap performAntiAliasing(
-            Bitmap& canva) const noexcept;
-
-        /**
-         * Anti-aliases a pixel on the bitmap
-         *
-         * @param canva the reference to the glyph's bitmap
-         * @param x the x position
-         * @param y the y position
-         * @return the anti-aliased pixel
-         */
-        Pixel antiAliasePixels(
-            Bitmap const& canva,
-            size_type x,
-            size_type y) const noexcept;
-
-        /**
-         * Rasterizes a bitmap's row
-         *
-         * @param row the reference to the glyph's bitmap row
-         * @return the rasterized line
-         */
-        CanvaRow rasterizeLine(BitmapRow& row) const noexcept;
+            Vector2f const& secondVertex,
+            Vector2f const& thirdVertex) noexcept;
 
         /**
-         * Tries to repair broken pixels on the line
+         * Sums the accumulated areas along the rows and converts
+         * them into the pixels' coverage
          *
-         * @param row the reference to the glyph's bitmap row
-         * @param index the pixel index
+         * @return the bitmap containing rasterized glyph
          */
-        void tryRepairBrokenPixel(
-            BitmapRow& row,
-            size_type index) const noexcept;
+        Bitmap accumulate(void) const noexcept;
 
-        static constexpr const uint8            Hit  = 0xFF;
-        static constexpr const uint8            Flag = 0x0F;
-        static constexpr const uint8            Mask = 0xF0;
+        /// The maximal distance between the curve and its segments [px]
+        static constexpr float32                Tolerance = 0.125f;
     };
 
-    template void FontRasterizer::setCanvaPixel<true>(
-        Bitmap&, uint16, float32);
-    template void FontRasterizer::setCanvaPixel<false>(
-        Bitmap&, uint16, float32);
-
 }
-
-#include <MPGL/Core/Text/FontRasterizer.tpp>
@@ -29,6 +29,7 @@
 #include <MPGL/Core/Textures/Texture.hpp>
 
 #include <optional>
+#include <array>
 
 namespace mpgl {
 
@@ -37,11 +38,13 @@ namespace mpgl {
      */
     struct Glyph {
         typedef std::optional<Texture>          TextureVar;
+        typedef std::array<Vector2f, 2>         TextureCoords;
 
         TextureVar                              texture;
         Vector2u                                dimensions;
         Vector2i                                bearing;
         uint32                                  advance;
+        TextureCoords                           textureCoords;
 
         /**
          * Construct a new Glyph object holding a given texture
@@ -52,15 +55,19 @@ namespace mpgl {
          * @param dimensions the glyph's dimensions
          * @param bearing the glyph's bearing
          * @param advance the glyph's advance
+         * @param textureCoords the lower-left and upper-right
+         * corners of the glyph inside its texture
          */
         explicit Glyph(
             TextureVar const& texture,
             Vector2u const& dimensions,
             Vector2i const& bearing,
-            uint32 advance) noexcept
+            uint32 advance,
+            TextureCoords const& textureCoords = {
+                Vector2f{0.f, 0.f}, Vector2f{1.f, 1.f}}) noexcept
                 : texture{texture},
                 dimensions{dimensions}, bearing{bearing},
-                advance{advance} {}
+                advance{advance}, textureCoords{textureCoords} {}
 
         /**
          * Returns whether a glyph has an outline
@@ -78,7 +85,7 @@ namespace mpgl {
          * @return the reference to the given element
          */
         template <std::size_t Index>
-            requires (Index < 4)
+            requires (Index < 5)
         constexpr auto&& get(void) & noexcept
             { return helper<Index>(*this); }
 
@@ -90,7 +97,7 @@ namespace mpgl {
          * @return the rvalue reference to the given element
          */
         template <std::size_t Index>
-            requires (Index < 4)
+            requires (Index < 5)
         constexpr auto&& get(void) && noexcept
             { return helper<Index>(*this); }
 
@@ -102,7 +109,7 @@ namespace mpgl {
          * @return the constant reference to the given element
          */
         template <std::size_t Index>
-            requires (Index < 4)
+            requires (Index < 5)
         constexpr auto&& get(void) const& noexcept
             { return helper<Index>(*this); }
     private:
@@ -126,7 +133,7 @@ namespace mpgl {
 namespace std {
 
     template <>
-    struct tuple_size<mpgl::Glyph> : integral_constant<size_t, 4> {};
+    struct tuple_size<mpgl::Glyph> : integral_constant<size_t, 5> {};
 
     template <>
     struct tuple_element<0, mpgl::Glyph>
@@ -144,4 +151,8 @@ namespace std {
     struct tuple_element<3, mpgl::Glyph>
         { using type = mpgl::uint32; };
 
+    template <>
+    struct tuple_element<4, mpgl::Glyph>
+        { using type = mpgl::Glyph::TextureCoords; };
+
 }
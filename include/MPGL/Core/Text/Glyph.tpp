@@ -35,8 +35,10 @@ namespace mpgl {
             return std::forward<Base>(base).dimensions;
         else if constexpr (Index == 2)
             return std::forward<Base>(base).bearing;
-        else
+        else if constexpr (Index == 3)
             return std::forward<Base>(base).advance;
+        else
+            return std::forward<Base>(base).textureCoords;
     }
 
 }
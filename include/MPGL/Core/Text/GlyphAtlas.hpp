@@ -0,0 +1,150 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#pragma once
+
+#include <MPGL/Core/Textures/AtlasPacker.hpp>
+#include <MPGL/Core/Text/Glyph.hpp>
+
+namespace mpgl {
+
+    /**
+     * Stores the rasterized glyphs of one subfont's level inside
+     * the shared textures. The glyphs are packed into the pages
+     * and a new page is added when none of the existing ones
+     * can hold the next glyph
+     */
+    class GlyphAtlas {
+    public:
+        typedef Glyph::TextureCoords                TextureCoords;
+        typedef std::size_t                         size_type;
+
+        /**
+         * Contains the texture holding the glyph and the glyph's
+         * texture coordinates inside of it
+         */
+        struct Region {
+            Texture                                 texture;
+            TextureCoords                           coords;
+        };
+
+        /**
+         * Constructs a new empty Glyph Atlas object
+         *
+         * @param pageDimensions the dimensions of the atlas pages
+         */
+        explicit GlyphAtlas(Vector2u const& pageDimensions);
+
+        GlyphAtlas(GlyphAtlas const& atlas) = delete;
+        GlyphAtlas(GlyphAtlas&& atlas) noexcept = default;
+
+        GlyphAtlas& operator=(GlyphAtlas const& atlas) = delete;
+        GlyphAtlas& operator=(GlyphAtlas&& atlas) noexcept = default;
+
+        /**
+         * Copies the given bitmap into the atlas and returns
+         * the region where it has been placed. The bitmap that
+         * is larger than the page gets its own page
+         *
+         * @param bitmap the constant reference to the bitmap
+         * @return the region holding the bitmap
+         */
+        [[nodiscard]] Region insert(Bitmap const& bitmap);
+
+        /**
+         * Returns the number of the atlas pages
+         *
+         * @return the number of the atlas pages
+         */
+        [[nodiscard]] size_type pagesCount(void) const noexcept
+            { return pages.size(); }
+
+        /**
+         * Returns the dimensions of the atlas pages
+         *
+         * @return the dimensions of the atlas pages
+         */
+        [[nodiscard]] Vector2u const& getPageDimensions(
+            void) const noexcept
+                { return pageDimensions; }
+
+        /**
+         * Returns the dimensions of the pages used for
+         * the glyphs with the given size
+         *
+         * @param size the glyph's size
+         * @return the dimensions of the pages
+         */
+        [[nodiscard]] static Vector2u pageDimensionsFor(
+            std::size_t size) noexcept;
+
+        /**
+         * Destroys the Glyph Atlas object
+         */
+        ~GlyphAtlas(void) noexcept = default;
+    private:
+        /**
+         * Contains the page's texture and the packer managing
+         * its free space
+         */
+        struct Page {
+            Texture                                 texture;
+            AtlasPacker                             packer;
+        };
+
+        typedef std::vector<Page>                   Pages;
+
+        /**
+         * Adds a new empty page with the given dimensions
+         *
+         * @param dimensions the dimensions of the page
+         * @return the reference to the added page
+         */
+        Page& addPage(Vector2u const& dimensions);
+
+        /**
+         * Calculates the texture coordinates of the bitmap
+         * placed in the given page
+         *
+         * @param page the constant reference to the page
+         * @param position the bitmap's position in the page
+         * @param bitmap the constant reference to the bitmap
+         * @return the bitmap's texture coordinates
+         */
+        static TextureCoords makeCoords(
+            Page const& page,
+            Vector2u const& position,
+            Bitmap const& bitmap) noexcept;
+
+        Pages                                       pages;
+        Vector2u                                    pageDimensions;
+
+        static constexpr const uint32               Padding = 1;
+        static constexpr const uint32               MinPageSize = 256;
+        static constexpr const uint32               MaxPageSize = 4096;
+        static constexpr const uint32               GlyphsPerSide = 8;
+    };
+
+}
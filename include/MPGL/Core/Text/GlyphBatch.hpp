@@ -0,0 +1,150 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#pragma once
+
+#include <MPGL/Core/Text/GlyphSprite.hpp>
+
+namespace mpgl {
+
+    /**
+     * Draws the collection of glyph sprites using one shared
+     * vertex buffer. The sprites are merged into the runs of
+     * consecutive sprites sharing the same texture and every
+     * run is drawn with a single draw call. The buffer is
+     * rebuilt only after the batch has been invalidated
+     *
+     * @tparam Dim the dimension of the space where the glyphs
+     * are being drawn
+     */
+    template <Dimension Dim>
+    class GlyphBatch {
+    public:
+        typedef GlyphSprite<Dim>                        Sprite;
+        typedef std::vector<Sprite>                     Sprites;
+        typedef typename Sprite::Vertex                 Vertex;
+
+        /**
+         * Constructs a new empty Glyph Batch object
+         */
+        explicit GlyphBatch(void);
+
+        /**
+         * Constructs a new Glyph Batch object with its own
+         * buffers. The batch is rebuilt before the first draw
+         *
+         * @param batch the constant reference to the batch
+         */
+        GlyphBatch(GlyphBatch const& batch);
+
+        GlyphBatch(GlyphBatch&& batch) noexcept = default;
+
+        /**
+         * Marks the batch as outdated. The buffers are
+         * rebuilt before the next draw
+         *
+         * @param batch the constant reference to the batch
+         * @return the reference to this object
+         */
+        GlyphBatch& operator= (GlyphBatch const& batch) noexcept;
+
+        GlyphBatch& operator= (
+            GlyphBatch&& batch) noexcept = default;
+
+        /**
+         * Marks the batch as outdated. The buffers are
+         * rebuilt before the next draw
+         */
+        void invalidate(void) noexcept
+            { isModified = true; }
+
+        /**
+         * Draws the given sprites. Rebuilds the buffers if
+         * the batch has been invalidated
+         *
+         * @param sprites the constant reference to the sprites
+         */
+        void draw(Sprites const& sprites) const noexcept;
+
+        /**
+         * Returns the number of draw calls issued by the last
+         * draw
+         *
+         * @return the number of draw calls
+         */
+        [[nodiscard]] std::size_t drawCalls(void) const noexcept
+            { return runs.size(); }
+
+        /**
+         * Destroys the Glyph Batch object
+         */
+        ~GlyphBatch(void) noexcept = default;
+    private:
+        /**
+         * The range of indices drawn with the same texture
+         */
+        struct Run {
+            /// The texture shared by the sprites in the run
+            Texture                                     texture;
+            /// The offset of the first index in bytes
+            std::size_t                                 offset;
+            /// The number of indices
+            uint32                                      count;
+        };
+
+        typedef std::vector<Run>                        Runs;
+        typedef std::vector<Vertex>                     Vertices;
+        typedef std::vector<uint32>                     Indices;
+
+        VertexArray                                     vertexArray;
+        VertexBuffer                                    vertexBuffer;
+        ElementArrayBuffer                              elementBuffer;
+        mutable Runs                                    runs;
+        mutable bool                                    isModified;
+
+        /**
+         * Initializes inner buffers
+         */
+        void initializeBuffers(void) const noexcept;
+
+        /**
+         * Rebuilds the buffers and the runs from the given
+         * sprites
+         *
+         * @param sprites the constant reference to the sprites
+         */
+        void actualize(Sprites const& sprites) const noexcept;
+
+        static constexpr const std::array<uint32, 6>    SpriteIndices {
+            0, 1, 2, 0, 3, 2};
+    };
+
+    template class GlyphBatch<dim::Dim2>;
+    template class GlyphBatch<dim::Dim3>;
+
+    using GlyphBatch2D = GlyphBatch<dim::Dim2>;
+    using GlyphBatch3D = GlyphBatch<dim::Dim3>;
+
+}
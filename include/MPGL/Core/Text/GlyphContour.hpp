@@ -0,0 +1,72 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#pragma once
+
+#include <MPGL/Mathematics/Tensors/Vector.hpp>
+
+#include <concepts>
+#include <vector>
+
+namespace mpgl {
+
+    /**
+     * Represents a point of the glyph's contour mapped into
+     * the bitmap. Provides information whether this point lies
+     * on the outline or is the control point of the quadratic
+     * bézier curve
+     */
+    struct ContourPoint {
+        Vector2f                                position;
+        bool                                    onCurve;
+    };
+
+    typedef std::vector<ContourPoint>           ContourPoints;
+
+    /**
+     * Splits the closed glyph's contour into the lines and the
+     * quadratic bézier curves. The contour may begin and end
+     * with the control points. The on-curve points implied
+     * between the consecutive control points are inserted,
+     * including the one between the last and the first point
+     *
+     * @tparam LineFn the type of the line callback
+     * @tparam CurveFn the type of the curve callback
+     * @param contour the constant reference to the contour
+     * @param line the callback receiving the line's vertices
+     * @param curve the callback receiving the curve's first,
+     * control and last vertices
+     */
+    template <std::invocable<Vector2f const&, Vector2f const&> LineFn,
+        std::invocable<Vector2f const&, Vector2f const&,
+            Vector2f const&> CurveFn>
+    void walkContour(
+        ContourPoints const& contour,
+        LineFn&& line,
+        CurveFn&& curve);
+
+}
+
+#include <MPGL/Core/Text/GlyphContour.tpp>
@@ -0,0 +1,78 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#pragma once
+
+#include <algorithm>
+#include <optional>
+
+namespace mpgl {
+
+    template <std::invocable<Vector2f const&, Vector2f const&> LineFn,
+        std::invocable<Vector2f const&, Vector2f const&,
+            Vector2f const&> CurveFn>
+    void walkContour(
+        ContourPoints const& contour,
+        LineFn&& line,
+        CurveFn&& curve)
+    {
+        if (contour.empty())
+            return;
+        auto const start = std::ranges::find(contour, true,
+            &ContourPoint::onCurve);
+        /// without the on-curve points the walk begins at the
+        /// implied point between the last and the first point
+        std::size_t const offset = start != contour.end()
+            ? start - contour.begin() : contour.size() - 1;
+        Vector2f const first = start != contour.end()
+            ? start->position
+            : (contour.back().position + contour.front().position)
+                / 2.f;
+        Vector2f last = first;
+        std::optional<Vector2f> control;
+        for (std::size_t i = 1; i <= contour.size(); ++i) {
+            auto const& point = contour[(offset + i) % contour.size()];
+            if (point.onCurve) {
+                if (control)
+                    curve(last, *control, point.position);
+                else
+                    line(last, point.position);
+                last = point.position;
+                control.reset();
+            } else {
+                if (control) {
+                    Vector2f const middle = (*control
+                        + point.position) / 2.f;
+                    curve(last, *control, middle);
+                    last = middle;
+                }
+                control = point.position;
+            }
+        }
+        if (control)
+            curve(last, *control, first);
+    }
+
+}
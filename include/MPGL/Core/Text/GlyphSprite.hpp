@@ -58,6 +58,7 @@ namespace mpgl {
             VertexComponent<"color", Color, DataType::Float32>
         >;
         using Vertices = std::vector<Vertex>;
+        using TextureCoords = std::array<Vector2f, 2>;
 
         /**
          * Constructs a new Glyph Sprite object with given
@@ -80,13 +81,16 @@ namespace mpgl {
          * @param secondVertex the second vertex position
          * @param thirdVertex the third vertex position
          * @param color the sprite's color
+         * @param coords the lower-left and upper-right corners
+         * of the drawn part of the texture
          */
         GlyphSprite(
             Texture const& texture,
             Vector const& firstVertex,
             Vector const& secondVertex,
             Vector const& thirdVertex,
-            Color const& color);
+            Color const& color,
+            TextureCoords const& coords = DefaultCoords);
 
         /**
          * Construct a new rectangular Glyph Sprite object.
@@ -350,14 +354,19 @@ namespace mpgl {
          *
          * @param color the color of the vertices
          * @param positions the vertices positions
+         * @param coords the lower-left and upper-right corners
+         * of the drawn part of the texture
          * @return the vertices vector
          */
         static Vertices makeVertices(
             Color const& color,
-            Positions const& positions = {});
+            Positions const& positions = {},
+            TextureCoords const& coords = DefaultCoords);
 
         static constexpr const Indices                  indices {
             0, 1, 2, 0, 3, 2};
+        static constexpr const TextureCoords            DefaultCoords {
+            Vector2f{0.f, 0.f}, Vector2f{1.f, 1.f}};
     };
 
     template class GlyphSprite<dim::Dim2>;
@@ -25,19 +25,27 @@
  */
 #pragma once
 
+#include <MPGL/Concurrency/Threadpool.hpp>
+#include <MPGL/Core/Text/GlyphAtlas.hpp>
 #include <MPGL/Core/Text/TTFLoader.hpp>
-#include <MPGL/Core/Text/Glyph.hpp>
+
+#include <mutex>
+#include <set>
 
 namespace mpgl {
 
     /**
-     * Contains the kern table and all of the available subfont
-     * glyphs
+     * Contains the kern table and the subfont's glyphs. The glyphs'
+     * outlines are decoded from the font file when they are
+     * requested for the first time
      */
     class Subfont {
     public:
         typedef std::reference_wrapper<Glyph const> GlyphRef;
         typedef std::optional<GlyphRef>             FontGlyph;
+        typedef std::vector<uint16>                 CodePoints;
+        typedef std::vector<uint8>                  Levels;
+        typedef std::vector<std::future<void>>      Futures;
 
         /**
          * Loads the subfont from the given file path
@@ -46,6 +54,17 @@ namespace mpgl {
          */
         explicit Subfont(std::string const& path);
 
+        /**
+         * Loads the subfont from the file's content that has
+         * been already read
+         *
+         * @param path the file path
+         * @param file the rvalue reference to the file's content
+         */
+        explicit Subfont(
+            std::string const& path,
+            MappedFile&& file);
+
         /**
          * Returns an optional with the reference wrapper to
          * the constant glyph with given id number and level.
@@ -73,6 +92,65 @@ namespace mpgl {
          */
         FontGlyph operator() (uint16 number, uint8 level) const;
 
+        /**
+         * Returns an optional with the reference wrapper to
+         * the constant distance field glyph with given id number.
+         * The distance field glyphs are generated once with
+         * the distanceFieldSize size and can be scaled to any
+         * size. If there is no glyph with given id then returns
+         * an empty optional. If the glyph has not been generated
+         * yet than generates one
+         *
+         * @param number the id number of a glyph
+         * @return the optional with the reference wrapper to
+         * the constant glyph
+         */
+        FontGlyph distanceField(uint16 number);
+
+        /**
+         * Returns an optional with the reference wrapper to
+         * the constant distance field glyph with given id number.
+         * If there is no glyph with given id or it has not been
+         * generated yet then returns an empty optional
+         *
+         * @param number the id number of a glyph
+         * @return the optional with the reference wrapper to
+         * the constant glyph
+         */
+        FontGlyph distanceField(uint16 number) const;
+
+        /**
+         * Rasterizes the glyphs with given id numbers and levels
+         * in the background using the threadpool's workers.
+         * The glyphs that have been already rendered or scheduled
+         * and the glyphs that do not exist in the subfont are
+         * skipped. The already rasterized glyphs are committed
+         * before the scheduling. The rasterized
+         * bitmaps are uploaded into the atlases by the
+         * commitPrerendered method or by the first query that
+         * misses a glyph. Returns the futures of the scheduled
+         * tasks which allow to wait until the warm-up is complete
+         *
+         * @param threadpool the reference to the threadpool
+         * @param numbers the constant reference to the glyphs'
+         * id numbers
+         * @param levels the constant reference to the glyphs'
+         * levels
+         * @return the futures of the scheduled tasks
+         */
+        [[nodiscard]] Futures prerender(
+            async::Threadpool& threadpool,
+            CodePoints const& numbers,
+            Levels const& levels);
+
+        /**
+         * Uploads the glyphs rasterized by the background workers
+         * into the atlases and commits them into the glyph maps.
+         * Has to be called on the thread owning the context.
+         * Does not rasterize anything by itself
+         */
+        void commitPrerendered(void);
+
         /**
          * Returns a constant reference to the kern table
          *
@@ -81,16 +159,86 @@ namespace mpgl {
         Kern const& getKern(void) const noexcept
             { return kern; }
 
+        /**
+         * Returns the kerning distance between the glyphs with
+         * given id numbers in the font units. Returns zero if
+         * the pair is not kerned
+         *
+         * @param left the id number of the left glyph
+         * @param right the id number of the right glyph
+         * @return the kerning distance
+         */
+        [[nodiscard]] int16 getKerning(
+            uint16 left,
+            uint16 right) const;
+
         /// The shift base of the subfont
         static constexpr std::size_t                shiftBase = 64;
+        /// The size of the distance field glyphs
+        static constexpr std::size_t                distanceFieldSize = 64;
+        /// The distance at which the distance fields saturate
+        static constexpr std::size_t                distanceFieldSpread = 4;
+        /// The maximal number of glyphs rasterized by one task
+        static constexpr std::size_t                prerenderBatch = 32;
     private:
         typedef std::map<uint16, Glyph>             RasterMap;
         typedef std::map<uint8, RasterMap>          SizeMap;
-        typedef Glyph::TextureVar                   TextureVar;
+        typedef std::map<uint8, GlyphAtlas>         AtlasMap;
+        typedef std::set<uint16>                    PendingSet;
+        typedef std::map<uint8, PendingSet>         PendingMap;
+        typedef std::optional<GlyphAtlas::Region>   RegionVar;
         typedef typename GlyphMap::const_iterator   Iter;
         typedef std::reference_wrapper<
             RasterMap const>                        RasterMapCref;
         typedef std::optional<RasterMapCref>        MapVar;
+        typedef std::optional<Bitmap>               BitmapVar;
+        typedef std::lock_guard<std::mutex>         Guard;
+
+        /**
+         * The glyph rasterized by the background worker that
+         * waits for being uploaded into the atlas
+         */
+        struct PrerenderedGlyph {
+            /// The glyph's id number
+            uint16                                  number;
+            /// The glyph's level
+            uint8                                   level;
+            /// The glyph's bitmap. Empty if glyph has no outline
+            BitmapVar                               bitmap;
+        };
+
+        typedef std::vector<PrerenderedGlyph>       PrerenderedGlyphs;
+
+        /**
+         * The queue shared between the subfont and the background
+         * workers. Outlives the subfont when workers are still
+         * running
+         */
+        struct PrerenderQueue {
+            std::mutex                              mutex;
+            PrerenderedGlyphs                       glyphs;
+        };
+
+        typedef std::shared_ptr<PrerenderQueue>     QueuePtr;
+        typedef std::vector<GlyphData>              GlyphsData;
+
+        /**
+         * Takes the subfont's data from the given TTF loader
+         *
+         * @param loader the rvalue reference to the TTF loader
+         */
+        explicit Subfont(TTFLoader<>&& loader);
+
+        /**
+         * Returns an iterator to the glyph data with given id
+         * number. Decodes the glyph from the font file if it
+         * has not been decoded yet. Returns the end iterator
+         * if there is no glyph with given id
+         *
+         * @param number the id number of a glyph
+         * @return the iterator to the glyph data
+         */
+        Iter findGlyph(uint16 number);
 
         /**
          * Returns a reference to the map containing glyphs with
@@ -124,6 +272,50 @@ namespace mpgl {
          */
         Glyph createGlyph(Iter const& iter, uint8 level);
 
+        /**
+         * Creates glyph from the given constant reference
+         * to the glyph data, glyph's level and its atlas
+         * region
+         *
+         * @param glyphData the constant reference to the glyph
+         * data object
+         * @param level the glyph's level
+         * @param region the constant reference to the optional
+         * with glyph's atlas region
+         * @return the glyph
+         */
+        Glyph makeGlyph(
+            GlyphData const& glyphData,
+            uint8 level,
+            RegionVar const& region) const noexcept;
+
+        /**
+         * Schedules the task rasterizing the given glyphs with
+         * given level in the threadpool
+         *
+         * @param threadpool the reference to the threadpool
+         * @param numbers the rvalue reference to the glyphs'
+         * id numbers
+         * @param glyphs the rvalue reference to the glyphs' data
+         * @param level the glyphs' level
+         * @return the future of the scheduled task
+         */
+        std::future<void> schedulePrerendering(
+            async::Threadpool& threadpool,
+            CodePoints&& numbers,
+            GlyphsData&& glyphs,
+            uint8 level) const;
+
+        /**
+         * Generates the distance field glyph from the given
+         * constant reference to the constant iterator of
+         * the glyph map
+         *
+         * @param iter the glyph map's constant iterator
+         * @return the distance field glyph
+         */
+        Glyph createDistanceField(Iter const& iter);
+
         /**
          * Returns glyph's dimensions
          *
@@ -149,22 +341,40 @@ namespace mpgl {
             std::size_t size) const noexcept;
 
         /**
-         * Renders glyph's texture if there exist the glyph's
-         * outline and returns it inside an optional. Otherwise
-         * returns an empty optional
+         * Returns a reference to the atlas holding glyphs with
+         * given level. If there is no such an atlas then creates
+         * it
+         *
+         * @param level the level of the glyph
+         * @return the reference to the glyph atlas
+         */
+        GlyphAtlas& getAtlas(uint8 level);
+
+        /**
+         * Renders glyph into the level's atlas if there exist
+         * the glyph's outline and returns its region inside
+         * an optional. Otherwise returns an empty optional
          *
          * @param iter the glyph map's constant iterator
-         * @param size the glyph's size
-         * @return the optional with glyph's texture
+         * @param level the glyph's level
+         * @return the optional with glyph's atlas region
          */
-        TextureVar renderTexture(
+        RegionVar renderTexture(
             Iter const& iter,
-            std::size_t size) const;
+            uint8 level);
 
         SizeMap                                     sizeMap;
+        PendingMap                                  pendingMap;
+        AtlasMap                                    atlasMap;
+        RasterMap                                   fieldMap;
+        GlyphAtlas                                  fieldAtlas{
+            GlyphAtlas::pageDimensionsFor(distanceFieldSize)};
+        TTFLoader<>                                 face;
         GlyphMap                                    glyphMap;
         FontData                                    fontData;
         Kern                                        kern;
+        QueuePtr                                    prerendered
+            = std::make_shared<PrerenderQueue>();
     };
 
 }
@@ -28,27 +28,36 @@
 #include <MPGL/Core/Text/FontComponents.hpp>
 #include <MPGL/Utility/Tokens/Security.hpp>
 #include <MPGL/Iterators/SafeIterator.hpp>
-#include <MPGL/IO/FileIO.hpp>
+#include <MPGL/IO/MappedFile.hpp>
 
+#include <string_view>
 #include <variant>
+#include <array>
 
 namespace mpgl {
 
     /**
-     * Reads and parses font data from a TTF format file
+     * Provides access to the font data of a TTF format file.
+     * Parses only the table directory and the character map
+     * when opened and decodes glyphs and their metrics lazily
+     * straight from the mapped file
      *
      * @tparam Policy the scecurity policy used by TTF parser
      */
     template <security::SecurityPolicy Policy = Secured>
     class TTFLoader {
     private:
-        typedef std::string::const_iterator                 BuffIter;
+        typedef MappedFile::const_iterator                  BuffIter;
         typedef PolicyIterIT<Policy, BuffIter>              Iter;
         typedef std::string                                 FileName;
     public:
+        typedef std::optional<GlyphData>                    GlyphVar;
+        typedef std::optional<uint16>                       IndexVar;
+
         /**
-         * Constructs a new TTFLoader object. Loads TTF file from
-         * the given path and parses it
+         * Constructs a new TTFLoader object. Maps TTF file from
+         * the given path and parses its table directory. The glyphs
+         * and their metrics are decoded on demand
          *
          * @param fileName the path to the TTF file
          */
@@ -66,24 +75,30 @@ namespace mpgl {
             FileName const& fileName);
 
         /**
-         * Returns a constant reference to the map of glyph
-         * informations
+         * Constructs a new TTFLoader object. Parses the TTF file's
+         * content that has been already read. The path is used
+         * to identify the file
          *
-         * @return the constant reference to the map of glyph
-         * informations
+         * @param fileName the path to the TTF file
+         * @param file the rvalue reference to the file's content
          */
-        GlyphMap const& getGlyphs(void) const noexcept
-            { return glyphMap; }
+        explicit TTFLoader(
+            FileName const& fileName,
+            MappedFile&& file);
 
         /**
-         * Returns a rvalue reference to the map of glyph
-         * informations
+         * Constructs a new TTFLoader object. Parses the TTF file's
+         * content that has been already read with given policy.
+         * The path is used to identify the file
          *
-         * @return the rvalue reference to the map of glyph
-         * informations
+         * @param policy the policy token
+         * @param fileName the path to the TTF file
+         * @param file the rvalue reference to the file's content
          */
-        GlyphMap&& getGlyphs(void) noexcept
-            { return std::move(glyphMap); }
+        explicit TTFLoader(
+            Policy policy,
+            FileName const& fileName,
+            MappedFile&& file);
 
         /**
          * Returns a constant reference to the font data object
@@ -94,23 +109,65 @@ namespace mpgl {
             { return fontData; }
 
         /**
-         * Returns a constant reference to the kern table
+         * Returns an optional with the index of the glyph mapped
+         * to the given code point. Returns an empty optional if
+         * the font does not map the code point
          *
-         * @return the constant reference to the kern table
+         * @throw TTFLoaderFileCorruptionException when the cmap
+         * table is corrupted
+         * @param codePoint the code point
+         * @return the optional with the glyph's index
          */
-        Kern const& getKern(void) const noexcept
-            { return kernTable; }
+        [[nodiscard]] IndexVar getGlyphIndex(uint32 codePoint) const;
 
         /**
-         * Returns a rvalue reference to the kern table
+         * Decodes the glyph mapped to the given code point.
+         * Returns an empty optional if the font does not map
+         * the code point
          *
-         * @return the rvalue reference to the kern table
+         * @throw TTFLoaderFileCorruptionException when the glyph's
+         * tables are corrupted
+         * @param codePoint the code point
+         * @return the optional with the glyph data object
          */
-        Kern&& getKern(void) noexcept
-            { return std::move(kernTable); }
+        [[nodiscard]] GlyphVar getGlyph(uint32 codePoint) const;
+
+        /**
+         * Compiles the horizontal pairs of the kern table into
+         * the hashed kern. Returns an empty kern if the font
+         * does not contain the kern table
+         *
+         * @throw TTFLoaderFileCorruptionException when the kern
+         * table is corrupted
+         * @return the kern table
+         */
+        [[nodiscard]] Kern getKern(void) const;
     private:
-        typedef std::vector<uint16>             UHalfVec;
-        typedef std::vector<int16>              HalfVec;
+        /**
+         * The tables used by the loader. The values are the indices
+         * in the table directory
+         */
+        enum class Table : uint8 {
+            /// The font header
+            Head                                = 0x00,
+            /// The maximum profile
+            Maxp                                = 0x01,
+            /// The horizontal header
+            Hhea                                = 0x02,
+            /// The horizontal metrics
+            Hmtx                                = 0x03,
+            /// The index to location
+            Loca                                = 0x04,
+            /// The glyphs' outlines
+            Glyf                                = 0x05,
+            /// The character to glyph mapping
+            Cmap                                = 0x06,
+            /// The kerning
+            Kern                                = 0x07
+        };
+
+        /// The number of tables used by the loader
+        static constexpr std::size_t            TablesCount = 8;
 
         /**
          * Provides information about a TTF table
@@ -129,9 +186,9 @@ namespace mpgl {
              */
             explicit TableDirectory(Iter& iter);
 
-            uint32                              checksum;
-            uint32                              offset;
-            uint32                              length;
+            uint32                              checksum = 0;
+            uint32                              offset = 0;
+            uint32                              length = 0;
         };
 
         /**
@@ -154,14 +211,6 @@ namespace mpgl {
                 uint16 advanceWidth,
                 int16 bearing) noexcept;
 
-            /**
-             * Constructs a new Long Hor Matrix object from
-             * the given reference to the iterator
-             *
-             * @param iter the reference to the iterator
-             */
-            explicit LongHorMatrix(Iter& iter);
-
             uint16                              advanceWidth;
             int16                               leftSideBearing;
         };
@@ -189,111 +238,88 @@ namespace mpgl {
         };
 
         /**
-         * Provides information about the subtables provided
-         * by a format 4 subtable
+         * Maps the continuous range of code points into the glyph
+         * indices. Unifies the format 4 segments and the format 12
+         * groups
          */
-        class Format4Subtable {
-        public:
-            /**
-             * Constructs a new Format 4 Subtable object from
-             * the given reference to the iterator and the reference
-             * to the TTFLoader object
-             *
-             * @param iter the reference to the iterator
-             * @param loader the reference to the TTFLoader object
-             */
-            explicit Format4Subtable(
-                Iter& iter,
-                TTFLoader& loader);
-
-            UHalfVec                            endCode;
-            UHalfVec                            startCode;
-            HalfVec                             idDelta;
-            UHalfVec                            idRangeOffsets;
-            Iter                                rangeOffsets;
-        private:
-            /**
-             * Reserves the memory for the given number of segments
-             * in the memory
-             *
-             * @param segCount the number of segments in the table
-             * @return the iota view counting from 0 to the number
-             * of segments
-             */
-            auto reserve(uint16 segCount);
-
+        struct CmapSegment {
+            /// The first code point in the segment
+            uint32                              startCode;
+            /// The last code point in the segment
+            uint32                              endCode;
+            /// The value added to the code point or glyph index
+            uint32                              idDelta;
             /**
-             * Loads the glyphs into the TTF loader's glyph map
-             *
-             * @param loader the reference to the TTFLoader object
-             */
-            void loadGlyphs(TTFLoader& loader);
-
-            /**
-             * Tries to read the glyph into the TTF loader's
-             * glyph map
-             *
-             * @param i the number of start code
-             * @param j the number of end code
-             * @param loader the reference to the TTFLoader object
+             * The file offset of the start code's glyph index
+             * in the glyph index array. Equal to zero when
+             * the indices are computed from the delta only
              */
-            void tryReadGlyph(
-                std::size_t const& i,
-                std::size_t const& j,
-                TTFLoader& loader);
+            uint32                              rangeOffset;
         };
 
-        typedef std::vector<LongHorMatrix>      Metrics;
-        typedef std::string                     Buffer;
-        typedef std::map<Buffer, TableDirectory>
-                                                Tables;
+        typedef std::array<TableDirectory,
+            TablesCount>                        Tables;
+        typedef std::array<std::string_view,
+            TablesCount>                        Tags;
+        typedef std::vector<CmapSegment>        Cmap;
 
-        Buffer                                  buffer;
+        MappedFile                              file;
         FileName                                fileName;
         Tables                                  tables;
-        Metrics                                 metrics;
         LocaTable                               locaTable;
-        Kern                                    kernTable;
-        GlyphMap                                glyphMap;
+        Cmap                                    cmap;
         FontData                                fontData;
         int16                                   indexFormat;
         uint16                                  numGlyphs;
         uint16                                  numberOfHMetrics;
 
+        /// The tags of the tables used by the loader
+        static constexpr Tags                   TableTags{
+            "head", "maxp", "hhea", "hmtx",
+            "loca", "glyf", "cmap", "kern"};
+
         /**
-         * Loads the HEAD table into memory
+         * Returns a constant reference to the directory of
+         * the given table
+         *
+         * @param table the table
+         * @return the constant reference to the table's directory
          */
-        void loadHead(void);
+        TableDirectory const& getTable(Table table) const noexcept
+            { return tables[static_cast<std::size_t>(table)]; }
 
         /**
-         * Loads the MAXP table into memory
+         * Returns the iterator to the begining of the given table
+         *
+         * @param table the table
+         * @return the iterator to the table
          */
-        void loadMaxp(void);
+        Iter getIterator(Table table) const;
 
         /**
-         * Loads the HHEA table into memory
+         * Loads the HEAD table into memory
          */
-        void loadHhea(void);
+        void loadHead(void);
 
         /**
-         * Loads the KERN table into memory
+         * Loads the MAXP table into memory
          */
-        void loadKern(void);
+        void loadMaxp(void);
 
         /**
-         * Loads the CMAP table into memory
+         * Loads the HHEA table into memory
          */
-        void loadCmap(void);
+        void loadHhea(void);
 
         /**
-         * Loads the LOCA table into memory
+         * Prepares the LOCA table for the lazy lookups
          */
         void loadLoca(void);
 
         /**
-         * Loads the HMTX table into memory
+         * Loads the CMAP table's segments into memory
          */
-        void loadHmtx(void);
+        void loadCmap(void);
 
         /**
          * Returns the iterator to the parsed file
@@ -302,6 +328,16 @@ namespace mpgl {
          */
         Iter getIterator(void) const;
 
+        /**
+         * Opens the TTF file with the given path
+         *
+         * @throw TTFLoaderFileCorruptionException when the file
+         * cannot be opened
+         * @param fileName the path to the TTF file
+         * @return the opened file
+         */
+        static MappedFile openFile(FileName const& fileName);
+
         /**
          * Parses TTF file using the given iterator
          *
@@ -310,12 +346,24 @@ namespace mpgl {
         void parseFile(Iter iter);
 
         /**
-         * Parses the TTF file's header
+         * Parses the TTF file's header and fills the table
+         * directory
          *
-         * @param iter
+         * @throw TTFLoaderFileCorruptionException when the file
+         * does not contain one of the required tables
+         * @param iter the reference to the parsed file
          */
         void parseHead(Iter& iter);
 
+        /**
+         * Reads the horizontal metrics of the glyph with
+         * the given id from the HMTX table
+         *
+         * @param index the glyph's id
+         * @return the glyph's horizontal metrics
+         */
+        LongHorMatrix getMetrics(uint16 index) const;
+
         /**
          * Creates the Glyph Data object containing informations
          * about the glyph with the given id
@@ -323,28 +371,59 @@ namespace mpgl {
          * @param index the glyph's id
          * @return the glyph data object holding glyph's data
          */
-        GlyphData createGlyph(uint16 index);
+        GlyphData createGlyph(uint16 index) const;
 
         /**
-         * Loads the CMAP table subtables
+         * Returns the priority of the given cmap subtable. The
+         * unicode full repertoire subtables (format 12) are
+         * preferred over the BMP ones (format 4). Returns zero
+         * if the subtable is not supported
          *
-         * @param iter the reference to the parsed file
-         * @param begin the iterator to the end of the CMAP table
+         * @param record the constant reference to the encoding
+         * record
+         * @param format the subtable's format
+         * @return the subtable's priority
          */
-        void loadCmapSubtables(Iter& iter, Iter const& begin);
+        static uint8 subtablePriority(
+            EncodingRecord const& record,
+            uint16 format) noexcept;
 
         /**
-         * Returns an optional with the offset to the format 4 subtable
-         * on the given platform. Returns an empty optional if
-         * the platform is not supported
+         * Loads the segments of the format 4 subtable
          *
-         * @param record the constant reference to the encoding
-         * record
-         * @return the optional holding offset to the format 4
-         * subtable
+         * @param iter the iterator to the subtable's length
+         * @param offset the subtable's offset in the file
+         */
+        void loadFormat4(Iter iter, uint32 offset);
+
+        /**
+         * Returns whether the kern subtable with the given coverage
+         * contains the horizontal kerning pairs in format 0
+         *
+         * @param coverage the subtable's coverage
+         * @return if the subtable contains the horizontal pairs
+         */
+        static bool isHorizontalKern(uint16 coverage) noexcept;
+
+        /**
+         * Appends the pairs of the format 0 kern subtable to
+         * the given pairs
+         *
+         * @param iter the reference to the iterator to
+         * the subtable's number of pairs
+         * @param pairs the reference to the kerning pairs
+         */
+        static void loadKernPairs(
+            Iter& iter,
+            Kern::Pairs& pairs);
+
+        /**
+         * Loads the groups of the format 12 subtable
+         *
+         * @param iter the iterator to the subtable's reserved
+         * field
          */
-        std::optional<uint32> readPlatform(
-            EncodingRecord const& record);
+        void loadFormat12(Iter iter);
     };
 
     template class TTFLoader<Secured>;
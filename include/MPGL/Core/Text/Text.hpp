@@ -27,7 +27,7 @@
 
 #include <MPGL/Core/Figures/Primitives/Tetragon.hpp>
 #include <MPGL/Core/DrawableCollection.hpp>
-#include <MPGL/Core/Text/GlyphSprite.hpp>
+#include <MPGL/Core/Text/GlyphBatch.hpp>
 #include <MPGL/Core/Vertex/VertexCast.hpp>
 #include <MPGL/Traits/DeriveIf.hpp>
 #include <MPGL/Core/Text/Font.hpp>
@@ -442,6 +442,8 @@ namespace mpgl {
         Style                                   style = Style::Regular;
         /// The modifiers of the text
         Modifiers                               mods = Modifiers::None;
+        /// Whether the text is drawn from the distance fields
+        bool                                    distanceField = false;
     };
 
     /**
@@ -557,6 +559,17 @@ namespace mpgl {
          */
         void setModifiers(Modifiers const& mods);
 
+        /**
+         * Sets whether the text is drawn from the glyphs'
+         * distance fields. The distance field glyphs are generated
+         * once and scaled to any size. Replaces the text's shader
+         * with the one matching the glyphs
+         *
+         * @param distanceField if the text should be drawn from
+         * the distance fields
+         */
+        void setDistanceField(bool distanceField);
+
         /**
          * Sets the text size
          *
@@ -612,6 +625,15 @@ namespace mpgl {
         [[nodiscard]] Modifiers const& getModifiers(void) const noexcept
             { return mods; }
 
+        /**
+         * Returns whether the text is drawn from the glyphs'
+         * distance fields
+         *
+         * @return if the text is drawn from the distance fields
+         */
+        [[nodiscard]] bool isDistanceField(void) const noexcept
+            { return distanceField; }
+
         /**
          * Returns the string handled by the text object
          *
@@ -863,7 +885,7 @@ namespace mpgl {
          * @return the iterator to the begining of the glyph sprites
          */
         [[nodiscard]] iterator begin(void) noexcept
-            { return iterator{glyphs.begin()}; }
+            { batch.invalidate(); return iterator{glyphs.begin()}; }
 
         /**
          * Returns the iterator to the end of the glyph sprites
@@ -871,7 +893,7 @@ namespace mpgl {
          * @return the iterator to the end of the glyph sprites
          */
         [[nodiscard]] iterator end(void) noexcept
-            { return iterator{glyphs.end()}; }
+            { batch.invalidate(); return iterator{glyphs.end()}; }
 
         /**
          * Returns the constant iterator to the begining
@@ -996,6 +1018,8 @@ namespace mpgl {
             = Subfont::shiftBase;
         static constexpr SizeT                      ShiftValue
             = log2N<SizeT, ShiftBase>();
+        static constexpr SizeT                      DistanceFieldSize
+            = Subfont::distanceFieldSize;
         static constexpr uint16_t const             Newline = 10u;
         static constexpr uint16_t const             Tabulator = 9u;
 
@@ -1136,6 +1160,7 @@ namespace mpgl {
         PositionHolder                              positionSpace;
         String                                      text;
         GlyphsVector                                glyphs;
+        GlyphBatch<Dim>                             batch;
         Font                                        font;
         Lines                                       underlines;
         Lines                                       strikethroughs;
@@ -1143,6 +1168,7 @@ namespace mpgl {
         float32                                     textSize;
         Style                                       style;
         Modifiers                                   mods;
+        bool                                        distanceField;
 
         /**
          * Loads the glyphs into the memory
@@ -1196,6 +1222,39 @@ namespace mpgl {
          */
         void loadNewline(void);
 
+        /**
+         * Returns the glyph with the given index from the subfont.
+         * Chooses between the rasterized and the distance field
+         * glyphs
+         *
+         * @param subfont the reference to the subfont object
+         * @param index the glyph index
+         * @param level the projection level
+         * @return the optional with the reference wrapper to
+         * the constant glyph
+         */
+        Subfont::FontGlyph fetchGlyph(
+            Subfont& subfont,
+            uint16 index,
+            uint8 level) const;
+
+        /**
+         * Returns the glyph with the given index from the constant
+         * subfont. Chooses between the rasterized and the distance
+         * field glyphs
+         *
+         * @param subfont the constant reference to the subfont
+         * object
+         * @param index the glyph index
+         * @param level the projection level
+         * @return the optional with the reference wrapper to
+         * the constant glyph
+         */
+        Subfont::FontGlyph fetchGlyph(
+            Subfont const& subfont,
+            uint16 index,
+            uint8 level) const;
+
         /**
          * Returns the dimensions of the glyph
          *
@@ -1301,9 +1360,11 @@ namespace mpgl {
         /**
          * Returns a type of shader used by the text
          *
+         * @param distanceField if the text is drawn from
+         * the distance fields
          * @return the type of shader used by the text
          */
-        static String const shaderType(void);
+        static String const shaderType(bool distanceField);
 
         /**
          * Generates the underline tetragon
@@ -32,16 +32,17 @@
 #include <algorithm>
 #include <iterator>
 #include <variant>
+#include <span>
 
 namespace mpgl {
 
     /**
-     * Provides information about font's loca table
+     * Provides information about font's loca table. The offsets
+     * are decoded on demand from the table's bytes
      */
     class LocaTable {
     public:
-        typedef std::vector<uint16>                 Loca16;
-        typedef std::vector<uint32>                 Loca32;
+        typedef std::span<char const>               Span;
 
         /**
          * Constructs a new Loca Table object
@@ -50,16 +51,16 @@ namespace mpgl {
 
         /**
          * Constructs a new Loca Table object from a given
-         * iterator, index format and number of glyphs
+         * span of the table's bytes, index format and number
+         * of glyphs. The span has to outlive the loca table
          *
-         * @tparam Iter the type of the iterator
-         * @param iter the iterator used to load the loca table
+         * @throw std::out_of_range when the table is too short
+         * @param table the span of the table's bytes
          * @param indexFormat the index format
          * @param numGlyphs the number of glyphs
          */
-        template <ByteInputIterator Iter>
         explicit LocaTable(
-            Iter iter,
+            Span table,
             int16 indexFormat,
             uint16 numGlyphs);
 
@@ -70,9 +71,10 @@ namespace mpgl {
          * @param index the index of the loca
          * @return the loca
          */
-        [[nodiscard]] uint32 operator() (uint16 index) const;
+        [[nodiscard]] uint32 operator() (uint32 index) const;
     private:
-        std::variant<Loca16, Loca32>                locaTable;
+        Span                                        table;
+        bool                                        longOffsets = false;
     };
 
     /**
@@ -396,7 +398,7 @@ namespace mpgl {
         template <ByteInputIterator Iter>
         Glyph parseSubglyph(
             Iter const begin,
-            uint16 offset,
+            uint32 offset,
             LocaTable const& locaTable);
 
         /**
@@ -123,25 +123,6 @@ namespace mpgl {
         }
     }
 
-    template <ByteInputIterator Iter>
-    LocaTable::LocaTable(
-        Iter iter,
-        int16 indexFormat,
-        uint16 numGlyphs)
-    {
-        if (indexFormat) {
-            Loca32 loca;
-            for (uint16 i = 0; i < numGlyphs + 1; ++i)
-                loca.push_back(readType<uint32, true>(iter));
-            locaTable = std::move(loca);
-        } else {
-            Loca16 loca;
-            for (uint16 i = 0; i < numGlyphs + 1; ++i)
-                loca.push_back(readType<uint16, true>(iter));
-            locaTable = std::move(loca);
-        }
-    }
-
     template <ByteInputIterator Iter>
     VectorizedGlyph::Arguments VectorizedGlyph::parseArguments(
         Iter& iter,
@@ -213,7 +194,7 @@ namespace mpgl {
     template <ByteInputIterator Iter>
     VectorizedGlyph::Glyph VectorizedGlyph::parseSubglyph(
         Iter const begin,
-        uint16 offset,
+        uint32 offset,
         LocaTable const& locaTable)
     {
         auto iter = begin + offset;
@@ -0,0 +1,148 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#pragma once
+
+#include <MPGL/Mathematics/Tensors/Vector.hpp>
+
+#include <optional>
+#include <vector>
+
+namespace mpgl {
+
+    /**
+     * Packs rectangles into the fixed-size page using the skyline
+     * bottom-left heuristic. The skyline is the list of segments
+     * covering the width of the page, each rectangle is placed on
+     * the segment where its top edge stays the lowest. Each
+     * rectangle is followed by the given padding so the neighbour
+     * rectangles do not bleed into each other when the page is
+     * sampled with the linear filter
+     */
+    class AtlasPacker {
+    public:
+        typedef std::optional<Vector2u>             OptPosition;
+        typedef std::size_t                         size_type;
+
+        /**
+         * Constructs a new empty Atlas Packer object
+         *
+         * @param dimensions the dimensions of the page
+         * @param padding the number of the empty pixels after
+         * each rectangle
+         */
+        explicit AtlasPacker(
+            Vector2u const& dimensions,
+            uint32 padding = 1);
+
+        /**
+         * Finds the place for the rectangle with the given
+         * dimensions and marks it as occupied. Returns the
+         * position of the rectangle's lower-left corner or
+         * an empty optional when the rectangle does not fit.
+         * The empty rectangles are placed at the origin
+         *
+         * @param dimensions the dimensions of the rectangle
+         * @return the position of the rectangle
+         */
+        [[nodiscard]] OptPosition insert(Vector2u const& dimensions);
+
+        /**
+         * Returns the dimensions of the page
+         *
+         * @return the dimensions of the page
+         */
+        [[nodiscard]] Vector2u const& getDimensions(
+            void) const noexcept
+                { return dimensions; }
+
+        /**
+         * Returns the number of the pixels occupied by the
+         * inserted rectangles and their padding
+         *
+         * @return the occupied area
+         */
+        [[nodiscard]] size_type getUsedArea(void) const noexcept
+            { return usedArea; }
+
+        /**
+         * Removes all of the inserted rectangles
+         */
+        void clear(void);
+    private:
+        /**
+         * The segment of the skyline
+         */
+        struct Segment {
+            /// The position of the segment's left end
+            uint32                                  x;
+            /// The height of the skyline over the segment
+            uint32                                  y;
+            /// The width of the segment
+            uint32                                  width;
+        };
+
+        typedef std::vector<Segment>                Skyline;
+        typedef std::optional<uint32>               OptHeight;
+
+        /**
+         * Returns the height at which the rectangle with
+         * the given dimensions placed at the given segment's
+         * left end lies or an empty optional when it does
+         * not fit in the page
+         *
+         * @param index the index of the segment
+         * @param dimensions the padded dimensions of the rectangle
+         * @return the height of the rectangle's bottom edge
+         */
+        OptHeight fit(
+            size_type index,
+            Vector2u const& dimensions) const noexcept;
+
+        /**
+         * Raises the skyline under the rectangle placed at
+         * the given segment
+         *
+         * @param index the index of the segment
+         * @param position the position of the rectangle
+         * @param dimensions the padded dimensions of the rectangle
+         */
+        void place(
+            size_type index,
+            Vector2u const& position,
+            Vector2u const& dimensions);
+
+        /**
+         * Merges the neighbour segments of the same height
+         */
+        void merge(void);
+
+        Skyline                                     skyline;
+        Vector2u                                    dimensions;
+        size_type                                   usedArea;
+        uint32                                      padding;
+    };
+
+}
@@ -219,6 +219,18 @@ namespace mpgl {
             getTextureBuffer(void) const noexcept
                 { return texturePtr->textureBuffer; }
 
+        /**
+         * Replaces the part of the texture with the given bitmap.
+         * The bitmap has to lie within the texture
+         *
+         * @param bitmap the constant reference to the bitmap
+         * @param position the position of the bitmap's lower-left
+         * corner in the texture
+         */
+        void update(
+            Bitmap const& bitmap,
+            Vector2u const& position) const noexcept;
+
         /**
          * Returns a constant reference to the texture size vector
          *
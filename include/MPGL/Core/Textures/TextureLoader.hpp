@@ -29,6 +29,7 @@
 #include <MPGL/Utility/Tokens/Execution.hpp>
 #include <MPGL/Utility/Tokens/Security.hpp>
 #include <MPGL/Concurrency/Threadpool.hpp>
+#include <MPGL/IO/AsyncFileReader.hpp>
 #include <MPGL/IO/FileIO.hpp>
 
 #include <algorithm>
@@ -166,6 +167,8 @@ namespace mpgl {
          * Construct a new Texture Loader Parallel object.
          * Uses given threadpool reference to load images
          * from given directory and makes textures from them.
+         * The image files are read at once and each image is
+         * decoded as soon as its file has been read
          *
          * @param directory the directory containing image files
          * @param threadpool the threadpool used to load images
@@ -201,6 +204,8 @@ namespace mpgl {
         [[no_unique_address]] SecurityPolicy        securityToken;
 
         void pushTasks(Paths const& paths);
+        void pushTask(std::string const& path,
+            AsyncFileReader::Result&& file);
         void getFuture(ImageFuture& future,
             std::string const& path,
             Exceptions& exceptions);
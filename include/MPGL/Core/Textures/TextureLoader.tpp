@@ -41,11 +41,24 @@ namespace mpgl {
 
     template <security::SecurityPolicy SP>
     void TextureLoaderParallel<SP>::pushTasks(Paths const& paths) {
-        for (auto const& path : paths)
-            imageQueue.emplace_back(path,
-                threadpool.appendTask([path, this]() -> Image {
+        AsyncFileReader{threadpool}(paths, [&](std::size_t index,
+            AsyncFileReader::Result&& file)
+                { pushTask(paths[index], std::move(file)); });
+    }
+
+    template <security::SecurityPolicy SP>
+    void TextureLoaderParallel<SP>::pushTask(
+        std::string const& path,
+        AsyncFileReader::Result&& file)
+    {
+        imageQueue.emplace_back(path, threadpool.appendTask(
+            [path, file = std::move(file), this]() -> Image {
+                // reports either the unsupported format or the error
+                if (!file)
                     return ImageLoader{securityToken, path}.getImage();
-                }));
+                return ImageLoader{securityToken, path,
+                    file->getSpan()}.getImage();
+            }));
     }
 
     template <security::SecurityPolicy SP>
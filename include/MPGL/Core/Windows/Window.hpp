@@ -54,13 +54,16 @@ namespace mpgl {
          * @param eventManager the event manager used by the window
          * @param shaderDirectories a list of paths or slgz packages
          * checked during shader loading phase
+         * @param shaderCache the directory of the shader program
+         * binary cache, an empty path disables the cache
          */
         explicit Window(
             Vector2u const& dimensions,
             String const& title,
             Options const& options = Options{},
             EventManagerPtr eventManager = defaultManager(),
-            Paths const& shaderDirectories = defaultShaderDirs());
+            Paths const& shaderDirectories = defaultShaderDirs(),
+            String const& shaderCache = {});
 
         Window(Window const& window) = delete;
         Window(Window&& window) noexcept = default;
@@ -0,0 +1,67 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#pragma once
+
+#include <MPGL/Exceptions/MPGLException.hpp>
+#include <string>
+
+namespace mpgl {
+
+    /**
+     * Exception indicating that an asset archive cannot be opened
+     * or that its index or one of its entries is corrupted
+     */
+    class AssetArchiveCorruptionException : public MPGLException {
+    public:
+        /**
+         * Constructs a new Asset Archive Corruption Exception
+         * object with given file name
+         *
+         * @param fileName the archive's or entry's name
+         */
+        explicit AssetArchiveCorruptionException(
+            std::string const& fileName) noexcept
+                : message{fileName +
+                    " - asset archive is corrupted"} {}
+
+        /**
+         * Returns the message informing that the given archive
+         * is corrupted
+         *
+         * @return the exception description
+         */
+        [[nodiscard]] const char* what (void) const noexcept final
+            { return message.c_str(); }
+
+        /**
+         * Destroys the Asset Archive Corruption Exception object
+         */
+        ~AssetArchiveCorruptionException(void) noexcept = default;
+    private:
+        std::string                                 message;
+    };
+
+}
@@ -0,0 +1,259 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#pragma once
+
+#include <MPGL/IO/MappedFile.hpp>
+
+#include <string_view>
+
+namespace mpgl {
+
+    /**
+     * Read-only view of the packed asset archive. The archive is
+     * mapped into the memory at once and its entries are found
+     * with the binary search in the sorted name index. The stored
+     * entries are accessed without copying, the deflated ones are
+     * inflated on demand. Each entry is protected by the CRC32
+     * checksum of its content and the index by the checksum
+     * of the index.
+     *
+     * The archive layout [all numbers are little-endian]:
+     * the header [magic, version, entries count, names size,
+     * alignment, index checksum], the index records sorted by
+     * name [offset, stored size, size, name offset, name length,
+     * checksum, method], the names and the entries aligned
+     * to the archive's alignment
+     */
+    class AssetArchive {
+    public:
+        typedef std::string                         Path;
+        typedef std::string_view                    Name;
+        typedef MappedFile::Span                    Span;
+        typedef std::vector<char>                   Buffer;
+        typedef std::size_t                         size_type;
+
+        /**
+         * The method used to store the entry
+         */
+        enum class Method : uint8 {
+            /// The entry is stored without compression
+            Stored,
+            /// The entry is compressed with the deflate
+            Deflate
+        };
+
+        /**
+         * The index record of the archived entry
+         */
+        struct Entry {
+            /// The name of the entry
+            Name                                    name;
+            /// The offset of the entry in the archive
+            uint64                                  offset;
+            /// The number of the bytes occupied in the archive
+            uint64                                  storedSize;
+            /// The size of the entry's content
+            uint64                                  size;
+            /// The CRC32 checksum of the entry's content
+            uint32                                  checksum;
+            /// The method used to store the entry
+            Method                                  method;
+        };
+
+        typedef std::vector<Entry>                  Entries;
+        typedef Entries::const_iterator             iterator;
+        typedef Entries::const_iterator             const_iterator;
+
+        /**
+         * Opens the asset archive with the given path
+         *
+         * @throw AssetArchiveCorruptionException when the archive
+         * cannot be opened or its index is corrupted
+         * @param path the path to the archive
+         */
+        explicit AssetArchive(Path const& path);
+
+        /**
+         * Constructs a new Asset Archive object from the archive's
+         * content that has been already read
+         *
+         * @throw AssetArchiveCorruptionException when the archive's
+         * index is corrupted
+         * @param file the rvalue reference to the archive's content
+         * @param path the path used to identify the archive
+         */
+        explicit AssetArchive(MappedFile&& file, Path const& path);
+
+        AssetArchive(AssetArchive const&) = delete;
+        AssetArchive(AssetArchive&&) noexcept = default;
+
+        AssetArchive& operator=(AssetArchive const&) = delete;
+        AssetArchive& operator=(AssetArchive&&) noexcept = default;
+
+        /**
+         * Returns the iterator to the entry with the given name
+         * or the end iterator when there is no such an entry
+         *
+         * @param name the name of the entry
+         * @return the iterator to the entry
+         */
+        [[nodiscard]] const_iterator find(Name name) const noexcept;
+
+        /**
+         * Returns whether the archive contains the entry with
+         * the given name
+         *
+         * @param name the name of the entry
+         * @return if the archive contains the entry
+         */
+        [[nodiscard]] bool contains(Name name) const noexcept
+            { return find(name) != end(); }
+
+        /**
+         * Returns the span with the content of the stored entry
+         * without copying it. Returns an empty optional when
+         * the entry is compressed. The checksum is not verified
+         *
+         * @param entry the constant reference to the entry
+         * @return the optional with the entry's content
+         */
+        [[nodiscard]] std::optional<Span> view(
+            Entry const& entry) const noexcept;
+
+        /**
+         * Returns the span with the content of the stored entry
+         * with the given name without copying it. Returns an empty
+         * optional when there is no such an entry or when it is
+         * compressed. The checksum is not verified
+         *
+         * @param name the name of the entry
+         * @return the optional with the entry's content
+         */
+        [[nodiscard]] std::optional<Span> view(Name name) const noexcept;
+
+        /**
+         * Returns the entry's content. Inflates the compressed
+         * entries and verifies the checksum
+         *
+         * @throw AssetArchiveCorruptionException when the entry
+         * is corrupted
+         * @param entry the constant reference to the entry
+         * @return the entry's content
+         */
+        [[nodiscard]] Buffer read(Entry const& entry) const;
+
+        /**
+         * Returns the content of the entry with the given name.
+         * Returns an empty optional when there is no such an entry
+         *
+         * @throw AssetArchiveCorruptionException when the entry
+         * is corrupted
+         * @param name the name of the entry
+         * @return the optional with the entry's content
+         */
+        [[nodiscard]] std::optional<Buffer> read(Name name) const;
+
+        /**
+         * Returns whether the entry's content matches its checksum
+         *
+         * @param entry the constant reference to the entry
+         * @return if the entry is intact
+         */
+        [[nodiscard]] bool verify(Entry const& entry) const noexcept;
+
+        /**
+         * Returns the number of the archived entries
+         *
+         * @return the number of the archived entries
+         */
+        [[nodiscard]] size_type size(void) const noexcept
+            { return entries.size(); }
+
+        /**
+         * Returns whether the archive is empty
+         *
+         * @return if the archive is empty
+         */
+        [[nodiscard]] bool empty(void) const noexcept
+            { return entries.empty(); }
+
+        /**
+         * Returns the iterator to the first entry
+         *
+         * @return the iterator to the first entry
+         */
+        [[nodiscard]] const_iterator begin(void) const noexcept
+            { return entries.begin(); }
+
+        /**
+         * Returns the iterator past the last entry
+         *
+         * @return the iterator past the last entry
+         */
+        [[nodiscard]] const_iterator end(void) const noexcept
+            { return entries.end(); }
+
+        /**
+         * Destroys the Asset Archive object
+         */
+        ~AssetArchive(void) noexcept = default;
+
+        /// The archive's magic number ["MPAK"]
+        static constexpr const uint32               Magic = 0x4B41504D;
+        /// The archive's format version
+        static constexpr const uint16               Version = 1;
+        /// The size of the archive's header
+        static constexpr const size_type            HeaderSize = 24;
+        /// The size of the index record
+        static constexpr const size_type            RecordSize = 40;
+        /// The maximum compression ratio of the DEFLATE standard
+        static constexpr const size_type            MaxRatio = 1032;
+    private:
+        /**
+         * Parses and validates the archive's index
+         *
+         * @throw AssetArchiveCorruptionException when the index
+         * is corrupted
+         */
+        void parseIndex(void);
+
+        /**
+         * Returns the span with the entry's bytes in the archive
+         *
+         * @param entry the constant reference to the entry
+         * @return the span with the entry's bytes
+         */
+        [[nodiscard]] Span storedBytes(
+            Entry const& entry) const noexcept
+                { return file.getSpan().subspan(entry.offset,
+                    entry.storedSize); }
+
+        MappedFile                                  file;
+        Entries                                     entries;
+        Path                                        path;
+    };
+
+}
@@ -0,0 +1,178 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#pragma once
+
+#include <MPGL/Compression/Deflate.hpp>
+#include <MPGL/IO/AssetArchive.hpp>
+
+#include <map>
+
+namespace mpgl {
+
+    /**
+     * Builds the asset archive read by the AssetArchive class.
+     * The entries are compressed when they are added, so
+     * the archive can be saved many times
+     */
+    class AssetArchiveWriter {
+    public:
+        typedef AssetArchive::Method                Method;
+        typedef AssetArchive::Buffer                Buffer;
+        typedef AssetArchive::Path                  Path;
+        typedef Deflate::InputSpan                  InputSpan;
+        typedef Deflate::CompressionLevel           CompressionLevel;
+        typedef std::size_t                         size_type;
+
+        /**
+         * Constructs a new Asset Archive Writer object
+         *
+         * @param alignment the alignment of the entries [rounded
+         * up to the power of two]
+         * @param level the compression level of the deflated
+         * entries
+         */
+        explicit AssetArchiveWriter(
+            uint32 alignment = DefaultAlignment,
+            CompressionLevel level = CompressionLevel::Default) noexcept;
+
+        /**
+         * Adds the entry with the given name and content. Replaces
+         * the entry with the same name. The deflated entry is
+         * stored without compression when the compression does not
+         * reduce its size
+         *
+         * @param name the name of the entry
+         * @param content the entry's content
+         * @param method the preferred storing method
+         */
+        void add(
+            std::string const& name,
+            InputSpan content,
+            Method method = Method::Deflate);
+
+        /**
+         * Adds the file with the given path as the entry with
+         * the given name. Returns false when the file cannot
+         * be read
+         *
+         * @param name the name of the entry
+         * @param filePath the path to the file
+         * @param method the preferred storing method
+         * @return if the file has been added
+         */
+        [[nodiscard]] bool addFile(
+            std::string const& name,
+            Path const& filePath,
+            Method method = Method::Deflate);
+
+        /**
+         * Adds all files from the given directory and its
+         * subdirectories. The entries are named after the paths
+         * relative to the directory. The already compressed
+         * formats [images and gzip] are stored without compression
+         *
+         * @param directory the path to the directory
+         * @return the number of the added files
+         */
+        size_type addDirectory(Path const& directory);
+
+        /**
+         * Returns the number of the entries
+         *
+         * @return the number of the entries
+         */
+        [[nodiscard]] size_type size(void) const noexcept
+            { return records.size(); }
+
+        /**
+         * Returns the archive containing all added entries
+         *
+         * @return the archive's content
+         */
+        [[nodiscard]] Buffer operator() (void) const;
+
+        /**
+         * Saves the archive in the file with the given path
+         *
+         * @param filePath the path to the archive
+         * @return if the archive has been saved
+         */
+        [[nodiscard]] bool save(Path const& filePath) const;
+
+        /**
+         * Returns the method suited for the file with the given
+         * path
+         *
+         * @param filePath the path to the file
+         * @return the suitable method
+         */
+        [[nodiscard]] static Method chooseMethod(
+            Path const& filePath);
+
+        /// The default alignment of the entries
+        static constexpr const uint32               DefaultAlignment = 16;
+    private:
+        /**
+         * The entry waiting to be saved
+         */
+        struct Record {
+            /// The entry's bytes stored in the archive
+            Buffer                                  data;
+            /// The size of the entry's content
+            uint64                                  size;
+            /// The CRC32 checksum of the entry's content
+            uint32                                  checksum;
+            /// The method used to store the entry
+            Method                                  method;
+        };
+
+        typedef std::map<std::string, Record>       Records;
+
+        /**
+         * Appends the given value to the output in the
+         * little-endian order
+         *
+         * @tparam Tp the type of the value
+         * @param value the saved value
+         * @param output the reference to the output
+         */
+        template <std::unsigned_integral Tp>
+        static void saveLittleEndian(Tp value, Buffer& output);
+
+        /**
+         * Rounds the given offset up to the entries' alignment
+         *
+         * @param offset the offset in the archive
+         * @return the aligned offset
+         */
+        [[nodiscard]] size_type align(size_type offset) const noexcept;
+
+        Records                                     records;
+        Deflate                                     deflate;
+        uint32                                      alignment;
+    };
+
+}
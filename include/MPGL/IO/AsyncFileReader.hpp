@@ -0,0 +1,156 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#pragma once
+
+#include <MPGL/Concurrency/Threadpool.hpp>
+#include <MPGL/IO/MappedFile.hpp>
+
+#include <functional>
+#include <memory>
+
+namespace mpgl {
+
+    /**
+     * Reads many files at once and delivers their content as soon
+     * as it is read. On Linux the reads are submitted together
+     * through the io_uring interface, so the loading is bounded
+     * by the disk bandwidth instead of the latency of the
+     * consecutive system calls. When the io_uring is unavailable
+     * the files are opened by the tasks of the given threadpool
+     * or one after another when there is no threadpool
+     */
+    class AsyncFileReader {
+    public:
+        typedef std::string                         Path;
+        typedef std::vector<Path>                   Paths;
+        typedef std::size_t                         size_type;
+        typedef std::optional<MappedFile>           Result;
+        typedef std::function<void(size_type,
+            Result&&)>                              Callback;
+
+        /**
+         * Constructs a new Async File Reader object. Reads
+         * the files without the threadpool fallback
+         *
+         * @param queueDepth the maximal number of the reads
+         * submitted at once
+         */
+        explicit AsyncFileReader(uint32 queueDepth = QueueDepth);
+
+        /**
+         * Constructs a new Async File Reader object. Uses the given
+         * threadpool when the io_uring is unavailable
+         *
+         * @param threadpool the reference to the fallback threadpool
+         * @param queueDepth the maximal number of the reads
+         * submitted at once
+         */
+        explicit AsyncFileReader(
+            async::Threadpool& threadpool,
+            uint32 queueDepth = QueueDepth);
+
+        AsyncFileReader(AsyncFileReader const&) = delete;
+
+        /**
+         * Constructs a new Async File Reader object from the given
+         * rvalue reference to the other reader
+         *
+         * @param reader the rvalue reference to the other reader
+         */
+        AsyncFileReader(AsyncFileReader&& reader) noexcept;
+
+        AsyncFileReader& operator=(AsyncFileReader const&) = delete;
+
+        /**
+         * Assigns the given rvalue reference to the other reader
+         *
+         * @param reader the rvalue reference to the other reader
+         * @return the reference to this object
+         */
+        AsyncFileReader& operator=(AsyncFileReader&& reader) noexcept;
+
+        /**
+         * Reads all of the files with the given paths. The callback
+         * is called on the calling thread with the index of the path
+         * and the file's content [or an empty optional when the file
+         * cannot be read] in the order in which the reads complete.
+         * Returns after all files have been delivered. Must not be
+         * called by the task of the fallback threadpool
+         *
+         * @param paths the paths to the files
+         * @param callback the callback receiving the files
+         */
+        void operator() (
+            Paths const& paths,
+            Callback const& callback);
+
+        /**
+         * Returns whether the reads are submitted through
+         * the io_uring
+         *
+         * @return if the reads are submitted through the io_uring
+         */
+        [[nodiscard]] bool isAsynchronous(void) const noexcept
+            { return static_cast<bool>(ring); }
+
+        /**
+         * Destroys the Async File Reader object
+         */
+        ~AsyncFileReader(void) noexcept;
+    private:
+        class Ring;
+
+        typedef std::unique_ptr<Ring>               RingPtr;
+
+        /**
+         * Reads the files using the tasks of the fallback
+         * threadpool
+         *
+         * @param paths the paths to the files
+         * @param callback the callback receiving the files
+         */
+        void readParallel(
+            Paths const& paths,
+            Callback const& callback);
+
+        /**
+         * Reads the files one after another on the calling thread
+         *
+         * @param paths the paths to the files
+         * @param callback the callback receiving the files
+         */
+        static void readSequenced(
+            Paths const& paths,
+            Callback const& callback);
+
+        RingPtr                                     ring;
+        async::Threadpool*                          threadpool;
+
+        /// The default maximal number of the reads submitted at once
+        static constexpr const uint32               QueueDepth = 64;
+    };
+
+}
@@ -0,0 +1,224 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#pragma once
+
+#include <MPGL/Exceptions/BitReaderOutOfRangeException.hpp>
+#include <MPGL/Iterators/SafeIterator.hpp>
+#include <MPGL/Traits/Concepts.hpp>
+
+#include <iterator>
+#include <climits>
+
+namespace mpgl {
+
+    /**
+     * Reads the bits from the underlying byte range. Instead of
+     * fetching one bit per dereference, the reader keeps a 64-bit
+     * buffer that is refilled with whole words and allows to peek
+     * and consume many bits at once. Reading past the end of the
+     * range yields zero bits; consuming them is reported by the
+     * BitReaderOutOfRangeException
+     *
+     * @tparam Iter the iterator type that iterates through
+     * an individual bytes
+     * @tparam Sent the sentinel type of the iterator
+     * @tparam BigEndian indicates if the bits are saved in the
+     * big-endian manner [the most significant bit first]
+     */
+    template <ByteInputIterator Iter,
+        std::sentinel_for<Iter> Sent = Iter,
+        bool BigEndian = false>
+    class BitReader {
+    public:
+        typedef Iter                                iterator_type;
+        typedef Sent                                sentinel_type;
+        typedef uint64                              buffer_type;
+        typedef std::size_t                         size_type;
+
+        /// The maximum number of bits that can be peeked at once
+        static constexpr const uint8                MaxPeekLength
+            = sizeof(buffer_type) * CHAR_BIT - CHAR_BIT;
+
+        /**
+         * Constructs a new bit reader object from the given
+         * iterator and its sentinel
+         *
+         * @param iter the constant reference to the iterator
+         * @param sent the constant reference to the sentinel
+         */
+        constexpr explicit BitReader(
+            iterator_type const& iter,
+            sentinel_type const& sent) noexcept
+                : iter{iter}, sentinel{sent} {}
+
+        /**
+         * Constructs a new bit reader object
+         */
+        constexpr explicit BitReader(void) noexcept = default;
+
+        /**
+         * Returns the given number of the next bits without
+         * consuming them. The length cannot exceed the
+         * MaxPeekLength
+         *
+         * @throw BitReaderOutOfRangeException when the end of
+         * the range has been already passed
+         * @param length the number of bits
+         * @return the next bits
+         */
+        [[nodiscard]] constexpr buffer_type peekBits(uint8 length);
+
+        /**
+         * Consumes the given number of bits. The bits have to
+         * be peeked first
+         *
+         * @param length the number of bits
+         */
+        constexpr void skipBits(uint8 length) noexcept;
+
+        /**
+         * Reads and consumes the given number of bits. The
+         * length cannot exceed the MaxPeekLength
+         *
+         * @throw BitReaderOutOfRangeException when the end of
+         * the range has been already passed
+         * @param length the number of bits
+         * @return the read bits
+         */
+        [[nodiscard]] constexpr buffer_type readBits(uint8 length);
+
+        /**
+         * Reads and consumes one bit
+         *
+         * @throw BitReaderOutOfRangeException when the end of
+         * the range has been already passed
+         * @return the value of the read bit
+         */
+        [[nodiscard]] constexpr bool readBit(void)
+            { return readBits(1); }
+
+        /**
+         * Jumps to the begining of the next byte. Does nothing
+         * when the reader is already aligned to the byte
+         */
+        constexpr void skipToNextByte(void) noexcept
+            { skipBits(bufferLength % CHAR_BIT); }
+
+        /**
+         * Copies the given number of the bytes to the given
+         * output iterator. The reader has to be aligned to the
+         * byte. The bytes are copied in bulk when possible
+         *
+         * @throw BitReaderOutOfRangeException when the range
+         * does not contain enough bytes
+         * @tparam OutputIter the output iterator type
+         * @param count the number of copied bytes
+         * @param output the output iterator
+         * @return the output iterator past the last copied byte
+         */
+        template <std::output_iterator<char> OutputIter>
+        constexpr OutputIter copyBytes(
+            size_type count,
+            OutputIter output);
+
+        /**
+         * Returns whether the reader has consumed more bits than
+         * the underlying range contains
+         *
+         * @return if the reader has passed the end of the range
+         */
+        [[nodiscard]] constexpr bool isOverrun(void) const noexcept
+            { return overrun * CHAR_BIT > bufferLength; }
+
+        /**
+         * Returns an iterator to the first byte that has not
+         * been consumed yet. When the reader is not aligned
+         * to the byte, the partially consumed byte is skipped
+         *
+         * @return the iterator to the first not consumed byte
+         */
+        [[nodiscard]] constexpr iterator_type getIter(
+            void) const noexcept
+                requires std::bidirectional_iterator<Iter>;
+    private:
+        /**
+         * Refills the buffer so it contains at least MaxPeekLength
+         * bits. Pads the buffer with zeros after the end of
+         * the range
+         *
+         * @throw BitReaderOutOfRangeException when the end of
+         * the range has been already passed
+         */
+        constexpr void refill(void);
+
+        /**
+         * Refills the buffer with the one word loaded at once.
+         * Used when the underlying range is contiguous and at
+         * least one word remains. The bounds of the safe
+         * iterators are checked once per word
+         *
+         * @throw SafeIteratorOutOfRangeException when the word
+         * exceeds the safe range
+         */
+        constexpr void refillWord(void)
+            requires (UncheckedContiguousIterator<Iter>
+                && std::sized_sentinel_for<Sent, Iter>);
+
+        /**
+         * Appends the given byte at the end of the buffer
+         *
+         * @param byte the appended byte
+         */
+        constexpr void appendByte(uint8 byte) noexcept;
+
+        iterator_type                               iter;
+        sentinel_type                               sentinel;
+        buffer_type                                 buffer = 0;
+        uint8                                       bufferLength = 0;
+        uint8                                       overrun = 0;
+    };
+
+    /**
+     * Reader returning the bits in the little endian manner
+     *
+     * @tparam Iter the iterator type
+     * @tparam Sent the sentinel type of the iterator
+     */
+    template <ByteInputIterator Iter, std::sentinel_for<Iter> Sent = Iter>
+    using LittleEndianBitReader = BitReader<Iter, Sent, false>;
+
+    /**
+     * Reader returning the bits in the big endian manner
+     *
+     * @tparam Iter the iterator type
+     * @tparam Sent the sentinel type of the iterator
+     */
+    template <ByteInputIterator Iter, std::sentinel_for<Iter> Sent = Iter>
+    using BigEndianBitReader = BitReader<Iter, Sent, true>;
+
+}
+
+#include <MPGL/IO/BitReader.tpp>
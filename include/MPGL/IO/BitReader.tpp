@@ -0,0 +1,181 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#pragma once
+
+#include <algorithm>
+
+namespace mpgl {
+
+    template <ByteInputIterator Iter, std::sentinel_for<Iter> Sent,
+        bool BigEndian>
+    constexpr void BitReader<Iter, Sent, BigEndian>::appendByte(
+        uint8 byte) noexcept
+    {
+        if constexpr (BigEndian)
+            buffer |= buffer_type{byte} << (MaxPeekLength - bufferLength);
+        else
+            buffer |= buffer_type{byte} << bufferLength;
+        bufferLength += CHAR_BIT;
+    }
+
+    template <ByteInputIterator Iter, std::sentinel_for<Iter> Sent,
+        bool BigEndian>
+    constexpr void BitReader<Iter, Sent, BigEndian>::refillWord(
+        void) requires (UncheckedContiguousIterator<Iter>
+            && std::sized_sentinel_for<Sent, Iter>)
+    {
+        auto const* bytes = reinterpret_cast<uint8 const*>(
+            std::to_address(checkedRange(iter,
+                sizeof(buffer_type)).begin()));
+        buffer_type word = 0;
+        for (uint8 i = 0; i < sizeof(buffer_type); ++i) {
+            if constexpr (BigEndian)
+                word = (word << CHAR_BIT) | bytes[i];
+            else
+                word |= buffer_type{bytes[i]} << (i * CHAR_BIT);
+        }
+        if constexpr (BigEndian)
+            buffer |= word >> bufferLength;
+        else
+            buffer |= word << bufferLength;
+        iter += sizeof(buffer_type) - 1 - bufferLength / CHAR_BIT;
+        bufferLength |= MaxPeekLength;
+    }
+
+    template <ByteInputIterator Iter, std::sentinel_for<Iter> Sent,
+        bool BigEndian>
+    constexpr void BitReader<Iter, Sent, BigEndian>::refill(void) {
+        if constexpr (UncheckedContiguousIterator<Iter>
+            && std::sized_sentinel_for<Sent, Iter>)
+        {
+            if (!std::is_constant_evaluated() && sentinel - iter >=
+                static_cast<std::iter_difference_t<Iter>>(
+                    sizeof(buffer_type)))
+                        return refillWord();
+        }
+        if (isOverrun())
+            throw BitReaderOutOfRangeException{};
+        while (bufferLength <= MaxPeekLength) {
+            if (iter != sentinel) {
+                appendByte(static_cast<uint8>(*iter));
+                ++iter;
+            } else {
+                appendByte(0);
+                ++overrun;
+            }
+        }
+    }
+
+    template <ByteInputIterator Iter, std::sentinel_for<Iter> Sent,
+        bool BigEndian>
+    [[nodiscard]] constexpr
+        BitReader<Iter, Sent, BigEndian>::buffer_type
+            BitReader<Iter, Sent, BigEndian>::peekBits(uint8 length)
+    {
+        if (bufferLength < length)
+            refill();
+        if constexpr (BigEndian)
+            return length ? buffer >> (sizeof(buffer_type)
+                * CHAR_BIT - length) : 0;
+        else
+            return buffer & ((buffer_type{1} << length) - 1);
+    }
+
+    template <ByteInputIterator Iter, std::sentinel_for<Iter> Sent,
+        bool BigEndian>
+    constexpr void BitReader<Iter, Sent, BigEndian>::skipBits(
+        uint8 length) noexcept
+    {
+        if constexpr (BigEndian)
+            buffer <<= length;
+        else
+            buffer >>= length;
+        bufferLength -= length;
+    }
+
+    template <ByteInputIterator Iter, std::sentinel_for<Iter> Sent,
+        bool BigEndian>
+    [[nodiscard]] constexpr
+        BitReader<Iter, Sent, BigEndian>::buffer_type
+            BitReader<Iter, Sent, BigEndian>::readBits(uint8 length)
+    {
+        auto bits = peekBits(length);
+        skipBits(length);
+        return bits;
+    }
+
+    template <ByteInputIterator Iter, std::sentinel_for<Iter> Sent,
+        bool BigEndian>
+    template <std::output_iterator<char> OutputIter>
+    constexpr OutputIter BitReader<Iter, Sent, BigEndian>::copyBytes(
+        size_type count,
+        OutputIter output)
+    {
+        for (; count && bufferLength; --count)
+            *output++ = static_cast<char>(readBits(CHAR_BIT));
+        if (isOverrun())
+            throw BitReaderOutOfRangeException{};
+        if (!count)
+            return output;
+        buffer = 0;
+        if constexpr (std::sized_sentinel_for<Sent, Iter>) {
+            if (sentinel - iter < static_cast<
+                std::iter_difference_t<Iter>>(count))
+                    throw BitReaderOutOfRangeException{};
+            if constexpr (std::random_access_iterator<Iter>) {
+                output = std::ranges::copy(checkedRange(iter,
+                    count), std::move(output)).out;
+                iter += count;
+            } else {
+                auto [last, out] = std::ranges::copy_n(
+                    iter, count, output);
+                iter = std::move(last);
+                output = std::move(out);
+            }
+        } else {
+            for (; count; --count, ++iter) {
+                if (iter == sentinel)
+                    throw BitReaderOutOfRangeException{};
+                *output++ = *iter;
+            }
+        }
+        return output;
+    }
+
+    template <ByteInputIterator Iter, std::sentinel_for<Iter> Sent,
+        bool BigEndian>
+    [[nodiscard]] constexpr
+        BitReader<Iter, Sent, BigEndian>::iterator_type
+            BitReader<Iter, Sent, BigEndian>::getIter(
+                void) const noexcept
+                    requires std::bidirectional_iterator<Iter>
+    {
+        auto buffered = bufferLength / CHAR_BIT;
+        return std::ranges::prev(iter,
+            buffered > overrun ? buffered - overrun : 0);
+    }
+
+}
@@ -0,0 +1,122 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#pragma once
+
+#include <MPGL/Traits/Types.hpp>
+
+#include <iterator>
+#include <climits>
+
+namespace mpgl {
+
+    /**
+     * Writes the bits to the underlying byte output iterator in
+     * the little endian manner [the least significant bit first].
+     * Instead of saving one bit per assignment, the writer keeps
+     * a 64-bit buffer and saves the whole bytes at once
+     *
+     * @tparam Iter the output iterator type
+     */
+    template <std::output_iterator<char> Iter>
+    class BitWriter {
+    public:
+        typedef Iter                                iterator_type;
+        typedef uint64                              buffer_type;
+        typedef std::size_t                         size_type;
+
+        /// The maximum number of bits that can be written at once
+        static constexpr const uint8                MaxWriteLength
+            = 32;
+
+        /**
+         * Constructs a new bit writer object from the given
+         * output iterator
+         *
+         * @param iter the constant reference to the iterator
+         */
+        constexpr explicit BitWriter(
+            iterator_type const& iter) noexcept
+                : iter{iter} {}
+
+        /**
+         * Writes the given number of the least significant bits
+         * of the given value. The length cannot exceed the
+         * MaxWriteLength
+         *
+         * @param bits the written bits
+         * @param length the number of bits
+         */
+        constexpr void writeBits(
+            buffer_type bits,
+            uint8 length);
+
+        /**
+         * Pads the stream with zero bits to the begining of
+         * the next byte. Does nothing when the writer is already
+         * aligned to the byte
+         */
+        constexpr void alignToByte(void);
+
+        /**
+         * Copies the given range of bytes to the output. Aligns
+         * the writer to the byte first
+         *
+         * @tparam Range the range type
+         * @param range the constant reference to the copied range
+         */
+        template <std::ranges::input_range Range>
+        constexpr void writeBytes(Range const& range);
+
+        /**
+         * Saves the buffered bits in the output iterator. Pads
+         * the last byte with zero bits
+         *
+         * @return the output iterator past the last written byte
+         */
+        constexpr iterator_type flush(void);
+
+        /**
+         * Returns the number of bits waiting in the buffer
+         *
+         * @return the number of the buffered bits
+         */
+        [[nodiscard]] constexpr uint8 getBufferedBits(
+            void) const noexcept
+                { return bufferLength; }
+    private:
+        /**
+         * Saves the buffered whole bytes in the output iterator
+         */
+        constexpr void saveBytes(void);
+
+        iterator_type                               iter;
+        buffer_type                                 buffer = 0;
+        uint8                                       bufferLength = 0;
+    };
+
+}
+
+#include <MPGL/IO/BitWriter.tpp>
@@ -0,0 +1,73 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#pragma once
+
+#include <algorithm>
+
+namespace mpgl {
+
+    template <std::output_iterator<char> Iter>
+    constexpr void BitWriter<Iter>::saveBytes(void) {
+        for (; bufferLength >= CHAR_BIT; bufferLength -= CHAR_BIT) {
+            *iter++ = static_cast<char>(buffer & 0xFF);
+            buffer >>= CHAR_BIT;
+        }
+    }
+
+    template <std::output_iterator<char> Iter>
+    constexpr void BitWriter<Iter>::writeBits(
+        buffer_type bits,
+        uint8 length)
+    {
+        buffer |= (bits & ((buffer_type{1} << length) - 1))
+            << bufferLength;
+        if ((bufferLength += length) >= MaxWriteLength)
+            saveBytes();
+    }
+
+    template <std::output_iterator<char> Iter>
+    constexpr void BitWriter<Iter>::alignToByte(void) {
+        bufferLength = (bufferLength + CHAR_BIT - 1)
+            & ~(CHAR_BIT - 1);
+        saveBytes();
+    }
+
+    template <std::output_iterator<char> Iter>
+    template <std::ranges::input_range Range>
+    constexpr void BitWriter<Iter>::writeBytes(Range const& range) {
+        alignToByte();
+        iter = std::ranges::copy(range, std::move(iter)).out;
+    }
+
+    template <std::output_iterator<char> Iter>
+    constexpr BitWriter<Iter>::iterator_type
+        BitWriter<Iter>::flush(void)
+    {
+        alignToByte();
+        return iter;
+    }
+
+}
@@ -79,7 +79,9 @@ namespace mpgl {
 
         /**
          * Reads the file content into an optional vector of chars.
-         * If file cannot be open then returns an empty optional
+         * If file cannot be open then returns an empty optional.
+         * When the content is only read, the MappedFile avoids
+         * the copy
          *
          * @param filePath the path to the file
          * @return the optional with the vector of chars
@@ -29,8 +29,6 @@
 #include <MPGL/Utility/Tokens/Security.hpp>
 #include <MPGL/Iterators/SafeIterator.hpp>
 
-#include <fstream>
-
 namespace mpgl {
 
     /**
@@ -71,15 +69,31 @@ namespace mpgl {
          */
         explicit BMPLoader(
             Policy policy,
-            Path const& fileName);
+            Path const& filePath);
+
+        /**
+         * Constructs a new BMPLoader object. Loads the
+         * BMP format image file from the given file's
+         * content. The path is used to identify the file
+         *
+         * @throw ImageLoadingFileCorruptionException when file
+         * is corrupted
+         * @param policy the security policy tag
+         * @param filePath the path to the BMP file
+         * @param file the file's content
+         */
+        explicit BMPLoader(
+            Policy policy,
+            Path const& filePath,
+            MappedFile::Span file);
 
         /**
          * Destroys the BMPLoader object
          */
         ~BMPLoader(void) noexcept = default;
     private:
-        typedef std::istreambuf_iterator<char>      StreamBuf;
-        typedef PolicyIterIT<Policy, StreamBuf>     FileIter;
+        typedef MappedFile::const_iterator          CharIter;
+        typedef PolicyIterIT<Policy, CharIter>      FileIter;
 
         /**
          * Parses the BMP's header
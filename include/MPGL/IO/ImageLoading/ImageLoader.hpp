@@ -69,6 +69,22 @@ namespace mpgl {
          */
         explicit ImageLoader(Policy policy, Path const& filePath);
 
+        /**
+         * Constructs a new Image Loader object from the content
+         * of the image file that has been already read. The path
+         * is used to determine the image format
+         *
+         * @throw ImageLoadingUnsuportedFileType when the given
+         * image format is unsuported
+         * @param policy the policy token
+         * @param filePath the path to the image file
+         * @param file the file's content
+         */
+        explicit ImageLoader(
+            Policy policy,
+            Path const& filePath,
+            MappedFile::Span file);
+
         /**
          * Returns the constant reference to the image
          *
@@ -108,26 +124,24 @@ namespace mpgl {
          */
         template <std::derived_from<LoaderInterface> Tp>
             requires (std::same_as<typename Tp::Tag, Path const>
-                && std::invocable<Tp, Policy, Path const>)
+                && std::constructible_from<Tp, Policy, Path const&,
+                    MappedFile::Span>)
         static void addFormatLoader(void);
     private:
         typedef std::unique_ptr<LoaderInterface>    LoaderPtr;
         typedef std::function<LoaderPtr(Policy,
-            Path const&)>                           LoadingFun;
+            Path const&, MappedFile::Span)>         LoadingFun;
         typedef std::map<std::string, LoadingFun>   Loaders;
 
         /**
-         * Returns the loader for the given image format
+         * Returns the loading function for the given image format
          *
          * @throw ImageLoadingUnsuportedFileType when the given
          * image format is unsuported
-         * @param policy the policy token
          * @param filePath the path to the image file
-         * @return LoaderPtr
+         * @return the constant reference to the loading function
          */
-        static LoaderPtr getLoader(
-            Policy policy,
-            Path const& filePath);
+        static LoadingFun const& getLoader(Path const& filePath);
 
         /**
          * Returns the image file's tag from the given file path
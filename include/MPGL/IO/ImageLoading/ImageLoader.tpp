@@ -31,8 +31,9 @@ namespace mpgl {
     template <std::derived_from<LoaderInterface> Tp>
         requires (std::same_as<typename Tp::Tag,
             typename ImageLoader<Policy>::Path const>
-                && std::invocable<Tp, Policy,
-            typename ImageLoader<Policy>::Path const>)
+                && std::constructible_from<Tp, Policy,
+            typename ImageLoader<Policy>::Path const&,
+            MappedFile::Span>)
     void ImageLoader<Policy>::addFormatLoader(void) {
         loaders[Tp::Tag] = LoadingFun{ DeferredConstructor<Tp,
             LoaderInterface>{} };
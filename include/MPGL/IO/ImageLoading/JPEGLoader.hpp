@@ -27,9 +27,10 @@
 
 #include <MPGL/IO/ImageLoading/LoaderInterface.hpp>
 #include <MPGL/Mathematics/Tensors/Matrix.hpp>
-#include <MPGL/Compression/HuffmanTree.hpp>
+#include <MPGL/Compression/HuffmanLookupTable.hpp>
 #include <MPGL/Utility/Tokens/Security.hpp>
 #include <MPGL/Iterators/SafeIterator.hpp>
+#include <MPGL/IO/MappedFile.hpp>
 
 #include <functional>
 #include <memory>
@@ -76,7 +77,25 @@ namespace mpgl {
          * @param policy the security policy tag
          * @param filePath the path to the JPEG file
          */
-        explicit JPEGLoader(Policy policy, Path const& filePath);
+        explicit JPEGLoader(
+            Policy policy,
+            Path const& filePath);
+
+        /**
+         * Constructs a new JPEGLoader object. Loads the
+         * JPEG format image file from the given file's
+         * content. The path is used to identify the file
+         *
+         * @throw ImageLoadingFileCorruptionException when file
+         * is corrupted
+         * @param policy the security policy tag
+         * @param filePath the path to the JPEG file
+         * @param file the file's content
+         */
+        explicit JPEGLoader(
+            Policy policy,
+            Path const& filePath,
+            MappedFile::Span file);
 
         /**
          * Destroys the JPEGLoader object
@@ -85,8 +104,7 @@ namespace mpgl {
     private:
         typedef std::vector<uint8>                  DataBuffer;
         typedef typename DataBuffer::const_iterator DataIter;
-        typedef std::vector<char>                   FileBuffer;
-        typedef FileBuffer::const_iterator          StreamIter;
+        typedef MappedFile::const_iterator          StreamIter;
         typedef PolicyIterIT<Policy, DataIter>      SafeIter;
         typedef PolicyIterIT<Policy, StreamIter>    FileIter;
 
@@ -286,15 +304,15 @@ namespace mpgl {
          * Contains informations about decoded huffman trees
          */
         struct HuffmanTable {
-            HuffmanTree<uint16>::Decoder            decoder;
+            HuffmanLookupTable<true>                decoder;
 
             /**
              * Constructs a new Huffman Table object from the
-             * given huffman tre
+             * given huffman lookup table
              *
-             * @param tree the stored huffman tree
+             * @param table the stored huffman lookup table
              */
-            explicit HuffmanTable(HuffmanTree<uint16> tree);
+            explicit HuffmanTable(HuffmanLookupTable<true> table);
         };
 
         /**
@@ -338,7 +356,7 @@ namespace mpgl {
             QuantizationTablePtr>                   QuantizationArray;
         typedef std::map<uint8, Matrix8<int16>>     MatricesMap;
         typedef std::reference_wrapper<ChunkParser> ChunkParserRef;
-        typedef BigEndianInputBitIter<SafeIter>     Iter;
+        typedef BigEndianBitReader<SafeIter>        Iter;
         typedef std::array<int16, 64>               QuantizationData;
         typedef std::queue<ChunkParser>             ChunkQueue;
         typedef std::map<uint16, ChunkParser>       ParserMap;
@@ -26,6 +26,7 @@
 #pragma once
 
 #include <MPGL/Collections/Image.hpp>
+#include <MPGL/IO/MappedFile.hpp>
 #include <MPGL/IO/Readers.hpp>
 
 namespace mpgl {
@@ -61,6 +62,17 @@ namespace mpgl {
         [[nodiscard]] size_type getHeight(void) const noexcept
             { return pixels.getHeight(); }
 
+        /**
+         * Opens the image file with the given path
+         *
+         * @throw ImageLoadingFileOpenException when file cannot
+         * be open
+         * @param filePath the path to the image file
+         * @return the opened image file
+         */
+        [[nodiscard]] static MappedFile openFile(
+            std::string const& filePath);
+
         /**
          * Virtual destructor. Destroys the Loader Interface object
          */
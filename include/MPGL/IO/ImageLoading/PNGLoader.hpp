@@ -27,6 +27,7 @@
 
 #include <MPGL/Utility/Deferred/DeferredConstructor.hpp>
 #include <MPGL/IO/ImageLoading/LoaderInterface.hpp>
+#include <MPGL/Compression/ZlibStreamDecoder.hpp>
 #include <MPGL/Utility/Tokens/Security.hpp>
 #include <MPGL/Iterators/SafeIterator.hpp>
 
@@ -78,13 +79,29 @@ namespace mpgl {
             Policy policy,
             Path const& filePath);
 
+        /**
+         * Constructs a new PNGLoader object. Loads the
+         * PNG format image file from the given file's
+         * content. The path is used to identify the file
+         *
+         * @throw ImageLoadingFileCorruptionException when file
+         * is corrupted
+         * @param policy the security policy tag
+         * @param filePath the path to the PNG file
+         * @param file the file's content
+         */
+        explicit PNGLoader(
+            Policy policy,
+            Path const& filePath,
+            MappedFile::Span file);
+
         /**
          * Destroys the PNGLoader object
          */
         ~PNGLoader(void) noexcept = default;
     private:
         typedef std::vector<char>                   DataBuffer;
-        typedef DataBuffer::const_iterator          CharIter;
+        typedef DataBuffer::const_pointer           CharIter;
         typedef PolicyIterIT<Policy, CharIter>      FileIter;
 
         /**
@@ -105,11 +122,14 @@ namespace mpgl {
                     : image{image}, loader{loader} {}
 
             /**
-             * Filter pixels from the given buffer
+             * Filter pixels from the given buffer. The bounds of
+             * each row are checked once before it is filtered
              *
+             * @throw SafeIteratorOutOfRangeException when the
+             * secured buffer is too short
              * @param iter the iterator to the data buffer
              */
-            void operator()(FileIter& iter) noexcept;
+            void operator()(FileIter& iter);
 
             /**
              * Sets the RGBA pixels
@@ -123,7 +143,7 @@ namespace mpgl {
                 size_type row,
                 size_type column,
                 uint8 filter,
-                FileIter& iter) noexcept;
+                CharIter& iter) noexcept;
 
             /**
              * Sets the RGB pixels
@@ -137,7 +157,7 @@ namespace mpgl {
                 size_type row,
                 size_type column,
                 uint8 filter,
-                FileIter& iter) noexcept;
+                CharIter& iter) noexcept;
 
             /**
              * Sets the gray pixels
@@ -151,7 +171,7 @@ namespace mpgl {
                 size_type row,
                 size_type column,
                 uint8 filter,
-                FileIter& iter) noexcept;
+                CharIter& iter) noexcept;
 
             /**
              * Sets the gray-alpha pixels
@@ -165,7 +185,7 @@ namespace mpgl {
                 size_type row,
                 size_type column,
                 uint8 filter,
-                FileIter& iter) noexcept;
+                CharIter& iter) noexcept;
 
             /**
              * Destroys the Filters object
@@ -240,7 +260,7 @@ namespace mpgl {
                 size_type column,
                 uint8 filter,
                 uint8 subpixelID,
-                FileIter& iter) noexcept;
+                CharIter& iter) noexcept;
 
             /**
              * The first subpixel filter
@@ -307,9 +327,10 @@ namespace mpgl {
         };
 
         typedef void(PNGLoader::Filters::*PixelsSetter)
-            (std::size_t, std::size_t, uint8, FileIter&);
+            (std::size_t, std::size_t, uint8, CharIter&);
 
-        typedef std::map<uint8, PixelsSetter>       ColorSetters;
+        typedef std::pair<PixelsSetter, uint8>      ColorSetter;
+        typedef std::map<uint8, ColorSetter>        ColorSetters;
 
         /**
          * Interface for all types of the PNG data chunks
@@ -454,6 +475,14 @@ namespace mpgl {
          */
         void parseChunk(FileIter& file, size_type length);
 
+        /**
+         * Decompresses the given part of the image data and
+         * appends it to the decompressed data buffer
+         *
+         * @param chunk the part of the compressed image data
+         */
+        void inflateChunk(ZlibStreamDecoder::InputSpan chunk);
+
         /**
          * Chooses the interlancing method
          *
@@ -486,13 +515,16 @@ namespace mpgl {
             uint32 incrementX,
             uint32 incrementY) const noexcept;
 
-        DataBuffer                                  rawFileData;
+        ZlibStreamDecoder                           decoder;
+        DataBuffer                                  decoded;
+        size_type                                   decodedSize = 0;
 
         /**
          * Contains data obtained from the header
          */
         struct HeaderData {
             PixelsSetter                            setter;
+            uint8                                   channels;
             bool                                    interlance;
         }                                           headerData;
 
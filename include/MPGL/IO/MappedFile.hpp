@@ -0,0 +1,218 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#pragma once
+
+#include <MPGL/Traits/Types.hpp>
+
+#include <optional>
+#include <string>
+#include <vector>
+#include <span>
+
+namespace mpgl {
+
+    /**
+     * Read-only view of the file's content. The file is mapped
+     * into the memory when it is possible, so its content is not
+     * copied and the pages are loaded on demand. The files that
+     * cannot be mapped [pipes, special files or empty files] are
+     * read into the owned buffer at once
+     */
+    class MappedFile {
+    public:
+        typedef std::span<char const>               Span;
+        typedef char const*                         iterator;
+        typedef char const*                         const_iterator;
+        typedef char                                value_type;
+        typedef std::size_t                         size_type;
+        typedef std::string                         Path;
+        typedef std::vector<char>                   Buffer;
+
+        /**
+         * The expected pattern of the accesses to the file's
+         * content. Passed to the kernel as the paging hint
+         */
+        enum class Access : uint8 {
+            /// The content is read once from the begining to the end
+            Sequential,
+            /// The content is read in the random order
+            Random
+        };
+
+        /**
+         * Opens the file with the given path and maps it into
+         * the memory. Returns an empty optional when the file
+         * cannot be opened
+         *
+         * @param filePath the path to the file
+         * @param access the expected access pattern
+         * @return the optional with the mapped file
+         */
+        [[nodiscard]] static std::optional<MappedFile> open(
+            Path const& filePath,
+            Access access = Access::Sequential);
+
+        /**
+         * Constructs a new empty Mapped File object
+         */
+        explicit MappedFile(void) noexcept = default;
+
+        /**
+         * Constructs a new Mapped File object from the buffer
+         * with the file's content that has been already read
+         *
+         * @param buffer the rvalue reference to the buffer
+         */
+        explicit MappedFile(Buffer&& buffer) noexcept;
+
+        MappedFile(MappedFile const& file) = delete;
+
+        /**
+         * Constructs a new Mapped File object from the given
+         * rvalue reference to the mapped file
+         *
+         * @param file the rvalue reference to the mapped file
+         */
+        MappedFile(MappedFile&& file) noexcept;
+
+        MappedFile& operator=(MappedFile const& file) = delete;
+
+        /**
+         * Assigns the given rvalue reference to the mapped file
+         * to this object
+         *
+         * @param file the rvalue reference to the mapped file
+         * @return the reference to this object
+         */
+        MappedFile& operator=(MappedFile&& file) noexcept;
+
+        /**
+         * Returns the span with the file's content
+         *
+         * @return the span with the file's content
+         */
+        [[nodiscard]] Span getSpan(void) const noexcept
+            { return { address, length }; }
+
+        /**
+         * Returns the pointer to the file's content
+         *
+         * @return the pointer to the file's content
+         */
+        [[nodiscard]] char const* data(void) const noexcept
+            { return address; }
+
+        /**
+         * Returns the size of the file
+         *
+         * @return the size of the file
+         */
+        [[nodiscard]] size_type size(void) const noexcept
+            { return length; }
+
+        /**
+         * Returns whether the file is empty
+         *
+         * @return if the file is empty
+         */
+        [[nodiscard]] bool empty(void) const noexcept
+            { return !length; }
+
+        /**
+         * Returns whether the file's content is mapped into
+         * the memory instead of being read into the buffer
+         *
+         * @return if the file's content is mapped
+         */
+        [[nodiscard]] bool isMapped(void) const noexcept
+            { return mapped; }
+
+        /**
+         * Returns the iterator to the begining of the file
+         *
+         * @return the iterator to the begining of the file
+         */
+        [[nodiscard]] const_iterator begin(void) const noexcept
+            { return address; }
+
+        /**
+         * Returns the iterator to the end of the file
+         *
+         * @return the iterator to the end of the file
+         */
+        [[nodiscard]] const_iterator end(void) const noexcept
+            { return address + length; }
+
+        /**
+         * Returns the constant iterator to the begining of
+         * the file
+         *
+         * @return the constant iterator to the begining of
+         * the file
+         */
+        [[nodiscard]] const_iterator cbegin(void) const noexcept
+            { return address; }
+
+        /**
+         * Returns the constant iterator to the end of the file
+         *
+         * @return the constant iterator to the end of the file
+         */
+        [[nodiscard]] const_iterator cend(void) const noexcept
+            { return address + length; }
+
+        /**
+         * Unmaps the file
+         */
+        ~MappedFile(void) noexcept;
+    private:
+        /**
+         * Constructs a new Mapped File object from the mapped
+         * memory
+         *
+         * @param address the address of the mapped memory
+         * @param length the length of the mapped memory
+         */
+        explicit MappedFile(
+            char const* address,
+            size_type length) noexcept
+                : address{address}, length{length}, mapped{true} {}
+
+        /**
+         * Unmaps the file's content
+         */
+        void unmap(void) noexcept;
+
+        Buffer                                      buffer;
+        char const*                                 address = nullptr;
+        size_type                                   length = 0;
+        bool                                        mapped = false;
+
+        /// The minimal size of the chunk read from the special files
+        static constexpr const size_type            ChunkSize = 4096;
+    };
+
+}
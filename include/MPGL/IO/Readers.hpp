@@ -25,11 +25,13 @@
  */
 #pragma once
 
+#include <MPGL/Iterators/SafeIterator.hpp>
 #include <MPGL/Iterators/BitIterator.hpp>
 #include <MPGL/Traits/Concepts.hpp>
 
 #include <algorithm>
 #include <iterator>
+#include <span>
 
 namespace mpgl {
 
@@ -168,6 +170,48 @@ namespace mpgl {
         std::size_t length,
         Iter iter) noexcept(NothrowReadable<Iter>);
 
+    /**
+     * Reads the array of the given types from the given iterator
+     * to the given span. Advances iterator by the size of the
+     * array. When the iterator is contiguous the whole array is
+     * copied at once and its elements are byte-swapped in place
+     *
+     * @tparam Tp the given type
+     * @tparam BigEndian indicates if the types are saved
+     * in the big-endian manner
+     * @tparam Iter the iterator type
+     * @param iterator the reference to the iterator
+     * @param output the span with the read types
+     */
+    template <class Tp, bool BigEndian = false,
+        std::input_iterator Iter>
+            requires (std::is_trivially_constructible_v<Tp>
+                && std::same_as<std::iter_value_t<Iter>, char>)
+    void readTypes(
+        Iter& iterator,
+        std::span<Tp> output) noexcept(NothrowReadable<Iter>);
+
+    /**
+     * Peeks the array of the given types from the given iterator
+     * to the given span. When the iterator is contiguous the
+     * whole array is copied at once and its elements are
+     * byte-swapped in place
+     *
+     * @tparam Tp the given type
+     * @tparam BigEndian indicates if the types are saved
+     * in the big-endian manner
+     * @tparam Iter the iterator type
+     * @param iterator the iterator object
+     * @param output the span with the peeked types
+     */
+    template <class Tp, bool BigEndian = false,
+        std::input_iterator Iter>
+            requires (std::is_trivially_constructible_v<Tp>
+                && std::same_as<std::iter_value_t<Iter>, char>)
+    void peekTypes(
+        Iter iterator,
+        std::span<Tp> output) noexcept(NothrowReadable<Iter>);
+
     /**
      * Reads the given type from the given bit iterator.
      * Advances iterator by the size of the given type
@@ -255,6 +299,35 @@ namespace mpgl {
         std::size_t length,
         Iter iter) noexcept;
 
+    namespace details {
+
+        /**
+         * Reverses the order of the bytes of the given value
+         *
+         * @tparam Tp the value type
+         * @param value the value
+         * @return the value with the reversed bytes
+         */
+        template <class Tp>
+            requires std::is_trivially_copyable_v<Tp>
+        [[nodiscard]] constexpr Tp swapBytes(Tp value) noexcept;
+
+        /**
+         * Converts the value loaded from the memory with the given
+         * endianness to the native endianness
+         *
+         * @tparam BigEndian indicates if the value is saved
+         * in the big-endian manner
+         * @tparam Tp the value type
+         * @param value the loaded value
+         * @return the value in the native endianness
+         */
+        template <bool BigEndian, class Tp>
+            requires std::is_trivially_copyable_v<Tp>
+        [[nodiscard]] constexpr Tp fromEndian(Tp value) noexcept;
+
+    }
+
 }
 
 #include <MPGL/IO/Readers.tpp>
@@ -25,6 +25,10 @@
  */
 #pragma once
 
+#include <cstring>
+#include <array>
+#include <bit>
+
 namespace mpgl {
 
     template <NotSameSize<std::byte> Tp, bool BigEndian,
@@ -34,17 +38,23 @@ namespace mpgl {
     [[nodiscard]] Tp readType(
         Iter& iterator) noexcept(NothrowReadable<Iter>)
     {
-        Tp data;
-        if constexpr (BigEndian) {
-            char* raw = reinterpret_cast<char*>(&data) + sizeof(Tp) - 1;
-            for (uint8 i = sizeof(Tp);i != 0; --i, --raw, ++iterator)
-                *raw = *iterator;
+        if constexpr (std::random_access_iterator<Iter>) {
+            Tp data = peekType<Tp, BigEndian>(iterator);
+            iterator += sizeof(Tp);
+            return data;
         } else {
-            char* raw = reinterpret_cast<char*>(&data);
-            for (uint8 i = 0;i != sizeof(Tp); ++i, ++raw, ++iterator)
-                *raw = *iterator;
+            Tp data;
+            if constexpr (BigEndian) {
+                char* raw = reinterpret_cast<char*>(&data) + sizeof(Tp) - 1;
+                for (uint8 i = sizeof(Tp);i != 0; --i, --raw, ++iterator)
+                    *raw = *iterator;
+            } else {
+                char* raw = reinterpret_cast<char*>(&data);
+                for (uint8 i = 0;i != sizeof(Tp); ++i, ++raw, ++iterator)
+                    *raw = *iterator;
+            }
+            return data;
         }
-        return data;
     }
 
     template <NotSameSize<std::byte> Tp, bool BigEndian,
@@ -54,17 +64,27 @@ namespace mpgl {
     [[nodiscard]] Tp peekType(
         Iter iterator) noexcept(NothrowReadable<Iter>)
     {
-        Tp data;
-        if constexpr (BigEndian) {
-            char* raw = reinterpret_cast<char*>(&data) + sizeof(Tp) - 1;
-            for (uint8 i = sizeof(Tp);i != 0; --i, --raw, ++iterator)
-                *raw = *iterator;
+        if constexpr (std::random_access_iterator<Iter>
+            && !std::same_as<UncheckedIter<Iter>, Iter>)
+                return peekType<Tp, BigEndian>(
+                    checkedRange(iterator, sizeof(Tp)).begin());
+        else if constexpr (std::contiguous_iterator<Iter>) {
+            Tp data;
+            std::memcpy(&data, std::to_address(iterator), sizeof(Tp));
+            return details::fromEndian<BigEndian>(data);
         } else {
-            char* raw = reinterpret_cast<char*>(&data);
-            for (uint8 i = 0;i != sizeof(Tp); ++i, ++raw, ++iterator)
-                *raw = *iterator;
+            Tp data;
+            if constexpr (BigEndian) {
+                char* raw = reinterpret_cast<char*>(&data) + sizeof(Tp) - 1;
+                for (uint8 i = sizeof(Tp);i != 0; --i, --raw, ++iterator)
+                    *raw = *iterator;
+            } else {
+                char* raw = reinterpret_cast<char*>(&data);
+                for (uint8 i = 0;i != sizeof(Tp); ++i, ++raw, ++iterator)
+                    *raw = *iterator;
+            }
+            return data;
         }
-        return data;
     }
 
     template <SameSize<std::byte> Tp, bool BigEndian,
@@ -113,9 +133,15 @@ namespace mpgl {
         std::size_t length,
         Iter& iter) noexcept(NothrowReadable<Iter>)
     {
-        std::string data(length, ' ');
-        std::ranges::for_each(data, [&iter](auto& c){ c = *iter++; });
-        return data;
+        if constexpr (std::random_access_iterator<Iter>) {
+            std::string data = peekNChars(length, iter);
+            iter += length;
+            return data;
+        } else {
+            std::string data(length, ' ');
+            std::ranges::for_each(data, [&iter](auto& c){ c = *iter++; });
+            return data;
+        }
     }
 
     template <std::input_iterator Iter>
@@ -124,9 +150,48 @@ namespace mpgl {
         std::size_t length,
         Iter iter) noexcept(NothrowReadable<Iter>)
     {
-        std::string data(length, ' ');
-        std::ranges::for_each(data, [&iter](auto& c){ c = *iter++; });
-        return data;
+        if constexpr (std::random_access_iterator<Iter>) {
+            auto chars = checkedRange(iter, length);
+            return std::string{chars.begin(), chars.end()};
+        } else {
+            std::string data(length, ' ');
+            std::ranges::for_each(data, [&iter](auto& c){ c = *iter++; });
+            return data;
+        }
+    }
+
+    template <class Tp, bool BigEndian, std::input_iterator Iter>
+        requires (std::is_trivially_constructible_v<Tp>
+            && std::same_as<std::iter_value_t<Iter>, char>)
+    void readTypes(
+        Iter& iterator,
+        std::span<Tp> output) noexcept(NothrowReadable<Iter>)
+    {
+        if constexpr (std::random_access_iterator<Iter>) {
+            peekTypes<Tp, BigEndian>(iterator, output);
+            iterator += output.size_bytes();
+        } else
+            for (Tp& element : output)
+                element = readType<Tp, BigEndian>(iterator);
+    }
+
+    template <class Tp, bool BigEndian, std::input_iterator Iter>
+        requires (std::is_trivially_constructible_v<Tp>
+            && std::same_as<std::iter_value_t<Iter>, char>)
+    void peekTypes(
+        Iter iterator,
+        std::span<Tp> output) noexcept(NothrowReadable<Iter>)
+    {
+        if constexpr (UncheckedContiguousIterator<Iter>) {
+            auto bytes = checkedRange(iterator, output.size_bytes());
+            std::memcpy(output.data(), std::to_address(bytes.begin()),
+                output.size_bytes());
+            if constexpr (sizeof(Tp) != 1)
+                for (Tp& element : output)
+                    element = details::fromEndian<BigEndian>(element);
+        } else
+            for (Tp& element : output)
+                element = readType<Tp, BigEndian>(iterator);
     }
 
     template <std::integral Tp, bool BigEndian, BitInputIterator Iter>
@@ -201,4 +266,23 @@ namespace mpgl {
         return answer;
     }
 
+    template <class Tp>
+        requires std::is_trivially_copyable_v<Tp>
+    [[nodiscard]] constexpr Tp details::swapBytes(Tp value) noexcept {
+        auto bytes = std::bit_cast<std::array<std::byte, sizeof(Tp)>>(
+            value);
+        std::ranges::reverse(bytes);
+        return std::bit_cast<Tp>(bytes);
+    }
+
+    template <bool BigEndian, class Tp>
+        requires std::is_trivially_copyable_v<Tp>
+    [[nodiscard]] constexpr Tp details::fromEndian(Tp value) noexcept {
+        if constexpr (BigEndian != (std::endian::native
+            == std::endian::big))
+                return swapBytes(value);
+        else
+            return value;
+    }
+
 }
@@ -32,6 +32,7 @@
 #include <algorithm>
 #include <iterator>
 #include <compare>
+#include <ranges>
 
 namespace mpgl {
 
@@ -567,6 +568,61 @@ namespace mpgl {
         std::ranges::iterator_t<Range>,
         std::ranges::sentinel_t<Range>>;
 
+    /**
+     * Returns the subrange of the given length beginning at the
+     * given safe iterator. The bounds of the whole subrange are
+     * checked once, so its elements can be accessed without any
+     * further checks
+     *
+     * @throws SafeIteratorOutOfRangeException when the subrange
+     * exceeds the safe range
+     * @tparam Iter the wrapped iterator type
+     * @tparam Sent the sentinel type of the iterator
+     * @param iter the constant reference to the safe iterator
+     * @param length the length of the subrange
+     * @return the subrange of the wrapped iterators
+     */
+    template <std::random_access_iterator Iter,
+        std::sentinel_for<Iter> Sent>
+    [[nodiscard]] constexpr std::ranges::subrange<Iter> checkedRange(
+        SafeIterator<Iter, Sent> const& iter,
+        std::iter_difference_t<Iter> length);
+
+    /**
+     * Returns the subrange of the given length beginning at the
+     * given iterator. The unsecured iterators are not checked
+     *
+     * @tparam Iter the iterator type
+     * @param iter the constant reference to the iterator
+     * @param length the length of the subrange
+     * @return the subrange of the iterators
+     */
+    template <std::random_access_iterator Iter>
+    [[nodiscard]] constexpr std::ranges::subrange<Iter> checkedRange(
+        Iter const& iter,
+        std::iter_difference_t<Iter> length) noexcept;
+
+    /**
+     * Defines an iterator of the subranges returned by the
+     * checkedRange function for the given iterator
+     *
+     * @tparam Iter the iterator's type
+     */
+    template <std::random_access_iterator Iter>
+    using UncheckedIter = std::ranges::iterator_t<decltype(
+        checkedRange(std::declval<Iter>(), 0))>;
+
+    /**
+     * Checks whether the subranges returned by the checkedRange
+     * function for the given iterator are contiguous
+     *
+     * @tparam Iter the iterator's type
+     */
+    template <class Iter>
+    concept UncheckedContiguousIterator =
+        std::random_access_iterator<Iter> &&
+        std::contiguous_iterator<UncheckedIter<Iter>>;
+
     /**
      * Erases the subrange indicated by the iterators from the given
      * range
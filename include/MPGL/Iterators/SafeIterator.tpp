@@ -88,6 +88,26 @@ namespace mpgl {
             throw SecurityUnknownPolicyException{};
     }
 
+    template <std::random_access_iterator Iter,
+        std::sentinel_for<Iter> Sent>
+    [[nodiscard]] constexpr std::ranges::subrange<Iter> checkedRange(
+        SafeIterator<Iter, Sent> const& iter,
+        std::iter_difference_t<Iter> length)
+    {
+        if (length < 0 || iter.getIter() < iter.getBegin()
+            || iter.getSent() - iter.getIter() < length)
+                throw SafeIteratorOutOfRangeException{};
+        return {iter.getIter(), iter.getIter() + length};
+    }
+
+    template <std::random_access_iterator Iter>
+    [[nodiscard]] constexpr std::ranges::subrange<Iter> checkedRange(
+        Iter const& iter,
+        std::iter_difference_t<Iter> length) noexcept
+    {
+        return {iter, iter + length};
+    }
+
     template <ErasableRange Range>
     void erase(
         Range&& range,
@@ -39,6 +39,7 @@
 #include <MPGL/Exceptions/Shader/ShaderCompilationException.hpp>
 #include <MPGL/Exceptions/TTFLoaderFileCorruptionException.hpp>
 #include <MPGL/Exceptions/ExecusionUnknownPolicyException.hpp>
+#include <MPGL/Exceptions/AssetArchiveCorruptionException.hpp>
 #include <MPGL/Mathematics/Transforms/ConvolutionKernels.hpp>
 #include <MPGL/Core/Figures/Primitives/ConvexHexahedron.hpp>
 #include <MPGL/Core/Transformations/ChainTransformation.hpp>
@@ -52,6 +53,7 @@
 #include <MPGL/Exceptions/FontNoRegularException.hpp>
 #include <MPGL/Core/Figures/Primitives/Cylinder.hpp>
 #include <MPGL/Core/Transformations/Translation.hpp>
+#include <MPGL/Core/Text/DistanceFieldGenerator.hpp>
 #include <MPGL/Core/Figures/Meshes/DynamicMesh.hpp>
 #include <MPGL/Core/States/WiredFrameDisabler.hpp>
 #include <MPGL/Core/Context/Buffers/BindGuard.hpp>
@@ -61,6 +63,8 @@
 #include <MPGL/Core/Figures/Primitives/Torus.hpp>
 #include <MPGL/Core/States/WiredFrameEnabler.hpp>
 #include <MPGL/Core/Transformations/Rotation.hpp>
+#include <MPGL/Compression/GZIPStreamDecoder.hpp>
+#include <MPGL/Compression/ZlibStreamDecoder.hpp>
 #include <MPGL/Core/Textures/TexturedFigure.hpp>
 #include <MPGL/Core/Transformations/Scaling.hpp>
 #include <MPGL/Exceptions/StackedExceptions.hpp>
@@ -73,10 +77,17 @@
 #include <MPGL/IO/ImageLoading/JPEGLoader.hpp>
 #include <MPGL/IO/ImageLoading/PNGLoader.hpp>
 #include <MPGL/IO/ImageLoading/BMPLoader.hpp>
+#include <MPGL/Core/Textures/AtlasPacker.hpp>
 #include <MPGL/Core/Text/FontRasterizer.hpp>
+#include <MPGL/Compression/GZIPEncoder.hpp>
+#include <MPGL/Compression/ZlibEncoder.hpp>
 #include <MPGL/Compression/ZlibDecoder.hpp>
 #include <MPGL/Utility/StringAlgorithm.hpp>
+#include <MPGL/IO/AssetArchiveWriter.hpp>
 #include <MPGL/Utility/Polymorpher.hpp>
 #include <MPGL/Core/Windows/Window.hpp>
+#include <MPGL/IO/AsyncFileReader.hpp>
 #include <MPGL/Core/Text/UTF-8.hpp>
+#include <MPGL/IO/AssetArchive.hpp>
 #include <MPGL/Core/Text/Text.hpp>
+#include <MPGL/IO/MappedFile.hpp>
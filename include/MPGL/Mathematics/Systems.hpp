@@ -397,6 +397,26 @@ namespace mpgl {
         float32 aspect,
         Vector2f zAxis) noexcept;
 
+    /**
+     * Calculates the number of line segments needed to flatten
+     * the quadratic bézier curve so that no point of the curve
+     * lies further than the given tolerance from the segments.
+     * Uses the closed-form bound of the parabola's deviation
+     * |p0 - 2p1 + p2| / 4n^2 instead of the curve's length
+     *
+     * @param firstVertex the first vertex position
+     * @param secondVertex the control vertex position
+     * @param thirdVertex the last vertex position
+     * @param tolerance the maximal distance between the curve
+     * and its segments
+     * @return the number of line segments
+     */
+    [[nodiscard]] std::size_t quadraticBezierSegments(
+        Vector2f const& firstVertex,
+        Vector2f const& secondVertex,
+        Vector2f const& thirdVertex,
+        float32 tolerance) noexcept;
+
     /**
      * Calculates the frustum projection matrix
      *
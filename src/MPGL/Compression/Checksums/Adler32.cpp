@@ -0,0 +1,326 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#include <MPGL/Compression/Checksums/Adler32.hpp>
+
+#include <algorithm>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define MPGL_ADLER32_X86
+#include <immintrin.h>
+#elif defined(__GNUC__) && defined(__aarch64__)
+#define MPGL_ADLER32_NEON
+#include <arm_neon.h>
+#endif
+
+namespace mpgl {
+
+    namespace details {
+
+        typedef uint32 (*Adler32Kernel)(
+            uint32, uint8 const*, std::size_t) noexcept;
+
+        /// The number of bytes processed by the vector kernels at once
+        static constexpr const std::size_t AdlerBlockSize = 32;
+        /// The number of blocks summed without the modulo
+        static constexpr const std::size_t AdlerMaxBlocks
+            = Adler32::MaxDeferred / AdlerBlockSize;
+
+        #ifdef MPGL_ADLER32_X86
+        /**
+         * Sums the 32-bit lanes of the vector
+         *
+         * @param vector the summed vector
+         * @return the sum of the lanes
+         */
+        __attribute__((target("ssse3")))
+        static inline uint32 horizontalSum(__m128i vector) noexcept {
+            vector = _mm_add_epi32(vector,
+                _mm_shuffle_epi32(vector, _MM_SHUFFLE(2, 3, 0, 1)));
+            vector = _mm_add_epi32(vector,
+                _mm_shuffle_epi32(vector, _MM_SHUFFLE(1, 0, 3, 2)));
+            return static_cast<uint32>(_mm_cvtsi128_si32(vector));
+        }
+
+        /**
+         * Updates the checksum with the 32-byte blocks using
+         * the SSSE3 instructions. The first sum is accumulated
+         * with the sums of absolute differences and the weighted
+         * second sum with the multiply-add instructions
+         *
+         * @param checksum the adler32 checksum
+         * @param data the pointer to the bytes
+         * @param length the number of the bytes - the multiple
+         * of the block size
+         * @return the updated checksum
+         */
+        __attribute__((target("ssse3")))
+        static uint32 adler32SSSE3(
+            uint32 checksum,
+            uint8 const* data,
+            std::size_t length) noexcept
+        {
+            uint32 low = checksum & 0xFFFF, high = checksum >> 16;
+            __m128i const firstTaps = _mm_setr_epi8(32, 31, 30, 29,
+                28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17);
+            __m128i const secondTaps = _mm_setr_epi8(16, 15, 14, 13,
+                12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+            __m128i const zero = _mm_setzero_si128();
+            __m128i const ones = _mm_set1_epi16(1);
+            for (std::size_t blocks = length / AdlerBlockSize; blocks;) {
+                std::size_t count = std::min(blocks, AdlerMaxBlocks);
+                blocks -= count;
+                __m128i previous = _mm_cvtsi32_si128(
+                    static_cast<int32>(low * count));
+                __m128i weighted = _mm_cvtsi32_si128(
+                    static_cast<int32>(high));
+                __m128i sum = _mm_setzero_si128();
+                for (; count; --count, data += AdlerBlockSize) {
+                    __m128i first = _mm_loadu_si128(
+                        reinterpret_cast<__m128i const*>(data));
+                    __m128i second = _mm_loadu_si128(
+                        reinterpret_cast<__m128i const*>(data + 16));
+                    previous = _mm_add_epi32(previous, sum);
+                    sum = _mm_add_epi32(sum, _mm_sad_epu8(first, zero));
+                    sum = _mm_add_epi32(sum, _mm_sad_epu8(second, zero));
+                    weighted = _mm_add_epi32(weighted, _mm_madd_epi16(
+                        _mm_maddubs_epi16(first, firstTaps), ones));
+                    weighted = _mm_add_epi32(weighted, _mm_madd_epi16(
+                        _mm_maddubs_epi16(second, secondTaps), ones));
+                }
+                weighted = _mm_add_epi32(weighted,
+                    _mm_slli_epi32(previous, 5));
+                low = (low + horizontalSum(sum)) % Adler32::AdlerBase;
+                high = horizontalSum(weighted) % Adler32::AdlerBase;
+            }
+            return (high << 16) | low;
+        }
+
+        /**
+         * Sums the 32-bit lanes of the vector
+         *
+         * @param vector the summed vector
+         * @return the sum of the lanes
+         */
+        __attribute__((target("avx2")))
+        static inline uint32 horizontalSum(__m256i vector) noexcept {
+            return horizontalSum(_mm_add_epi32(
+                _mm256_castsi256_si128(vector),
+                _mm256_extracti128_si256(vector, 1)));
+        }
+
+        /**
+         * Updates the checksum with the 32-byte blocks using
+         * the AVX2 instructions. Processes the whole block
+         * in one vector
+         *
+         * @param checksum the adler32 checksum
+         * @param data the pointer to the bytes
+         * @param length the number of the bytes - the multiple
+         * of the block size
+         * @return the updated checksum
+         */
+        __attribute__((target("avx2")))
+        static uint32 adler32AVX2(
+            uint32 checksum,
+            uint8 const* data,
+            std::size_t length) noexcept
+        {
+            uint32 low = checksum & 0xFFFF, high = checksum >> 16;
+            __m256i const taps = _mm256_setr_epi8(32, 31, 30, 29, 28,
+                27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14,
+                13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+            __m256i const zero = _mm256_setzero_si256();
+            __m256i const ones = _mm256_set1_epi16(1);
+            for (std::size_t blocks = length / AdlerBlockSize; blocks;) {
+                std::size_t count = std::min(blocks, AdlerMaxBlocks);
+                blocks -= count;
+                __m256i previous = _mm256_setr_epi32(
+                    static_cast<int32>(low * count), 0, 0, 0, 0, 0, 0, 0);
+                __m256i weighted = _mm256_setr_epi32(
+                    static_cast<int32>(high), 0, 0, 0, 0, 0, 0, 0);
+                __m256i sum = _mm256_setzero_si256();
+                for (; count; --count, data += AdlerBlockSize) {
+                    __m256i bytes = _mm256_loadu_si256(
+                        reinterpret_cast<__m256i const*>(data));
+                    previous = _mm256_add_epi32(previous, sum);
+                    sum = _mm256_add_epi32(sum,
+                        _mm256_sad_epu8(bytes, zero));
+                    weighted = _mm256_add_epi32(weighted,
+                        _mm256_madd_epi16(
+                            _mm256_maddubs_epi16(bytes, taps), ones));
+                }
+                weighted = _mm256_add_epi32(weighted,
+                    _mm256_slli_epi32(previous, 5));
+                low = (low + horizontalSum(sum)) % Adler32::AdlerBase;
+                high = horizontalSum(weighted) % Adler32::AdlerBase;
+            }
+            return (high << 16) | low;
+        }
+
+        /**
+         * Returns the widest vector kernel supported by
+         * the processor
+         *
+         * @return the adler32 kernel or nullptr
+         */
+        static Adler32Kernel chooseAdler32Kernel(void) noexcept {
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2"))
+                return adler32AVX2;
+            if (__builtin_cpu_supports("ssse3"))
+                return adler32SSSE3;
+            return nullptr;
+        }
+        #elif defined(MPGL_ADLER32_NEON)
+        /**
+         * Updates the checksum with the 32-byte blocks using
+         * the NEON instructions. The bytes are summed per column
+         * and weighted once per NMAX bytes
+         *
+         * @param checksum the adler32 checksum
+         * @param data the pointer to the bytes
+         * @param length the number of the bytes - the multiple
+         * of the block size
+         * @return the updated checksum
+         */
+        static uint32 adler32NEON(
+            uint32 checksum,
+            uint8 const* data,
+            std::size_t length) noexcept
+        {
+            static constexpr const uint16 taps[AdlerBlockSize] = {
+                32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19,
+                18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4,
+                3, 2, 1};
+            uint32 low = checksum & 0xFFFF, high = checksum >> 16;
+            for (std::size_t blocks = length / AdlerBlockSize; blocks;) {
+                std::size_t count = std::min(blocks, AdlerMaxBlocks);
+                blocks -= count;
+                uint32x4_t weighted = vsetq_lane_u32(
+                    static_cast<uint32>(low * count), vdupq_n_u32(0), 0);
+                uint32x4_t sum = vdupq_n_u32(0);
+                uint16x8_t columns[4] = {vdupq_n_u16(0), vdupq_n_u16(0),
+                    vdupq_n_u16(0), vdupq_n_u16(0)};
+                for (; count; --count, data += AdlerBlockSize) {
+                    uint8x16_t first = vld1q_u8(data);
+                    uint8x16_t second = vld1q_u8(data + 16);
+                    weighted = vaddq_u32(weighted, sum);
+                    sum = vpadalq_u16(sum,
+                        vpadalq_u8(vpaddlq_u8(first), second));
+                    columns[0] = vaddw_u8(columns[0], vget_low_u8(first));
+                    columns[1] = vaddw_u8(columns[1], vget_high_u8(first));
+                    columns[2] = vaddw_u8(columns[2], vget_low_u8(second));
+                    columns[3] = vaddw_u8(columns[3],
+                        vget_high_u8(second));
+                }
+                weighted = vshlq_n_u32(weighted, 5);
+                for (std::size_t i = 0; i != 4; ++i) {
+                    weighted = vmlal_u16(weighted,
+                        vget_low_u16(columns[i]), vld1_u16(taps + 8 * i));
+                    weighted = vmlal_u16(weighted,
+                        vget_high_u16(columns[i]),
+                        vld1_u16(taps + 8 * i + 4));
+                }
+                low = (low + vaddvq_u32(sum)) % Adler32::AdlerBase;
+                high = (high + vaddvq_u32(weighted)) % Adler32::AdlerBase;
+            }
+            return (high << 16) | low;
+        }
+
+        /**
+         * Returns the NEON kernel which is always available
+         * on AArch64
+         *
+         * @return the adler32 kernel
+         */
+        static Adler32Kernel chooseAdler32Kernel(void) noexcept {
+            return adler32NEON;
+        }
+        #else
+        /**
+         * Returns the vector kernel, which is not available
+         * on this platform
+         *
+         * @return nullptr
+         */
+        static Adler32Kernel chooseAdler32Kernel(void) noexcept {
+            return nullptr;
+        }
+        #endif
+
+    }
+
+    [[nodiscard]] uint32 Adler32::update(
+        uint32 checksum,
+        uint8 const* data,
+        size_type length) noexcept
+    {
+        static details::Adler32Kernel const kernel
+            = details::chooseAdler32Kernel();
+        if (kernel && length >= 2 * details::AdlerBlockSize) {
+            size_type bulk = length & ~(details::AdlerBlockSize - 1);
+            checksum = kernel(checksum, data, bulk);
+            data += bulk;
+            length -= bulk;
+        }
+        uint32 low = checksum & 0xFFFF, high = checksum >> 16;
+        while (length) {
+            size_type count = std::min(length, MaxDeferred);
+            length -= count;
+            for (; count >= 8; count -= 8, data += 8) {
+                high += low += data[0];
+                high += low += data[1];
+                high += low += data[2];
+                high += low += data[3];
+                high += low += data[4];
+                high += low += data[5];
+                high += low += data[6];
+                high += low += data[7];
+            }
+            for (; count; --count)
+                high += low += *data++;
+            low %= AdlerBase;
+            high %= AdlerBase;
+        }
+        return (high << 16) | low;
+    }
+
+    [[nodiscard]] uint32 Adler32::combine(
+        uint32 first,
+        uint32 second,
+        size_type secondLength) noexcept
+    {
+        uint64 remainder = secondLength % AdlerBase;
+        uint64 low = first & 0xFFFF;
+        uint64 high = (remainder * low) % AdlerBase;
+        low += (second & 0xFFFF) + AdlerBase - 1;
+        high += (first >> 16) + (second >> 16) + AdlerBase - remainder;
+        low %= AdlerBase;
+        high %= AdlerBase;
+        return static_cast<uint32>((high << 16) | low);
+    }
+
+}
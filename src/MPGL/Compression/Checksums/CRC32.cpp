@@ -25,8 +25,276 @@
  */
 #include <MPGL/Compression/Checksums/CRC32.hpp>
 
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define MPGL_CRC32_PCLMUL
+#include <immintrin.h>
+#elif defined(__GNUC__) && defined(__aarch64__)
+#define MPGL_CRC32_ARMV8
+#include <arm_acle.h>
+#ifdef __linux__
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#endif
+#endif
+
 namespace mpgl {
 
-    CRC32::LookupTable const CRC32::lookup = generateLookupTable();
+    CRC32::LookupTables const CRC32::lookup = generateLookupTables();
+
+    namespace details {
+
+        typedef uint32 (*CRC32Kernel)(
+            uint32, uint8 const*, std::size_t) noexcept;
+
+        #ifdef MPGL_CRC32_PCLMUL
+        /**
+         * Loads the unaligned 128-bit vector
+         *
+         * @param address the address of the vector
+         * @return the loaded vector
+         */
+        __attribute__((target("pclmul,sse4.1")))
+        static inline __m128i load(uint8 const* address) noexcept {
+            return _mm_loadu_si128(
+                reinterpret_cast<__m128i const*>(address));
+        }
+
+        /**
+         * Folds the 128-bit crc vector over the next vector
+         *
+         * @param x the folded vector
+         * @param k the folding constants
+         * @param next the next vector
+         * @return the folded vector
+         */
+        __attribute__((target("pclmul,sse4.1")))
+        static inline __m128i fold(
+            __m128i x,
+            __m128i k,
+            __m128i next) noexcept
+        {
+            return _mm_xor_si128(_mm_xor_si128(
+                _mm_clmulepi64_si128(x, k, 0x00),
+                _mm_clmulepi64_si128(x, k, 0x11)), next);
+        }
+
+        /**
+         * Folds the 64-byte blocks with the carry-less
+         * multiplication and reduces them with the Barrett
+         * reduction. The length has to be a multiple of sixteen
+         * not lower than 64
+         *
+         * @param crc the crc register
+         * @param data the pointer to the bytes
+         * @param length the number of the bytes
+         * @return the updated crc register
+         */
+        __attribute__((target("pclmul,sse4.1")))
+        static uint32 crc32Folding(
+            uint32 crc,
+            uint8 const* data,
+            std::size_t length) noexcept
+        {
+            alignas(16) static constexpr const uint64 k1k2[2]
+                = {0x0154442BD4, 0x01C6E41596};
+            alignas(16) static constexpr const uint64 k3k4[2]
+                = {0x01751997D0, 0x00CCAA009E};
+            alignas(16) static constexpr const uint64 k5k0[2]
+                = {0x0163CD6124, 0x0000000000};
+            alignas(16) static constexpr const uint64 poly[2]
+                = {0x01DB710641, 0x01F7011641};
+
+            __m128i x1 = _mm_xor_si128(load(data),
+                _mm_cvtsi32_si128(static_cast<int32>(crc)));
+            __m128i x2 = load(data + 16);
+            __m128i x3 = load(data + 32);
+            __m128i x4 = load(data + 48);
+            __m128i k = _mm_load_si128(
+                reinterpret_cast<__m128i const*>(k1k2));
+            for (data += 64, length -= 64; length >= 64;
+                data += 64, length -= 64)
+            {
+                x1 = fold(x1, k, load(data));
+                x2 = fold(x2, k, load(data + 16));
+                x3 = fold(x3, k, load(data + 32));
+                x4 = fold(x4, k, load(data + 48));
+            }
+            k = _mm_load_si128(reinterpret_cast<__m128i const*>(k3k4));
+            x1 = fold(x1, k, x2);
+            x1 = fold(x1, k, x3);
+            x1 = fold(x1, k, x4);
+            for (; length >= 16; data += 16, length -= 16)
+                x1 = fold(x1, k, load(data));
+            // folds 128 bits into 64 bits
+            __m128i mask = _mm_setr_epi32(~0, 0, ~0, 0);
+            x2 = _mm_clmulepi64_si128(x1, k, 0x10);
+            x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+            k = _mm_loadl_epi64(reinterpret_cast<__m128i const*>(k5k0));
+            x2 = _mm_srli_si128(x1, 4);
+            x1 = _mm_xor_si128(_mm_clmulepi64_si128(
+                _mm_and_si128(x1, mask), k, 0x00), x2);
+            // the Barrett reduction into 32 bits
+            k = _mm_load_si128(reinterpret_cast<__m128i const*>(poly));
+            x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask), k, 0x10);
+            x2 = _mm_clmulepi64_si128(_mm_and_si128(x2, mask), k, 0x00);
+            return static_cast<uint32>(
+                _mm_extract_epi32(_mm_xor_si128(x1, x2), 1));
+        }
+
+        /**
+         * Returns the carry-less multiplication kernel when
+         * the processor supports it
+         *
+         * @return the crc kernel or nullptr
+         */
+        static CRC32Kernel chooseCRC32Kernel(void) noexcept {
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("pclmul")
+                && __builtin_cpu_supports("sse4.1"))
+                    return crc32Folding;
+            return nullptr;
+        }
+        #elif defined(MPGL_CRC32_ARMV8)
+        /**
+         * Updates the crc register using the ARMv8 CRC32
+         * instructions
+         *
+         * @param crc the crc register
+         * @param data the pointer to the bytes
+         * @param length the number of the bytes
+         * @return the updated crc register
+         */
+        __attribute__((target("+crc")))
+        static uint32 crc32Instructions(
+            uint32 crc,
+            uint8 const* data,
+            std::size_t length) noexcept
+        {
+            for (uint64 word; length >= 8; data += 8, length -= 8) {
+                std::memcpy(&word, data, 8);
+                crc = __crc32d(crc, word);
+            }
+            for (; length; --length)
+                crc = __crc32b(crc, *data++);
+            return crc;
+        }
+
+        /**
+         * Returns the CRC32 instructions kernel when
+         * the processor supports them
+         *
+         * @return the crc kernel or nullptr
+         */
+        static CRC32Kernel chooseCRC32Kernel(void) noexcept {
+            #if defined(__linux__)
+            if (getauxval(AT_HWCAP) & HWCAP_CRC32)
+                return crc32Instructions;
+            return nullptr;
+            #elif defined(__ARM_FEATURE_CRC32) || defined(__APPLE__)
+            return crc32Instructions;
+            #else
+            return nullptr;
+            #endif
+        }
+        #else
+        /**
+         * Returns the hardware kernel, which is not available
+         * on this platform
+         *
+         * @return nullptr
+         */
+        static CRC32Kernel chooseCRC32Kernel(void) noexcept {
+            return nullptr;
+        }
+        #endif
+
+    }
+
+    [[nodiscard]] uint32 CRC32::update(
+        uint32 crc,
+        uint8 const* data,
+        size_type length) noexcept
+    {
+        /// Below this length the kernel setup is not worth it
+        static constexpr const size_type MinKernelLength = 64;
+
+        static details::CRC32Kernel const kernel
+            = details::chooseCRC32Kernel();
+        if (kernel && length >= MinKernelLength) {
+            size_type bulk = length & ~size_type{15};
+            crc = kernel(crc, data, bulk);
+            data += bulk;
+            length -= bulk;
+        }
+        return updateSliced(crc, data, length);
+    }
+
+    [[nodiscard]] uint32 CRC32::updateSliced(
+        uint32 crc,
+        uint8 const* data,
+        size_type length) noexcept
+    {
+        auto word = [](uint8 const* bytes) -> uint32 {
+            return bytes[0] | (bytes[1] << 8) | (bytes[2] << 16)
+                | (static_cast<uint32>(bytes[3]) << 24);
+        };
+        for (; length >= 16; data += 16, length -= 16) {
+            uint32 first = crc ^ word(data);
+            uint32 second = word(data + 4);
+            uint32 third = word(data + 8);
+            uint32 fourth = word(data + 12);
+            crc = lookup[15][first & 0xFF]
+                ^ lookup[14][(first >> 8) & 0xFF]
+                ^ lookup[13][(first >> 16) & 0xFF]
+                ^ lookup[12][first >> 24]
+                ^ lookup[11][second & 0xFF]
+                ^ lookup[10][(second >> 8) & 0xFF]
+                ^ lookup[9][(second >> 16) & 0xFF]
+                ^ lookup[8][second >> 24]
+                ^ lookup[7][third & 0xFF]
+                ^ lookup[6][(third >> 8) & 0xFF]
+                ^ lookup[5][(third >> 16) & 0xFF]
+                ^ lookup[4][third >> 24]
+                ^ lookup[3][fourth & 0xFF]
+                ^ lookup[2][(fourth >> 8) & 0xFF]
+                ^ lookup[1][(fourth >> 16) & 0xFF]
+                ^ lookup[0][fourth >> 24];
+        }
+        for (; length; --length)
+            crc = (crc >> 8) ^ lookup[0][(*data++ ^ crc) & 0xFF];
+        return crc;
+    }
+
+    [[nodiscard]] uint32 CRC32::multiply(
+        uint32 left,
+        uint32 right) noexcept
+    {
+        // the polynomials are reflected - x^0 is the highest bit
+        uint32 product = 0;
+        for (uint32 mask = 1u << 31; mask; mask >>= 1) {
+            if (left & mask)
+                product ^= right;
+            right = (right & 1) ? (right >> 1) ^ Polynomial : right >> 1;
+        }
+        return product;
+    }
+
+    [[nodiscard]] uint32 CRC32::combine(
+        uint32 first,
+        uint32 second,
+        size_type secondLength) noexcept
+    {
+        // multiplies the first crc by x^(8 * secondLength)
+        uint32 power = 1u << 31;
+        for (uint32 square = 1u << 23; secondLength;
+            secondLength >>= 1, square = multiply(square, square))
+        {
+            if (secondLength & 1)
+                power = multiply(power, square);
+        }
+        return multiply(first, power) ^ second;
+    }
 
 }
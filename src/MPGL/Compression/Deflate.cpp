@@ -0,0 +1,546 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#include <MPGL/Compression/Deflate.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <bit>
+
+namespace mpgl {
+
+    Deflate::LengthCodes const Deflate::lengthCodes
+        = createLengthCodes();
+
+    Deflate::DistanceCodes const Deflate::distanceCodes
+        = createDistanceCodes();
+
+    Deflate::HuffmanCode const Deflate::fixedLiteralCode = []() {
+        Lengths lengths(MaxAlphabetLength, 8);
+        std::fill(lengths.begin() + 144, lengths.begin() + 256, 9);
+        std::fill(lengths.begin() + 256, lengths.begin() + 280, 7);
+        return HuffmanCode{std::move(lengths)};
+    }();
+
+    Deflate::HuffmanCode const Deflate::fixedDistanceCode
+        = HuffmanCode{Lengths(distances.size(), 5)};
+
+    [[nodiscard]] Deflate::LengthCodes Deflate::createLengthCodes(
+        void) noexcept
+    {
+        LengthCodes codes;
+        for (uint8 code = 0; code != extraLength.size(); ++code) {
+            auto const& [bits, base] = extraLength[code];
+            for (uint16 i = 0; i != (1u << bits); ++i)
+                if (base + i <= MaxMatchLength)
+                    codes[base + i - MinMatchLength] = code;
+        }
+        return codes;
+    }
+
+    [[nodiscard]] Deflate::DistanceCodes Deflate::createDistanceCodes(
+        void) noexcept
+    {
+        DistanceCodes codes;
+        for (uint8 code = 0; code != distances.size(); ++code) {
+            auto const& [bits, base] = distances[code];
+            for (uint32 i = 0; i != (1u << bits); ++i) {
+                uint32 distance = base + i - 1;
+                if (distance < 256)
+                    codes[distance] = code;
+                else
+                    codes[256 + (distance >> 7)] = code;
+            }
+        }
+        return codes;
+    }
+
+    [[nodiscard]] uint8 Deflate::distanceCode(
+        uint16 distance) noexcept
+    {
+        --distance;
+        return distance < 256 ? distanceCodes[distance]
+            : distanceCodes[256 + (distance >> 7)];
+    }
+
+    [[nodiscard]] Deflate::Parameters const& Deflate::getParameters(
+        CompressionLevel level) noexcept
+    {
+        static constexpr const std::array<Parameters, 5> parameters{
+            Parameters{0, 0, 0, 0, false},
+            Parameters{4, 4, 8, 4, false},
+            Parameters{4, 6, 32, 32, false},
+            Parameters{8, 16, 128, 128, true},
+            Parameters{32, 258, 258, 4096, true}
+        };
+        return parameters[static_cast<uint8>(level)];
+    }
+
+    Deflate::HuffmanCode::HuffmanCode(Lengths lengths)
+        : lengths{std::move(lengths)}, codes(this->lengths.size())
+    {
+        std::array<uint16, MaxCodeLength + 1> counts{};
+        std::array<uint16, MaxCodeLength + 1> next{};
+        for (uint8 length : this->lengths)
+            ++counts[length];
+        counts[0] = 0;
+        uint16 code = 0;
+        for (uint8 bits = 1; bits <= MaxCodeLength; ++bits)
+            next[bits] = code = (code + counts[bits - 1]) << 1;
+        for (size_type i = 0; i != codes.size(); ++i) {
+            if (uint8 length = this->lengths[i]) {
+                uint16 code = next[length]++, reversed = 0;
+                for (uint8 j = 0; j != length; ++j, code >>= 1)
+                    reversed = (reversed << 1) | (code & 1);
+                codes[i] = reversed;
+            }
+        }
+    }
+
+    [[nodiscard]] Deflate::HuffmanCode
+        Deflate::HuffmanCode::fromFrequencies(
+            Frequencies const& frequencies,
+            uint8 maxLength)
+    {
+        std::vector<uint16> symbols;
+        for (uint16 i = 0; i != frequencies.size(); ++i)
+            if (frequencies[i])
+                symbols.push_back(i);
+        for (uint16 i = 0; symbols.size() < 2; ++i)
+            if (std::ranges::find(symbols, i) == symbols.end())
+                symbols.push_back(i);
+        std::ranges::stable_sort(symbols, [&](auto left, auto right)
+            { return frequencies[left] < frequencies[right]; });
+        Frequencies depths(symbols.size());
+        std::ranges::transform(symbols, depths.begin(),
+            [&](auto symbol) { return frequencies[symbol]; });
+        // in-place minimum redundancy codes [Moffat, Katajainen]
+        int64 size = depths.size(), root = 0, leaf = 2, next = 1;
+        depths[0] += depths[1];
+        for (; next < size - 1; ++next) {
+            if (leaf >= size || depths[root] < depths[leaf]) {
+                depths[next] = depths[root];
+                depths[root++] = next;
+            } else
+                depths[next] = depths[leaf++];
+            if (leaf >= size || (root < next
+                && depths[root] < depths[leaf]))
+            {
+                depths[next] += depths[root];
+                depths[root++] = next;
+            } else
+                depths[next] += depths[leaf++];
+        }
+        depths[size - 2] = 0;
+        for (next = size - 3; next >= 0; --next)
+            depths[next] = depths[depths[next]] + 1;
+        int64 available = 1, used = 0;
+        uint32 depth = 0;
+        for (root = size - 2, next = size - 1; available > 0;
+            available = 2 * used, ++depth, used = 0)
+        {
+            for (; root >= 0 && depths[root] == depth; --root)
+                ++used;
+            for (; available > used; --available)
+                depths[next--] = depth;
+        }
+        // limits the code lengths keeping the code complete
+        std::array<uint32, 33> counts{};
+        for (uint32 length : depths)
+            ++counts[std::min<uint32>(length, maxLength)];
+        uint32 total = 0;
+        for (uint8 i = 1; i <= maxLength; ++i)
+            total += counts[i] << (maxLength - i);
+        for (; total > (1u << maxLength); --total) {
+            --counts[maxLength];
+            for (uint8 i = maxLength - 1; i; --i) {
+                if (counts[i]) {
+                    --counts[i];
+                    counts[i + 1] += 2;
+                    break;
+                }
+            }
+        }
+        Lengths lengths(frequencies.size());
+        auto symbol = symbols.rbegin();
+        for (uint8 length = 1; length <= maxLength; ++length)
+            for (uint32 i = 0; i != counts[length]; ++i)
+                lengths[*symbol++] = length;
+        return HuffmanCode{std::move(lengths)};
+    }
+
+    Deflate::MatchFinder::MatchFinder(
+        InputSpan input,
+        Parameters const& parameters)
+            : head(1u << 15, NoPosition),
+            previous(MaxDistance, NoPosition),
+            input{input}, parameters{parameters} {}
+
+    [[nodiscard]] uint32 Deflate::MatchFinder::hash(
+        size_type position) const noexcept
+    {
+        uint32 bytes = static_cast<uint8>(input[position])
+            | (static_cast<uint8>(input[position + 1]) << 8)
+            | (static_cast<uint8>(input[position + 2]) << 16);
+        return (bytes * 2654435761u) >> 17;
+    }
+
+    Deflate::MatchFinder::Position Deflate::MatchFinder::insert(
+        size_type position) noexcept
+    {
+        Position& first = head[hash(position)];
+        Position candidate = first;
+        previous[position & (MaxDistance - 1)] = candidate;
+        first = position;
+        return candidate;
+    }
+
+    [[nodiscard]] uint16 Deflate::MatchFinder::matchLength(
+        size_type first,
+        size_type second,
+        uint16 maxLength) const noexcept
+    {
+        uint16 length = 0;
+        for (uint64 left, right; length + 8 <= maxLength; length += 8) {
+            std::memcpy(&left, input.data() + first + length, 8);
+            std::memcpy(&right, input.data() + second + length, 8);
+            if (uint64 difference = left ^ right) {
+                if constexpr (std::endian::native == std::endian::little)
+                    return length + std::countr_zero(difference) / 8;
+                else
+                    return length + std::countl_zero(difference) / 8;
+            }
+        }
+        while (length < maxLength
+            && input[first + length] == input[second + length])
+                ++length;
+        return length;
+    }
+
+    [[nodiscard]] Deflate::Token Deflate::MatchFinder::findMatch(
+        size_type position,
+        Position candidate,
+        uint16 length) const noexcept
+    {
+        Token best{length, 0};
+        uint16 maxLength = std::min<size_type>(
+            MaxMatchLength, input.size() - position);
+        if (maxLength <= length)
+            return best;
+        uint16 niceLength = std::min(parameters.niceLength, maxLength);
+        uint32 chain = length >= parameters.goodLength
+            ? parameters.maxChain >> 2 : parameters.maxChain;
+        Position limit = position > MaxDistance
+            ? position - MaxDistance : 0;
+        while (candidate >= limit && chain--) {
+            if (input[candidate + best.length]
+                == input[position + best.length])
+            {
+                uint16 matched = matchLength(candidate, position,
+                    maxLength);
+                if (matched > best.length) {
+                    best = {matched,
+                        static_cast<uint16>(position - candidate)};
+                    if (matched >= niceLength)
+                        break;
+                }
+            }
+            Position next = previous[candidate & (MaxDistance - 1)];
+            if (next >= candidate)
+                break;
+            candidate = next;
+        }
+        return best;
+    }
+
+    [[nodiscard]] Deflate::Buffer Deflate::operator()(
+        InputSpan input) const
+    {
+        Buffer output;
+        output.reserve(input.size() / 2 + 64);
+        (*this)(input, output);
+        return output;
+    }
+
+    void Deflate::operator()(InputSpan input, Buffer& output) const {
+        Writer writer{std::back_inserter(output)};
+        if (level == CompressionLevel::Store)
+            writeStored(input, true, writer);
+        else
+            compress(input, getParameters(level), writer);
+        writer.flush();
+    }
+
+    void Deflate::writeStored(
+        InputSpan input,
+        bool final,
+        Writer& writer)
+    {
+        do {
+            size_type length = std::min(input.size(), MaxStoredLength);
+            writer.writeBits(final && length == input.size(), 1);
+            writer.writeBits(0, 2);
+            writer.alignToByte();
+            writer.writeBits(length, 16);
+            writer.writeBits(~length, 16);
+            writer.writeBytes(input.first(length));
+            input = input.subspan(length);
+        } while (!input.empty());
+    }
+
+    void Deflate::compress(
+        InputSpan input,
+        Parameters const& parameters,
+        Writer& writer)
+    {
+        /// Matches of the minimal length are not worth it above
+        static constexpr const uint16 TooFar = 4096;
+
+        MatchFinder finder{input, parameters};
+        Tokens tokens;
+        tokens.reserve(MaxBlockTokens);
+        size_type blockBegin = 0, covered = 0;
+        auto push = [&](Token const& token) {
+            tokens.push_back(token);
+            covered += token.distance ? token.length : 1;
+            if (tokens.size() == MaxBlockTokens) {
+                writeBlock(tokens, input.subspan(blockBegin,
+                    covered - blockBegin), false, writer);
+                tokens.clear();
+                blockBegin = covered;
+            }
+        };
+        auto insertRange = [&](size_type position, size_type end) {
+            end = std::min(end, input.size() - MinMatchLength + 1);
+            for (; position < end; ++position)
+                finder.insert(position);
+        };
+        auto literal = [&](size_type position) -> Token
+            { return {static_cast<uint8>(input[position]), 0}; };
+        if (!parameters.lazy) {
+            for (size_type position = 0; position < input.size();) {
+                Token match{0, 0};
+                if (input.size() - position >= MinMatchLength)
+                    match = finder.findMatch(position,
+                        finder.insert(position), MinMatchLength - 1);
+                if (match.distance) {
+                    push(match);
+                    if (match.length <= parameters.maxLazy)
+                        insertRange(position + 1,
+                            position + match.length);
+                    position += match.length;
+                } else
+                    push(literal(position++));
+            }
+        } else {
+            Token previous{MinMatchLength - 1, 0};
+            bool pending = false;
+            for (size_type position = 0; position < input.size();
+                ++position)
+            {
+                Token match{MinMatchLength - 1, 0};
+                if (input.size() - position >= MinMatchLength) {
+                    auto candidate = finder.insert(position);
+                    if (previous.length < parameters.maxLazy) {
+                        Token found = finder.findMatch(position,
+                            candidate, previous.length);
+                        if (found.distance && (found.length
+                            > MinMatchLength || found.distance <= TooFar))
+                                match = found;
+                    }
+                }
+                if (previous.distance && match.length <= previous.length)
+                {
+                    size_type end = position - 1 + previous.length;
+                    push(previous);
+                    insertRange(position + 1, end);
+                    position = end - 1;
+                    previous = {MinMatchLength - 1, 0};
+                    pending = false;
+                } else {
+                    if (pending)
+                        push(literal(position - 1));
+                    previous = match;
+                    pending = true;
+                }
+            }
+            if (pending)
+                push(literal(input.size() - 1));
+        }
+        writeBlock(tokens, input.subspan(blockBegin), true, writer);
+    }
+
+    [[nodiscard]] Deflate::size_type Deflate::tokensCost(
+        Tokens const& tokens,
+        HuffmanCode const& literals,
+        HuffmanCode const& distances) noexcept
+    {
+        size_type cost = literals.lengths[BlockEnd];
+        for (auto const& [length, distance] : tokens) {
+            if (!distance) {
+                cost += literals.lengths[length];
+                continue;
+            }
+            uint8 code = lengthCode(length);
+            uint8 distanceIndex = distanceCode(distance);
+            cost += literals.lengths[BlockEnd + 1 + code]
+                + extraLength[code].first
+                + distances.lengths[distanceIndex]
+                + DeflateTables::distances[distanceIndex].first;
+        }
+        return cost;
+    }
+
+    [[nodiscard]] Deflate::LengthTokens Deflate::encodeLengths(
+        Lengths const& lengths)
+    {
+        LengthTokens tokens;
+        for (size_type i = 0; i != lengths.size();) {
+            uint8 length = lengths[i];
+            size_type run = 1;
+            while (i + run != lengths.size() && lengths[i + run] == length)
+                ++run;
+            i += run;
+            if (!length) {
+                for (; run >= 11; run -= std::min<size_type>(run, 138))
+                    tokens.push_back({18, static_cast<uint8>(
+                        std::min<size_type>(run, 138) - 11)});
+                if (run >= 3) {
+                    tokens.push_back({17, static_cast<uint8>(run - 3)});
+                    run = 0;
+                }
+            } else {
+                tokens.push_back({length, 0});
+                for (--run; run >= 3; run -= std::min<size_type>(run, 6))
+                    tokens.push_back({16, static_cast<uint8>(
+                        std::min<size_type>(run, 6) - 3)});
+            }
+            for (; run; --run)
+                tokens.push_back({length, 0});
+        }
+        return tokens;
+    }
+
+    void Deflate::writeTokens(
+        Tokens const& tokens,
+        HuffmanCode const& literals,
+        HuffmanCode const& distances,
+        Writer& writer)
+    {
+        for (auto const& [length, distance] : tokens) {
+            if (!distance) {
+                writer.writeBits(literals.codes[length],
+                    literals.lengths[length]);
+                continue;
+            }
+            uint8 code = lengthCode(length);
+            uint16 symbol = BlockEnd + 1 + code;
+            auto const& [lengthBits, lengthBase] = extraLength[code];
+            writer.writeBits(literals.codes[symbol]
+                | ((length - lengthBase) << literals.lengths[symbol]),
+                literals.lengths[symbol] + lengthBits);
+            code = distanceCode(distance);
+            auto const& [distanceBits, distanceBase]
+                = DeflateTables::distances[code];
+            writer.writeBits(distances.codes[code]
+                | ((distance - distanceBase) << distances.lengths[code]),
+                distances.lengths[code] + distanceBits);
+        }
+        writer.writeBits(literals.codes[BlockEnd],
+            literals.lengths[BlockEnd]);
+    }
+
+    void Deflate::writeBlock(
+        Tokens const& tokens,
+        InputSpan input,
+        bool final,
+        Writer& writer)
+    {
+        Frequencies literalFrequencies(286), distanceFrequencies(30);
+        literalFrequencies[BlockEnd] = 1;
+        for (auto const& [length, distance] : tokens) {
+            if (distance) {
+                ++literalFrequencies[BlockEnd + 1 + lengthCode(length)];
+                ++distanceFrequencies[distanceCode(distance)];
+            } else
+                ++literalFrequencies[length];
+        }
+        auto literals = HuffmanCode::fromFrequencies(
+            literalFrequencies, MaxCodeLength);
+        auto distances = HuffmanCode::fromFrequencies(
+            distanceFrequencies, MaxCodeLength);
+        size_type literalCount = 286, distanceCount = 30;
+        while (literalCount > 257 && !literals.lengths[literalCount - 1])
+            --literalCount;
+        while (distanceCount > 1 && !distances.lengths[distanceCount - 1])
+            --distanceCount;
+        Lengths lengths{literals.lengths.begin(),
+            literals.lengths.begin() + literalCount};
+        lengths.insert(lengths.end(), distances.lengths.begin(),
+            distances.lengths.begin() + distanceCount);
+        auto lengthTokens = encodeLengths(lengths);
+        Frequencies lengthFrequencies(dynamicCodesOrder.size());
+        for (auto const& [symbol, extra] : lengthTokens)
+            ++lengthFrequencies[symbol];
+        auto lengthsCode = HuffmanCode::fromFrequencies(
+            lengthFrequencies, MaxLengthCodeLength);
+        size_type lengthCodesCount = dynamicCodesOrder.size();
+        while (lengthCodesCount > 4 && !lengthsCode.lengths[
+            dynamicCodesOrder[lengthCodesCount - 1]])
+                --lengthCodesCount;
+        static constexpr const std::array<uint8, 3> repeatBits{2, 3, 7};
+        size_type dynamicCost = 17 + 3 * lengthCodesCount
+            + tokensCost(tokens, literals, distances);
+        for (auto const& [symbol, extra] : lengthTokens)
+            dynamicCost += lengthsCode.lengths[symbol]
+                + (symbol >= 16 ? repeatBits[symbol - 16] : 0);
+        size_type fixedCost = 3 + tokensCost(tokens, fixedLiteralCode,
+            fixedDistanceCode);
+        size_type storedCost = (input.size() + 5 * (1 + input.size()
+            / MaxStoredLength)) * 8;
+        if (storedCost <= std::min(dynamicCost, fixedCost))
+            return writeStored(input, final, writer);
+        writer.writeBits(final, 1);
+        if (fixedCost <= dynamicCost) {
+            writer.writeBits(1, 2);
+            return writeTokens(tokens, fixedLiteralCode,
+                fixedDistanceCode, writer);
+        }
+        writer.writeBits(2, 2);
+        writer.writeBits(literalCount - 257, 5);
+        writer.writeBits(distanceCount - 1, 5);
+        writer.writeBits(lengthCodesCount - 4, 4);
+        for (size_type i = 0; i != lengthCodesCount; ++i)
+            writer.writeBits(lengthsCode.lengths[dynamicCodesOrder[i]], 3);
+        for (auto const& [symbol, extra] : lengthTokens) {
+            writer.writeBits(lengthsCode.codes[symbol],
+                lengthsCode.lengths[symbol]);
+            if (symbol >= 16)
+                writer.writeBits(extra, repeatBits[symbol - 16]);
+        }
+        writeTokens(tokens, literals, distances, writer);
+    }
+
+}
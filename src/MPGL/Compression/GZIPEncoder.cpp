@@ -0,0 +1,130 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#include <MPGL/Compression/Checksums/CRC32.hpp>
+#include <MPGL/Compression/GZIPEncoder.hpp>
+
+#include <algorithm>
+
+namespace mpgl {
+
+    void GZIPEncoder::saveLittleEndian(uint32 value, Buffer& output) {
+        for (uint8 i = 0; i != 4; ++i, value >>= 8)
+            output.push_back(static_cast<char>(value & 0xFF));
+    }
+
+    void GZIPEncoder::writeMember(
+        InputSpan input,
+        Buffer& output,
+        bool blockSize,
+        bool name) const
+    {
+        /// The extra field flag
+        static constexpr const char FExtra = 0x04;
+        /// The name flag
+        static constexpr const char FName = 0x08;
+        /// The unknown operating system
+        static constexpr const char UnknownSystem = '\xFF';
+
+        size_type const begin = output.size();
+        name = name && oryginalName;
+        output.insert(output.end(), {'\x1F', '\x8B', '\x08',
+            static_cast<char>((blockSize ? FExtra : 0)
+                | (name ? FName : 0))});
+        saveLittleEndian(modificationTime, output);
+        switch (getCompressionLevel()) {
+            case CompressionLevel::Maximum:
+                output.push_back('\x02');
+                break;
+            case CompressionLevel::Fastest:
+                output.push_back('\x04');
+                break;
+            default:
+                output.push_back('\x00');
+        }
+        output.push_back(UnknownSystem);
+        if (blockSize) // the block size is filled after compression
+            output.insert(output.end(), {'\x06', '\x00', 'B', 'C',
+                '\x02', '\x00', '\x00', '\x00'});
+        if (name) {
+            output.insert(output.end(), oryginalName->begin(),
+                oryginalName->end());
+            output.push_back('\0');
+        }
+        deflate(input, output);
+        saveLittleEndian(crc32(input), output);
+        saveLittleEndian(static_cast<uint32>(input.size()), output);
+        if (!blockSize)
+            return;
+        if (size_type size = output.size() - begin - 1; size > 0xFFFF) {
+            // the block size does not fit, the member stays plain
+            output[begin + 3] &= ~FExtra;
+            output.erase(output.begin() + begin + 10,
+                output.begin() + begin + 18);
+        } else {
+            output[begin + 16] = static_cast<char>(size & 0xFF);
+            output[begin + 17] = static_cast<char>(size >> 8);
+        }
+    }
+
+    [[nodiscard]] GZIPEncoder::Buffer GZIPEncoder::operator()(
+        InputSpan input) const
+    {
+        Buffer output;
+        output.reserve(input.size() / 2 + 64);
+        writeMember(input, output, false, true);
+        return output;
+    }
+
+    [[nodiscard]] GZIPEncoder::Buffer GZIPEncoder::operator()(
+        InputSpan input,
+        async::Threadpool& threadpool) const
+    {
+        std::vector<std::future<Buffer>> members;
+        // the first block is shortened so the name fits in the member
+        size_type position = 0, limit = BlockSize - std::min(
+            oryginalName ? oryginalName->size() + 1 : 0, BlockSize / 2);
+        do {
+            auto block = input.subspan(position,
+                std::min(limit, input.size() - position));
+            limit = BlockSize;
+            members.push_back(threadpool.appendTask(
+                [this, block, first = !position]() {
+                    Buffer member;
+                    writeMember(block, member, true, first);
+                    return member;
+                }));
+            position += block.size();
+        } while (position != input.size());
+        Buffer output;
+        output.reserve(input.size() / 2 + 64);
+        for (auto& member : members) {
+            auto data = member.get();
+            output.insert(output.end(), data.begin(), data.end());
+        }
+        return output;
+    }
+
+}
@@ -0,0 +1,146 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#include <MPGL/Exceptions/Inflate/InflateInvalidHeaderException.hpp>
+#include <MPGL/Exceptions/Inflate/InflateDataCorruptionException.hpp>
+#include <MPGL/Exceptions/NotSupportedException.hpp>
+#include <MPGL/Compression/GZIPStreamDecoder.hpp>
+#include <MPGL/Compression/Checksums/CRC32.hpp>
+#include <MPGL/IO/Readers.hpp>
+
+#include <algorithm>
+
+namespace mpgl {
+
+    void GZIPStreamDecoder::reset(void) noexcept {
+        inflate.reset();
+        pending.clear();
+        oryginalName.reset();
+        comment.reset();
+        checksum = size = modificationTime = 0;
+        state = State::Header;
+    }
+
+    GZIPStreamDecoder::OptString GZIPStreamDecoder::parseString(
+        size_type& position) const
+    {
+        auto const begin = pending.begin() + position;
+        auto const end = std::ranges::find(begin, pending.end(), '\0');
+        if (end == pending.end())
+            return std::nullopt;
+        position = end - pending.begin() + 1;
+        return std::string{begin, end};
+    }
+
+    GZIPStreamDecoder::OptSize GZIPStreamDecoder::parseHeader(void) {
+        if (pending.size() < HeaderLength)
+            return std::nullopt;
+        if (peekType<uint16, true>(pending.begin()) != 0x1F8B)
+            throw InflateInvalidHeaderException{};
+        if (pending[2] != 0x08)
+            throw NotSupportedException{
+                "Not DEFLATE compressed gzip files are not valid"};
+        uint8 const flags = static_cast<uint8>(pending[3]);
+        size_type position = HeaderLength;
+        if (flags & 0x04) {
+            if (pending.size() < position + 2)
+                return std::nullopt;
+            position += 2 + peekType<uint16, false>(
+                pending.begin() + position);
+            if (pending.size() < position)
+                return std::nullopt;
+        }
+        if (flags & 0x08)
+            if (!(oryginalName = parseString(position)))
+                return std::nullopt;
+        if (flags & 0x10)
+            if (!(comment = parseString(position)))
+                return std::nullopt;
+        if (flags & 0x02) {
+            if (pending.size() < position + 2)
+                return std::nullopt;
+            uint32 crc = crc32(std::ranges::subrange{pending.begin(),
+                pending.begin() + position});
+            if (peekType<uint16, false>(pending.begin() + position)
+                != (crc & 0x0000FFFF))
+                    throw InflateDataCorruptionException{};
+            position += 2;
+        }
+        modificationTime = peekType<uint32, false>(pending.begin() + 4);
+        return position;
+    }
+
+    GZIPStreamDecoder::size_type GZIPStreamDecoder::readHeader(
+        InputSpan input)
+    {
+        std::ranges::copy(input, std::back_inserter(pending));
+        if (auto length = parseHeader()) {
+            size_type consumed = input.size() - (pending.size() - *length);
+            pending.clear();
+            state = State::Data;
+            return consumed;
+        }
+        return input.size();
+    }
+
+    [[nodiscard]] GZIPStreamDecoder::Result
+        GZIPStreamDecoder::operator()(
+            InputSpan input,
+            OutputSpan output)
+    {
+        size_type consumed = 0, produced = 0;
+        if (state == State::Header) {
+            consumed = readHeader(input);
+            if (state == State::Header)
+                return {consumed, produced, Status::NeedsInput};
+        }
+        if (state == State::Data) {
+            auto result = inflate(input.subspan(consumed), output);
+            consumed += result.consumed;
+            produced = result.produced;
+            checksum = crc32(output.first(produced), checksum);
+            size += produced;
+            if (result.status != Status::Finished)
+                return {consumed, produced, result.status};
+            state = State::Trailer;
+        }
+        if (state == State::Trailer) {
+            size_type length = std::min<size_type>(
+                TrailerLength - pending.size(), input.size() - consumed);
+            std::ranges::copy(input.subspan(consumed, length),
+                std::back_inserter(pending));
+            consumed += length;
+            if (pending.size() < TrailerLength)
+                return {consumed, produced, Status::NeedsInput};
+            if (peekType<uint32, false>(pending.begin()) != checksum
+                || peekType<uint32, false>(pending.begin() + 4) != size)
+                    throw InflateDataCorruptionException{};
+            pending.clear();
+            state = State::Finished;
+        }
+        return {consumed, produced, Status::Finished};
+    }
+
+}
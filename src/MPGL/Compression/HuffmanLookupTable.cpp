@@ -0,0 +1,202 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#include <MPGL/Compression/HuffmanLookupTable.hpp>
+#include <MPGL/Utility/BitReversion.hpp>
+
+#include <algorithm>
+
+namespace mpgl {
+
+    template <bool BigEndian>
+    HuffmanLookupTable<BigEndian>::HuffmanLookupTable(
+        LengthsVector const& lengths,
+        uint8 primaryBits)
+            : entries(std::size_t{1} << primaryBits),
+            primaryBits{primaryBits}
+    {
+        Tokens tokens;
+        tokens.reserve(lengths.size());
+        for (std::size_t i = 0; i < lengths.size(); ++i)
+            if (lengths[i] && lengths[i] <= MaxCodeLength)
+                tokens.push_back(Token{static_cast<uint16>(i),
+                    lengths[i], 0});
+        std::ranges::stable_sort(tokens, {}, &Token::length);
+        assignCodes(tokens);
+        buildTable(tokens);
+    }
+
+    template <bool BigEndian>
+    HuffmanLookupTable<BigEndian>::HuffmanLookupTable(
+        LengthsVector const& counted,
+        SymbolsVector const& characters,
+        uint8 primaryBits)
+            : entries(std::size_t{1} << primaryBits),
+            primaryBits{primaryBits}
+    {
+        Tokens tokens;
+        tokens.reserve(characters.size());
+        auto iter = characters.begin();
+        for (uint8 length = 1; length < counted.size()
+            && length <= MaxCodeLength; ++length)
+        {
+            for (uint8 i = 0; i < counted[length]
+                && iter != characters.end(); ++i)
+                    tokens.push_back(Token{*iter++, length, 0});
+        }
+        assignCodes(tokens);
+        buildTable(tokens);
+    }
+
+    template <bool BigEndian>
+    void HuffmanLookupTable<BigEndian>::assignCodes(
+        Tokens& tokens) noexcept
+    {
+        uint32 code = 0;
+        uint8 length = tokens.empty() ? 0 : tokens.front().length;
+        for (auto& token : tokens) {
+            code <<= token.length - length;
+            length = token.length;
+            token.code = code++;
+        }
+        std::erase_if(tokens, [](Token const& token)
+            { return token.code >= (1u << token.length); });
+    }
+
+    template <bool BigEndian>
+    uint32 HuffmanLookupTable<BigEndian>::primaryIndex(
+        uint32 code,
+        uint8 length) const noexcept
+    {
+        if constexpr (BigEndian)
+            return code >> (length - primaryBits);
+        else
+            return (reverseBits(static_cast<uint16>(code))
+                >> (16 - length)) & ((1u << primaryBits) - 1);
+    }
+
+    template <bool BigEndian>
+    void HuffmanLookupTable<BigEndian>::buildTable(
+        Tokens const& tokens)
+    {
+        allocateSubtables(tokens);
+        for (auto const& token : tokens) {
+            if (token.length > primaryBits)
+                emplaceLongToken(token);
+            else
+                emplaceToken(token);
+        }
+    }
+
+    template <bool BigEndian>
+    void HuffmanLookupTable<BigEndian>::allocateSubtables(
+        Tokens const& tokens)
+    {
+        std::vector<uint8> subtableBits(entries.size(), 0);
+        for (auto const& token : tokens) {
+            if (token.length > primaryBits) {
+                auto& bits = subtableBits[
+                    primaryIndex(token.code, token.length)];
+                bits = std::max<uint8>(bits,
+                    token.length - primaryBits);
+            }
+        }
+        for (std::size_t prefix = 0; prefix < subtableBits.size();
+            ++prefix)
+        {
+            if (uint8 bits = subtableBits[prefix]) {
+                entries[prefix] = Entry{
+                    static_cast<uint16>(entries.size()),
+                    primaryBits, bits};
+                entries.resize(entries.size()
+                    + (std::size_t{1} << bits));
+            }
+        }
+    }
+
+    template <bool BigEndian>
+    void HuffmanLookupTable<BigEndian>::emplaceToken(
+        Token const& token)
+    {
+        uint32 const fill = primaryBits - token.length;
+        for (uint32 i = 0; i < (1u << fill); ++i) {
+            uint32 index;
+            if constexpr (BigEndian)
+                index = (token.code << fill) | i;
+            else
+                index = (reverseBits(static_cast<uint16>(token.code))
+                    >> (16 - token.length)) | (i << token.length);
+            if (!entries[index].subtableBits)
+                entries[index] = Entry{token.symbol, token.length, 0};
+        }
+    }
+
+    template <bool BigEndian>
+    void HuffmanLookupTable<BigEndian>::emplaceLongToken(
+        Token const& token)
+    {
+        auto const& link = entries[
+            primaryIndex(token.code, token.length)];
+        uint32 const suffixLength = token.length - primaryBits;
+        uint32 const fill = link.subtableBits - suffixLength;
+        uint32 const suffix = token.code & ((1u << suffixLength) - 1);
+        for (uint32 i = 0; i < (1u << fill); ++i) {
+            uint32 index;
+            if constexpr (BigEndian)
+                index = (suffix << fill) | i;
+            else
+                index = (reverseBits(static_cast<uint16>(suffix))
+                    >> (16 - suffixLength)) | (i << suffixLength);
+            entries[link.symbol + index]
+                = Entry{token.symbol, token.length, 0};
+        }
+    }
+
+    template <bool BigEndian>
+    [[nodiscard]] HuffmanLookupTable<BigEndian>
+        HuffmanLookupTable<BigEndian>::createDeflateTable(
+            void) requires (!BigEndian)
+    {
+        LengthsVector lengths;
+        lengths.reserve(288);
+        std::ranges::fill_n(std::back_inserter(lengths), 144, 8);
+        std::ranges::fill_n(std::back_inserter(lengths), 112, 9);
+        std::ranges::fill_n(std::back_inserter(lengths), 24, 7);
+        std::ranges::fill_n(std::back_inserter(lengths), 8, 8);
+        return HuffmanLookupTable{lengths};
+    }
+
+    template <bool BigEndian>
+    [[nodiscard]] HuffmanLookupTable<BigEndian>
+        HuffmanLookupTable<BigEndian>::createDeflateDistanceTable(
+            void) requires (!BigEndian)
+    {
+        return HuffmanLookupTable{LengthsVector(32, 5), 5};
+    }
+
+    template class HuffmanLookupTable<false>;
+    template class HuffmanLookupTable<true>;
+
+}
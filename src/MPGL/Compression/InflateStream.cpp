@@ -0,0 +1,441 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#include <MPGL/Exceptions/Inflate/InflateDataCorruptionException.hpp>
+#include <MPGL/Compression/InflateStream.hpp>
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+
+namespace mpgl {
+
+    InflateStream::Decoder const InflateStream::fixedCodeDecoder
+        = Decoder::createDeflateTable();
+
+    InflateStream::Decoder const InflateStream::fixedDistanceDecoder
+        = Decoder::createDeflateDistanceTable();
+
+    InflateStream::InflateStream(void)
+        : window(WindowSize)
+    {
+        reset();
+    }
+
+    void InflateStream::reset(void) noexcept {
+        codeLengthDecoder.reset();
+        dynamicCodeDecoder.reset();
+        dynamicDistanceDecoder.reset();
+        bitBuffer = 0;
+        windowPosition = windowFill = 0;
+        matchDistance = matchLength = storedLength = 0;
+        literalCount = distanceCount = index = 0;
+        bitCount = codeLengthCount = 0;
+        state = State::BlockHeader;
+        finalBlock = fixedBlock = false;
+    }
+
+    [[nodiscard]] InflateStream::Result InflateStream::operator()(
+        InputSpan input,
+        OutputSpan output)
+    {
+        Buffers buffers{input, output};
+        while (state != State::Finished && step(buffers));
+        updateWindow(output.first(buffers.outputPosition));
+        return {buffers.inputPosition, buffers.outputPosition,
+            state == State::Finished ? Status::Finished
+                : buffers.status};
+    }
+
+    bool InflateStream::step(Buffers& buffers) {
+        switch (state) {
+            case State::BlockHeader:
+                return readBlockHeader(buffers);
+            case State::StoredHeader:
+                return readStoredHeader(buffers);
+            case State::StoredCopy:
+                return copyStored(buffers);
+            case State::TableHeader:
+                return readTableHeader(buffers);
+            case State::CodeLengthCodes:
+                return readCodeLengthCodes(buffers);
+            case State::CodeLengths:
+                return readCodeLengths(buffers);
+            case State::Codes:
+                return readCodes(buffers);
+            case State::Distance:
+                return readDistance(buffers);
+            case State::Copy:
+                return copyMatch(buffers);
+            default:
+                return false;
+        }
+    }
+
+    bool InflateStream::pullByte(Buffers& buffers) noexcept {
+        if (!buffers.inputLeft())
+            return false;
+        bitBuffer |= uint64{static_cast<uint8>(
+            buffers.input[buffers.inputPosition++])} << bitCount;
+        bitCount += CHAR_BIT;
+        return true;
+    }
+
+    bool InflateStream::needBits(
+        Buffers& buffers,
+        uint8 length) noexcept
+    {
+        while (bitCount < length)
+            if (!pullByte(buffers))
+                return false;
+        return true;
+    }
+
+    uint32 InflateStream::takeBits(uint8 length) noexcept {
+        uint32 bits = bitBuffer & ((uint64{1} << length) - 1);
+        bitBuffer >>= length;
+        bitCount -= length;
+        return bits;
+    }
+
+    InflateStream::OptSymbol InflateStream::peekSymbol(
+        Buffers& buffers,
+        Decoder const& decoder)
+    {
+        for (;;) {
+            auto symbol = decoder.decode(static_cast<uint32>(bitBuffer));
+            if (symbol.second && symbol.second <= bitCount)
+                return symbol;
+            if (bitCount >= Decoder::MaxCodeLength)
+                throw InflateDataCorruptionException{};
+            if (!pullByte(buffers))
+                return std::nullopt;
+        }
+    }
+
+    bool InflateStream::readBlockHeader(Buffers& buffers) {
+        if (!needBits(buffers, 3))
+            return false;
+        finalBlock = takeBits(1);
+        switch (takeBits(2)) {
+            case 0:
+                takeBits(bitCount % CHAR_BIT);
+                state = State::StoredHeader;
+                break;
+            case 1:
+                fixedBlock = true;
+                state = State::Codes;
+                break;
+            case 2:
+                fixedBlock = false;
+                state = State::TableHeader;
+                break;
+            default:
+                throw InflateDataCorruptionException{};
+        }
+        return true;
+    }
+
+    bool InflateStream::readStoredHeader(Buffers& buffers) {
+        if (!needBits(buffers, 32))
+            return false;
+        storedLength = takeBits(16);
+        if (storedLength != 0xFFFF - takeBits(16))
+            throw InflateDataCorruptionException{};
+        state = State::StoredCopy;
+        return true;
+    }
+
+    bool InflateStream::copyStored(Buffers& buffers) {
+        for (; storedLength && bitCount; --storedLength) {
+            if (!buffers.outputLeft()) {
+                buffers.status = Status::NeedsOutput;
+                return false;
+            }
+            buffers.output[buffers.outputPosition++]
+                = static_cast<char>(takeBits(CHAR_BIT));
+        }
+        size_type length = std::min<size_type>({storedLength,
+            buffers.inputLeft(), buffers.outputLeft()});
+        std::memcpy(buffers.output.data() + buffers.outputPosition,
+            buffers.input.data() + buffers.inputPosition, length);
+        buffers.inputPosition += length;
+        buffers.outputPosition += length;
+        storedLength -= length;
+        if (!storedLength) {
+            endBlock();
+            return true;
+        }
+        if (!buffers.outputLeft())
+            buffers.status = Status::NeedsOutput;
+        return false;
+    }
+
+    bool InflateStream::readTableHeader(Buffers& buffers) {
+        if (!needBits(buffers, 14))
+            return false;
+        literalCount = 257 + takeBits(5);
+        distanceCount = 1 + takeBits(5);
+        codeLengthCount = 4 + takeBits(4);
+        if (literalCount > 286 || distanceCount > 30)
+            throw InflateDataCorruptionException{};
+        codeLengthCodes.fill(0);
+        index = 0;
+        state = State::CodeLengthCodes;
+        return true;
+    }
+
+    bool InflateStream::readCodeLengthCodes(Buffers& buffers) {
+        for (; index < codeLengthCount; ++index) {
+            if (!needBits(buffers, 3))
+                return false;
+            codeLengthCodes[dynamicCodesOrder[index]] = takeBits(3);
+        }
+        codeLengthDecoder.emplace(codeLengthCodes, 7);
+        codeLengths.assign(literalCount + distanceCount, 0);
+        index = 0;
+        state = State::CodeLengths;
+        return true;
+    }
+
+    bool InflateStream::readCodeLengths(Buffers& buffers) {
+        while (index < codeLengths.size()) {
+            auto symbol = peekSymbol(buffers, *codeLengthDecoder);
+            if (!symbol)
+                return false;
+            auto [token, length] = *symbol;
+            if (token < 16) {
+                takeBits(length);
+                codeLengths[index++] = token;
+                continue;
+            }
+            uint8 extraBits = token == 16 ? 2 : token == 17 ? 3 : 7;
+            if (!needBits(buffers, length + extraBits))
+                return false;
+            takeBits(length);
+            uint16 repeat = takeBits(extraBits)
+                + (token == 18 ? 11 : 3);
+            if (token == 16 && !index)
+                throw InflateDataCorruptionException{};
+            if (index + repeat > codeLengths.size())
+                throw InflateDataCorruptionException{};
+            uint8 value = token == 16 ? codeLengths[index - 1] : 0;
+            std::fill_n(codeLengths.begin() + index, repeat, value);
+            index += repeat;
+        }
+        buildDynamicDecoders();
+        state = State::Codes;
+        return true;
+    }
+
+    void InflateStream::buildDynamicDecoders(void) {
+        if (!codeLengths[BlockEnd])
+            throw InflateDataCorruptionException{};
+        auto const middle = codeLengths.begin() + literalCount;
+        dynamicCodeDecoder.emplace(std::ranges::subrange{
+            codeLengths.begin(), middle});
+        dynamicDistanceDecoder.emplace(std::ranges::subrange{
+            middle, codeLengths.end()});
+        codeLengthDecoder.reset();
+    }
+
+    bool InflateStream::readCodes(Buffers& buffers) {
+        for (;;) {
+            if (buffers.inputLeft() >= sizeof(uint64)
+                && buffers.outputLeft() >= MaxMatchLength)
+            {
+                fastLoop(buffers);
+                if (state != State::Codes)
+                    return true;
+            }
+            auto symbol = peekSymbol(buffers, lengthDecoder());
+            if (!symbol)
+                return false;
+            auto [token, length] = *symbol;
+            if (token < BlockEnd) {
+                if (!buffers.outputLeft()) {
+                    buffers.status = Status::NeedsOutput;
+                    return false;
+                }
+                takeBits(length);
+                buffers.output[buffers.outputPosition++]
+                    = static_cast<char>(token);
+                continue;
+            }
+            if (token == BlockEnd) {
+                takeBits(length);
+                endBlock();
+                return true;
+            }
+            if (token - 257u >= extraLength.size())
+                throw InflateDataCorruptionException{};
+            auto [extraBits, base] = extraLength[token - 257];
+            if (!needBits(buffers, length + extraBits))
+                return false;
+            takeBits(length);
+            matchLength = base + takeBits(extraBits);
+            state = State::Distance;
+            return true;
+        }
+    }
+
+    bool InflateStream::readDistance(Buffers& buffers) {
+        auto symbol = peekSymbol(buffers, distanceDecoder());
+        if (!symbol)
+            return false;
+        auto [token, length] = *symbol;
+        if (token >= distances.size())
+            throw InflateDataCorruptionException{};
+        auto [extraBits, base] = distances[token];
+        if (!needBits(buffers, length + extraBits))
+            return false;
+        takeBits(length);
+        matchDistance = base + takeBits(extraBits);
+        checkDistance(buffers);
+        state = State::Copy;
+        return true;
+    }
+
+    bool InflateStream::copyMatch(Buffers& buffers) {
+        for (; matchLength; --matchLength, ++buffers.outputPosition) {
+            if (!buffers.outputLeft()) {
+                buffers.status = Status::NeedsOutput;
+                return false;
+            }
+            buffers.output[buffers.outputPosition]
+                = historyByte(buffers, matchDistance);
+        }
+        state = State::Codes;
+        return true;
+    }
+
+    void InflateStream::fastLoop(Buffers& buffers) {
+        Decoder const& codes = lengthDecoder();
+        Decoder const& distance = distanceDecoder();
+        auto const* input = reinterpret_cast<uint8 const*>(
+            buffers.input.data());
+        char* const output = buffers.output.data();
+        bool blockEnd = false;
+        while (buffers.inputLeft() >= sizeof(uint64)
+            && buffers.outputLeft() >= MaxMatchLength)
+        {
+            uint64 word = 0;
+            for (uint8 i = 0; i < sizeof(uint64); ++i)
+                word |= uint64{input[buffers.inputPosition + i]}
+                    << (i * CHAR_BIT);
+            bitBuffer |= word << bitCount;
+            buffers.inputPosition += (63 - bitCount) / CHAR_BIT;
+            bitCount |= 56;
+            auto [token, length] = codes.decode(
+                static_cast<uint32>(bitBuffer));
+            if (!length)
+                throw InflateDataCorruptionException{};
+            takeBits(length);
+            if (token < BlockEnd) {
+                output[buffers.outputPosition++] = static_cast<char>(token);
+                continue;
+            }
+            if (token == BlockEnd) {
+                blockEnd = true;
+                break;
+            }
+            if (token - 257u >= extraLength.size())
+                throw InflateDataCorruptionException{};
+            auto [lengthBits, lengthBase] = extraLength[token - 257];
+            matchLength = lengthBase + takeBits(lengthBits);
+            auto [distanceToken, distanceLength] = distance.decode(
+                static_cast<uint32>(bitBuffer));
+            if (!distanceLength || distanceToken >= distances.size())
+                throw InflateDataCorruptionException{};
+            takeBits(distanceLength);
+            auto [distanceBits, distanceBase] = distances[distanceToken];
+            matchDistance = distanceBase + takeBits(distanceBits);
+            checkDistance(buffers);
+            if (matchDistance <= buffers.outputPosition) {
+                char* target = output + buffers.outputPosition;
+                char const* source = target - matchDistance;
+                for (uint16 i = 0; i < matchLength; ++i)
+                    target[i] = source[i];
+                buffers.outputPosition += matchLength;
+            } else
+                for (; matchLength; --matchLength)
+                    output[buffers.outputPosition++]
+                        = historyByte(buffers, matchDistance);
+            matchLength = 0;
+        }
+        uint8 spare = bitCount / CHAR_BIT;
+        buffers.inputPosition -= spare;
+        bitCount -= spare * CHAR_BIT;
+        bitBuffer &= (uint64{1} << bitCount) - 1;
+        if (blockEnd)
+            endBlock();
+    }
+
+    void InflateStream::endBlock(void) noexcept {
+        if (finalBlock) {
+            bitBuffer = 0;
+            bitCount = 0;
+            state = State::Finished;
+        } else
+            state = State::BlockHeader;
+    }
+
+    char InflateStream::historyByte(
+        Buffers const& buffers,
+        size_type distance) const noexcept
+    {
+        if (distance <= buffers.outputPosition)
+            return buffers.output[buffers.outputPosition - distance];
+        return window[(windowPosition - (distance
+            - buffers.outputPosition)) & (WindowSize - 1)];
+    }
+
+    void InflateStream::checkDistance(Buffers const& buffers) const {
+        if (matchDistance > buffers.outputPosition + windowFill)
+            throw InflateDataCorruptionException{};
+    }
+
+    void InflateStream::updateWindow(
+        OutputSpan const& produced) noexcept
+    {
+        if (produced.size() >= WindowSize) {
+            std::memcpy(window.data(), produced.data()
+                + produced.size() - WindowSize, WindowSize);
+            windowPosition = 0;
+            windowFill = WindowSize;
+            return;
+        }
+        size_type head = std::min(produced.size(),
+            WindowSize - windowPosition);
+        std::memcpy(window.data() + windowPosition,
+            produced.data(), head);
+        std::memcpy(window.data(), produced.data() + head,
+            produced.size() - head);
+        windowPosition = (windowPosition + produced.size())
+            & (WindowSize - 1);
+        windowFill = std::min(windowFill + produced.size(), WindowSize);
+    }
+
+}
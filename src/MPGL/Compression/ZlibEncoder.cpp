@@ -0,0 +1,55 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#include <MPGL/Compression/Checksums/Adler32.hpp>
+#include <MPGL/Compression/ZlibEncoder.hpp>
+
+#include <algorithm>
+
+namespace mpgl {
+
+    [[nodiscard]] ZlibEncoder::Buffer ZlibEncoder::operator()(
+        InputSpan input) const
+    {
+        /// The DEFLATE method with the 32 KiB window
+        static constexpr const uint8 MethodInfo = 0x78;
+
+        Buffer output;
+        output.reserve(input.size() / 2 + 64);
+        // the stored data is marked as the fastest compression
+        uint8 level = static_cast<uint8>(std::max(
+            static_cast<uint8>(getCompressionLevel()), uint8{1})) - 1;
+        uint8 flags = level << 6;
+        flags += 31 - ((MethodInfo << 8) | flags) % 31;
+        output.push_back(static_cast<char>(MethodInfo));
+        output.push_back(static_cast<char>(flags));
+        deflate(input, output);
+        uint32 checksum = adler32(input);
+        for (int8 shift = 24; shift >= 0; shift -= 8)
+            output.push_back(static_cast<char>(checksum >> shift));
+        return output;
+    }
+
+}
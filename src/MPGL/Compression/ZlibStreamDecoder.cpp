@@ -0,0 +1,101 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#include <MPGL/Exceptions/Inflate/InflateInvalidHeaderException.hpp>
+#include <MPGL/Exceptions/Inflate/InflateDataCorruptionException.hpp>
+#include <MPGL/Exceptions/NotSupportedException.hpp>
+#include <MPGL/Compression/ZlibStreamDecoder.hpp>
+#include <MPGL/Compression/Checksums/Adler32.hpp>
+#include <MPGL/IO/Readers.hpp>
+
+#include <algorithm>
+
+namespace mpgl {
+
+    void ZlibStreamDecoder::reset(void) noexcept {
+        inflate.reset();
+        pendingSize = 0;
+        checksum = 1;
+        state = State::Header;
+    }
+
+    ZlibStreamDecoder::size_type ZlibStreamDecoder::fillPending(
+        InputSpan input,
+        uint8 size) noexcept
+    {
+        size_type length = std::min<size_type>(size - pendingSize,
+            input.size());
+        std::ranges::copy(input.first(length),
+            pending.begin() + pendingSize);
+        pendingSize += length;
+        return length;
+    }
+
+    void ZlibStreamDecoder::parseHeader(void) const {
+        uint8 const cmf = pending[0], flg = pending[1];
+        if (cmf != 0x78)
+            throw InflateInvalidHeaderException{};
+        if ((256u * cmf + flg) % 31)
+            throw InflateDataCorruptionException{};
+        if (flg & 0x20)
+            throw NotSupportedException{
+                "No-default dicts are not supported."};
+    }
+
+    [[nodiscard]] ZlibStreamDecoder::Result
+        ZlibStreamDecoder::operator()(
+            InputSpan input,
+            OutputSpan output)
+    {
+        size_type consumed = 0, produced = 0;
+        if (state == State::Header) {
+            consumed = fillPending(input, 2);
+            if (pendingSize < 2)
+                return {consumed, produced, Status::NeedsInput};
+            parseHeader();
+            pendingSize = 0;
+            state = State::Data;
+        }
+        if (state == State::Data) {
+            auto result = inflate(input.subspan(consumed), output);
+            consumed += result.consumed;
+            produced = result.produced;
+            checksum = adler32(output.first(produced), checksum);
+            if (result.status != Status::Finished)
+                return {consumed, produced, result.status};
+            state = State::Trailer;
+        }
+        if (state == State::Trailer) {
+            consumed += fillPending(input.subspan(consumed), 4);
+            if (pendingSize < 4)
+                return {consumed, produced, Status::NeedsInput};
+            if (peekType<uint32, true>(pending.begin()) != checksum)
+                throw InflateDataCorruptionException{};
+            state = State::Finished;
+        }
+        return {consumed, produced, Status::Finished};
+    }
+
+}
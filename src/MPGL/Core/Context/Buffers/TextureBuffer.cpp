@@ -56,6 +56,18 @@ namespace mpgl {
             GL_UNSIGNED_BYTE, imagePtr);
     }
 
+    void TextureBuffer::loadSubImage(
+        PixelFormat const& format,
+        std::size_t x,
+        std::size_t y,
+        std::size_t width,
+        std::size_t height,
+        void const* imagePtr) const noexcept
+    {
+        glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height,
+            static_cast<uint16>(format), GL_UNSIGNED_BYTE, imagePtr);
+    }
+
     void TextureBuffer::generateMipmaps(void) const noexcept {
         glGenerateMipmap(GL_TEXTURE_2D);
     }
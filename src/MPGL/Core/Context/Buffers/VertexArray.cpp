@@ -68,6 +68,18 @@ namespace mpgl {
             static_cast<uint16>(dataType), 0);
     }
 
+    void VertexArray::drawElements(
+        DrawMode mode,
+        uint32 size,
+        DataType dataType,
+        std::size_t offset) const noexcept
+    {
+        // Change static cast to std::to_underlying in C++23
+        glDrawElements(static_cast<uint16>(mode), size,
+            static_cast<uint16>(dataType),
+            reinterpret_cast<void const*>(offset));
+    }
+
     void VertexArray::drawInstancedArrays(
         DrawMode mode,
         uint32 size,
@@ -0,0 +1,239 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#include <MPGL/Core/Shaders/ProgramCache.hpp>
+#include <MPGL/Compression/Checksums/CRC32.hpp>
+#include <MPGL/IO/Readers.hpp>
+#include <MPGL/IO/FileIO.hpp>
+
+#include <filesystem>
+#include <algorithm>
+#include <fstream>
+#include <cstdio>
+
+namespace mpgl {
+
+    ProgramCache::ProgramCache(
+        Path const& directory,
+        ShaderFunctions const& functions)
+            : ProgramCache{directory, queryDriver(directory,
+                functions), functions} {}
+
+    ProgramCache::ProgramCache(
+        Path const& directory,
+        Driver driver,
+        ShaderFunctions const& functions)
+            : driver{std::move(driver)}, directory{directory},
+            functions{&functions}, enabled{false}
+    {
+        namespace fs = std::filesystem;
+
+        std::error_code error;
+        if (directory.empty() || this->driver.formats.empty())
+            return;
+        fs::create_directories(directory, error);
+        enabled = fs::is_directory(directory, error);
+    }
+
+    ProgramCache::Driver ProgramCache::queryDriver(
+        Path const& directory,
+        ShaderFunctions const& functions)
+    {
+        Driver driver;
+        if (directory.empty() || !functions.hasProgramBinary())
+            return driver;
+        auto string = [&functions](uint32 name) -> std::string {
+            auto const value = functions.getString(name);
+            return value ? value : "";
+        };
+        driver.vendor = string(GL_VENDOR);
+        driver.renderer = string(GL_RENDERER);
+        driver.version = string(GL_VERSION);
+        int32 count = 0;
+        functions.getIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &count);
+        if (count <= 0)
+            return driver;
+        std::vector<int32> formats(count);
+        functions.getIntegerv(GL_PROGRAM_BINARY_FORMATS, formats.data());
+        driver.formats.assign(formats.begin(), formats.end());
+        return driver;
+    }
+
+    [[nodiscard]] ProgramCache::Key ProgramCache::makeKey(
+        Source vertex,
+        Source fragment,
+        Driver const& driver) noexcept
+    {
+        Key key = 0xCBF29CE484222325;
+        auto const hash = [&key](auto const& range) {
+            for (uint64 size = std::ranges::size(range), i = 0;
+                i != sizeof(uint64); ++i, size >>= 8)
+                    key = (key ^ (size & 0xFF)) * 0x100000001B3;
+            for (auto const& value : range)
+                for (std::size_t i = 0; i != sizeof(value); ++i)
+                    key = (key ^ ((value >> (8 * i)) & 0xFF))
+                        * 0x100000001B3;
+        };
+        hash(vertex);
+        hash(fragment);
+        hash(driver.vendor);
+        hash(driver.renderer);
+        hash(driver.version);
+        hash(driver.formats);
+        return key;
+    }
+
+    [[nodiscard]] ProgramCache::Path ProgramCache::getPath(
+        Key key) const
+    {
+        char name[17];
+        std::snprintf(name, sizeof(name), "%016llx",
+            static_cast<unsigned long long>(key));
+        return directory + "/" + name + ".bin";
+    }
+
+    ShaderProgram ProgramCache::compile(
+        std::string const& name,
+        Source vertex,
+        Source fragment) const
+    {
+        VertexShader vertexShader{vertex, *functions};
+        FragmentShader fragmentShader{fragment, *functions};
+        ShaderProgram program{vertexShader, fragmentShader, *functions};
+        if (enabled)
+            program.setRetrievable();
+        program.link(name);
+        return program;
+    }
+
+    [[nodiscard]] ShaderProgram ProgramCache::operator() (
+        std::string const& name,
+        Source vertex,
+        Source fragment)
+    {
+        if (!enabled)
+            return compile(name, vertex, fragment);
+        Key const key = makeKey(vertex, fragment);
+        if (auto program = load(key))
+            return std::move(*program);
+        auto program = compile(name, vertex, fragment);
+        store(key, program);
+        return program;
+    }
+
+    [[nodiscard]] std::optional<ShaderProgram> ProgramCache::load(
+        Key key)
+    {
+        if (!enabled)
+            return std::nullopt;
+        auto const file = FileIO::readFileToVec(getPath(key));
+        if (!file)
+            return std::nullopt;
+        if (file->size() >= HeaderSize) {
+            auto const iter = file->begin();
+            uint32 const format = peekType<uint32>(iter + 16);
+            std::span<char const> const binary{file->begin()
+                + HeaderSize, file->end()};
+            if (peekType<uint32>(iter) == Magic
+                && peekType<uint16>(iter + 4) == Version
+                && peekType<uint64>(iter + 8) == key
+                && std::ranges::count(driver.formats, format)
+                && peekType<uint32>(iter + 20) == binary.size()
+                && peekType<uint32>(iter + 24) == crc32(binary))
+            {
+                if (auto program = ShaderProgram::fromBinary(
+                    format, binary, *functions))
+                        return program;
+            }
+        }
+        invalidate(key);
+        return std::nullopt;
+    }
+
+    template <std::unsigned_integral Tp>
+    void ProgramCache::saveLittleEndian(Tp value, Buffer& output) {
+        for (uint8 i = 0; i != sizeof(Tp); ++i, value >>= 8)
+            output.push_back(static_cast<char>(value & 0xFF));
+    }
+
+    bool ProgramCache::store(Key key, ShaderProgram const& program) {
+        namespace fs = std::filesystem;
+
+        if (!enabled)
+            return false;
+        auto const binary = program.getBinary();
+        if (!binary)
+            return false;
+        Buffer output;
+        output.reserve(HeaderSize + binary->data.size());
+        saveLittleEndian<uint32>(Magic, output);
+        saveLittleEndian<uint16>(Version, output);
+        saveLittleEndian<uint16>(0, output);
+        saveLittleEndian<uint64>(key, output);
+        saveLittleEndian<uint32>(binary->format, output);
+        saveLittleEndian<uint32>(binary->data.size(), output);
+        saveLittleEndian<uint32>(crc32(binary->data), output);
+        output.insert(output.end(), binary->data.begin(),
+            binary->data.end());
+        Path const path = getPath(key);
+        Path const temporary = path + ".tmp";
+        std::error_code error;
+        {
+            std::ofstream file{temporary.c_str(), std::ios::binary
+                | std::ios::trunc};
+            if (file.is_open() && file.write(output.data(),
+                output.size()))
+            {
+                file.close();
+                fs::rename(temporary, path, error);
+                if (!error)
+                    return true;
+            }
+        }
+        fs::remove(temporary, error);
+        return false;
+    }
+
+    void ProgramCache::invalidate(Key key) const {
+        std::error_code error;
+        std::filesystem::remove(getPath(key), error);
+    }
+
+    void ProgramCache::clear(void) const {
+        namespace fs = std::filesystem;
+
+        std::error_code error;
+        if (directory.empty())
+            return;
+        for (auto iter = fs::directory_iterator{directory, error};
+            !error && iter != fs::directory_iterator{};
+            iter.increment(error))
+        {
+            if (iter->path().extension() == ".bin")
+                fs::remove(iter->path(), error);
+        }
+    }
+
+}
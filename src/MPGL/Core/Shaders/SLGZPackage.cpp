@@ -0,0 +1,178 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#include <MPGL/Exceptions/HuffmanTree/HuffmanTreeException.hpp>
+#include <MPGL/Exceptions/Inflate/InflateException.hpp>
+#include <MPGL/Exceptions/SLGZFileCorruptionException.hpp>
+#include <MPGL/Exceptions/NotSupportedException.hpp>
+#include <MPGL/Core/Shaders/SLGZPackage.hpp>
+#include <MPGL/IO/Readers.hpp>
+
+#include <algorithm>
+
+namespace mpgl {
+
+    SLGZPackage::SLGZPackage(Path const& path)
+        : SLGZPackage{[&path]() {
+            if (auto file = MappedFile::open(path))
+                return std::move(*file);
+            throw SLGZFileCorruptionException{path};
+        }(), path} {}
+
+    SLGZPackage::SLGZPackage(MappedFile&& file, Path const& path)
+        : file{std::move(file)}, path{path}
+    {
+        buffer.resize(readSize());
+        readIndex();
+    }
+
+    SLGZPackage::size_type SLGZPackage::readSize(void) const {
+        if (file.size() < 18)
+            throw SLGZFileCorruptionException{path};
+        size_type const size = peekType<uint32>(file.end() - 4);
+        if (size > file.size() * MaxRatio)
+            throw SLGZFileCorruptionException{path};
+        return size;
+    }
+
+    void SLGZPackage::readIndex(void) {
+        for (;;) {
+            if (auto length = parseHeader())
+                return buildIndex(*length);
+            index.clear();
+            if (produced == buffer.size())
+                throw SLGZFileCorruptionException{path};
+            decompressUntil(std::min(produced + ChunkSize,
+                buffer.size()));
+        }
+    }
+
+    SLGZPackage::OptSize SLGZPackage::parseHeader(void) {
+        auto const begin = buffer.begin();
+        auto const end = begin + produced;
+        auto iter = begin;
+        while (end - iter >= 4) {
+            uint32 offset = readType<uint32>(iter);
+            if (!offset)
+                return iter - begin;
+            if (end - iter < 4)
+                return std::nullopt;
+            uint32 length = readType<uint32>(iter);
+            auto const nameEnd = std::find(iter, end, '\0');
+            if (nameEnd == end)
+                return std::nullopt;
+            index.push_back(Entry{Name{&*iter, static_cast<size_type>(
+                nameEnd - iter)}, offset, length});
+            iter = nameEnd + 1;
+        }
+        return std::nullopt;
+    }
+
+    void SLGZPackage::buildIndex(size_type headerLength) {
+        for (Entry& entry : index) {
+            entry.offset += headerLength - OFFSET;
+            if (entry.offset > buffer.size()
+                || entry.length > buffer.size() - entry.offset)
+                throw SLGZFileCorruptionException{path};
+        }
+        std::ranges::sort(index, {}, &Entry::name);
+        auto const duplicate = std::ranges::adjacent_find(index, {},
+            &Entry::name);
+        if (duplicate != index.end())
+            throw SLGZFileCorruptionException{path};
+    }
+
+    void SLGZPackage::decompressUntil(size_type limit) {
+        while (produced < limit)
+            if (step(std::span{buffer}.subspan(produced,
+                limit - produced)) == GZIPStreamDecoder::Status::Finished)
+                    break;
+        if (produced < limit)
+            throw SLGZFileCorruptionException{path};
+    }
+
+    GZIPStreamDecoder::Status SLGZPackage::step(
+        GZIPStreamDecoder::OutputSpan output)
+    {
+        try {
+            auto [read, written, status] = decoder(
+                file.getSpan().subspan(consumed), output);
+            consumed += read;
+            produced += written;
+            if (status == GZIPStreamDecoder::Status::NeedsInput)
+                throw SLGZFileCorruptionException{path};
+            if (status == GZIPStreamDecoder::Status::Finished) {
+                if (produced != buffer.size())
+                    throw SLGZFileCorruptionException{path};
+                file = MappedFile{};
+            }
+            return status;
+        } catch (InflateException const&) {
+            throw SLGZFileCorruptionException{path};
+        } catch (HuffmanTreeException const&) {
+            throw SLGZFileCorruptionException{path};
+        } catch (NotSupportedException const&) {
+            throw SLGZFileCorruptionException{path};
+        }
+    }
+
+    void SLGZPackage::decompress(void) {
+        decompressUntil(buffer.size());
+        while (!decoder.isFinished())
+            if (step(std::span{buffer}.subspan(produced))
+                == GZIPStreamDecoder::Status::NeedsOutput)
+                    throw SLGZFileCorruptionException{path};
+    }
+
+    [[nodiscard]] SLGZPackage::Source SLGZPackage::operator[] (
+        Entry const& entry)
+    {
+        decompressUntil(entry.offset + entry.length);
+        return Source{buffer.data() + entry.offset, entry.length};
+    }
+
+    [[nodiscard]] SLGZPackage::const_iterator
+        SLGZPackage::lookup(Name name) const noexcept
+    {
+        auto const iter = std::ranges::lower_bound(index, name, {},
+            &Entry::name);
+        if (iter == index.end() || iter->name != name)
+            return index.end();
+        return iter;
+    }
+
+    [[nodiscard]] std::optional<SLGZPackage::Source>
+        SLGZPackage::find(Name name)
+    {
+        if (auto const iter = lookup(name); iter != index.end())
+            return (*this)[*iter];
+        return std::nullopt;
+    }
+
+    [[nodiscard]] bool SLGZPackage::contains(Name name) const noexcept {
+        return lookup(name) != index.end();
+    }
+
+}
@@ -37,11 +37,12 @@ namespace mpgl {
     template <bool ShaderType>
     void Shader<ShaderType>::verifyCompilationStatus(void) const {
         int32 status = 0;
-        glGetProgramiv(shaderID, GL_COMPILE_STATUS, &status);
+        functions->getShaderiv(shaderID, GL_COMPILE_STATUS, &status);
         if (!status) {
             std::string info;
             info.resize(512);
-            glGetProgramInfoLog(shaderID, 512, nullptr, info.data());
+            functions->getShaderInfoLog(shaderID, 512, nullptr,
+                info.data());
             if (!accumulate(info, 0u))
                 return;
             throw ShaderCompilationException{info};
@@ -49,8 +50,11 @@ namespace mpgl {
     }
 
     template <bool ShaderType>
-    Shader<ShaderType>::Shader(std::string shaderPath)
-        : shaderID{glCreateShader(shaderType())}
+    Shader<ShaderType>::Shader(
+        std::string shaderPath,
+        ShaderFunctions const& functions)
+            : functions{&functions},
+            shaderID{functions.createShader(shaderType())}
     {
         if (auto shaderCode = FileIO::readFileToVec(shaderPath))
             loadShader((shaderCode->push_back(0), *shaderCode));
@@ -61,13 +65,15 @@ namespace mpgl {
 
     template <bool ShaderType>
     Shader<ShaderType>::Shader(Shader&& shader) noexcept
-        : shaderID{std::exchange(shader.shaderID, 0)} {}
+        : functions{shader.functions},
+        shaderID{std::exchange(shader.shaderID, 0)} {}
 
     template <bool ShaderType>
     Shader<ShaderType>& Shader<ShaderType>::operator= (
         Shader&& shader) noexcept
     {
         destroy();
+        functions = shader.functions;
         shaderID = std::exchange(shader.shaderID, 0);
         return *this;
     }
@@ -80,7 +86,7 @@ namespace mpgl {
     template <bool ShaderType>
     void Shader<ShaderType>::destroy(void) noexcept {
         if (shaderID)
-            glDeleteShader(shaderID);
+            functions->deleteShader(shaderID);
     }
 
 }
@@ -0,0 +1,88 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#include <MPGL/Core/Shaders/ShaderFunctions.hpp>
+
+#include <glad/glad.h>
+
+namespace mpgl {
+
+    [[nodiscard]] ShaderFunctions const&
+        ShaderFunctions::openGL(void) noexcept
+    {
+        static ShaderFunctions const functions{
+            .createShader = [](uint32 type) -> uint32
+                { return glCreateShader(type); },
+            .shaderSource = [](uint32 shader, int32 count,
+                char const* const* sources, int32 const* lengths)
+                    { glShaderSource(shader, count, sources, lengths); },
+            .compileShader = [](uint32 shader)
+                { glCompileShader(shader); },
+            .getShaderiv = [](uint32 shader, uint32 parameter,
+                int32* value) { glGetShaderiv(shader, parameter, value); },
+            .getShaderInfoLog = [](uint32 shader, int32 size,
+                int32* length, char* log)
+                    { glGetShaderInfoLog(shader, size, length, log); },
+            .deleteShader = [](uint32 shader)
+                { glDeleteShader(shader); },
+            .createProgram = [](void) -> uint32
+                { return glCreateProgram(); },
+            .attachShader = [](uint32 program, uint32 shader)
+                { glAttachShader(program, shader); },
+            .linkProgram = [](uint32 program)
+                { glLinkProgram(program); },
+            .getProgramiv = [](uint32 program, uint32 parameter,
+                int32* value) { glGetProgramiv(program, parameter, value); },
+            .getProgramInfoLog = [](uint32 program, int32 size,
+                int32* length, char* log)
+                    { glGetProgramInfoLog(program, size, length, log); },
+            .deleteProgram = [](uint32 program)
+                { glDeleteProgram(program); },
+            .hasProgramBinary = [](void) -> bool {
+                return glad_glProgramParameteri
+                    && glad_glGetProgramBinary && glad_glProgramBinary;
+            },
+            .programParameteri = [](uint32 program, uint32 parameter,
+                int32 value)
+                    { glProgramParameteri(program, parameter, value); },
+            .getProgramBinary = [](uint32 program, int32 size,
+                int32* length, uint32* format, void* binary) {
+                    glGetProgramBinary(program, size, length, format,
+                        binary);
+            },
+            .programBinary = [](uint32 program, uint32 format,
+                void const* binary, int32 length)
+                    { glProgramBinary(program, format, binary, length); },
+            .getIntegerv = [](uint32 parameter, int32* values)
+                { glGetIntegerv(parameter, values); },
+            .getString = [](uint32 name) -> char const* {
+                return reinterpret_cast<char const*>(
+                    glGetString(name));
+            }
+        };
+        return functions;
+    }
+
+}
@@ -24,7 +24,9 @@
  *  distribution
  */
 #include <MPGL/Exceptions/Shader/ShaderLibraryInvalidShadersException.hpp>
+#include <MPGL/Exceptions/Shader/ShaderCompilationException.hpp>
 #include <MPGL/Core/Shaders/ShaderLibrary.hpp>
+#include <MPGL/IO/FileIO.hpp>
 
 #include <filesystem>
 #include <algorithm>
@@ -43,15 +45,23 @@ namespace mpgl {
         return path.size() ? path + "/Fragment" : "Fragment";
     }
 
-    ShaderLibrary::ShaderLibrary(Paths const& locations) {
+    ShaderLibrary::ShaderLibrary(
+        Paths const& locations,
+        Names const& warmUp,
+        Path const& cacheDirectory,
+        ShaderFunctions const& functions)
+            : library{std::make_shared<Library>()}
+    {
         namespace fs = std::filesystem;
 
+        library->cache = ProgramCache{cacheDirectory, functions};
         for (Path const& path : locations) {
             if (isPackage(path) && fs::exists(path))
                 loadPackage(path);
             else
                 loadShaderDirectory(path);
         }
+        this->warmUp(warmUp);
     }
 
     bool ShaderLibrary::isPackage(Path const& path) noexcept {
@@ -64,24 +74,68 @@ namespace mpgl {
 
     void ShaderLibrary::loadShaderDirectory(Path const& path) {
         for (std::string const& shader : getShaderList(path)) {
-            VertexShader vertex{vertexShaders(path) + "/" + shader};
-            FragmentShader fragment{fragmentShaders(path) + "/" + shader};
-            ShaderProgram program{vertex, fragment};
-            program.link(shader);
-            programs.emplace(shader.substr(0,
-                shader.find_last_of('.')), std::move(program));
+            library->sources.emplace(shader.substr(0,
+                shader.find_last_of('.')), FileSources{
+                    vertexShaders(path) + "/" + shader,
+                    fragmentShaders(path) + "/" + shader});
         }
     }
 
     void ShaderLibrary::loadPackage(Path const& path) {
-        auto shaderMap = SLGZLoader{security::secured}(path);
-        for (std::string const& shader : getShaderList(shaderMap)) {
-            VertexShader vertex{shaderMap["Vertex/" + shader]};
-            FragmentShader fragment{shaderMap["Fragment/" + shader]};
-            ShaderProgram program{vertex, fragment};
-            program.link(shader);
-            programs.emplace(shader, std::move(program));
+        auto& package = library->packages.emplace_back(path);
+        for (std::string const& shader : getShaderList(package)) {
+            Path vertexPath = vertexShaders("") + "/" + shader;
+            Path fragmentPath = fragmentShaders("") + "/" + shader;
+            auto vertex = package.lookup(vertexPath);
+            auto fragment = package.lookup(fragmentPath);
+            if (vertex == package.end() || fragment == package.end())
+                throw ShaderLibraryInvalidShadersException{
+                    vertex == package.end() ? Paths{} : Paths{vertexPath},
+                    fragment == package.end() ? Paths{}
+                        : Paths{fragmentPath}};
+            library->sources.emplace(shader, PackedSources{
+                library->packages.size() - 1, *vertex, *fragment});
+        }
+    }
+
+    ShaderProgram ShaderLibrary::compile(
+        std::string const& name,
+        Sources const& sources) const
+    {
+        if (std::holds_alternative<FileSources>(sources)) {
+            auto const& [vertexPath, fragmentPath]
+                = std::get<FileSources>(sources);
+            auto vertex = FileIO::readFileToVec(vertexPath);
+            auto fragment = FileIO::readFileToVec(fragmentPath);
+            if (!vertex || !fragment)
+                throw ShaderCompilationException{
+                    "Shader cannot be loaded from a file"};
+            vertex->push_back(0);
+            fragment->push_back(0);
+            return library->cache(name,
+                {vertex->data(), vertex->size()},
+                {fragment->data(), fragment->size()});
         }
+        auto const& [index, vertex, fragment]
+            = std::get<PackedSources>(sources);
+        auto& package = library->packages[index];
+        return library->cache(name, package[vertex], package[fragment]);
+    }
+
+    [[nodiscard]] ShaderProgram const& ShaderLibrary::operator[] (
+        std::string const& name) const
+    {
+        if (auto iter = library->programs.find(name);
+            iter != library->programs.end())
+                return iter->second;
+        auto const& sources = library->sources.at(name);
+        return library->programs.emplace(name,
+            compile(name, sources)).first->second;
+    }
+
+    void ShaderLibrary::warmUp(Names const& names) const {
+        for (std::string const& name : names)
+            (void) (*this)[name];
     }
 
     bool ShaderLibrary::sameShaders(
@@ -104,6 +158,8 @@ namespace mpgl {
     {
         auto vertex = FileIO::getRecursiveDirFiles(vertexShaders(path));
         auto fragment = FileIO::getRecursiveDirFiles(fragmentShaders(path));
+        std::ranges::sort(vertex);
+        std::ranges::sort(fragment);
         if (!sameShaders(vertex, fragment, path))
             throw ShaderLibraryInvalidShadersException{vertex, fragment};
         Paths shaders;
@@ -114,15 +170,22 @@ namespace mpgl {
     }
 
     ShaderLibrary::Paths ShaderLibrary::getShaderList(
-        ShaderMap const& map) const
+        SLGZPackage const& package) const
     {
+        Path const vertexPrefix = vertexShaders("") + "/";
+        Path const fragmentPrefix = fragmentShaders("") + "/";
         Paths vertex, fragment;
-        for (auto const& [shader, _] : map) {
-            if (shader[0] == 'V')
-                vertex.push_back(shader);
+        for (auto const& entry : package) {
+            if (entry.name.starts_with(vertexPrefix))
+                vertex.emplace_back(entry.name);
+            else if (entry.name.starts_with(fragmentPrefix))
+                fragment.emplace_back(entry.name);
             else
-                fragment.push_back(shader);
+                throw ShaderLibraryInvalidShadersException{
+                    Paths{Path{entry.name}}, Paths{}};
         }
+        std::ranges::sort(vertex);
+        std::ranges::sort(fragment);
         if (!sameShaders(vertex, fragment, ""))
             throw ShaderLibraryInvalidShadersException{vertex, fragment};
         Paths shaders;
@@ -31,30 +31,40 @@ namespace mpgl {
 
     uint32 ShaderProgram::lastProgramID = 0u;
 
-    ShaderProgram::ShaderProgram(void) noexcept
-        : shaderProgramID{new uint32{0}, ProgramDeleter{}} {}
+    ShaderProgram::ShaderProgram(
+        ShaderFunctions const& functions) noexcept
+            : shaderProgramID{new uint32{0}, ProgramDeleter{functions}},
+            functions{&functions} {}
 
     ShaderProgram::ShaderProgram(
         VertexShader const& vertex,
-        FragmentShader const& fragment) noexcept
-            : shaderProgramID{new uint32{glCreateProgram()},
-                ProgramDeleter{}}
+        FragmentShader const& fragment,
+        ShaderFunctions const& functions) noexcept
+            : shaderProgramID{new uint32{functions.createProgram()},
+                ProgramDeleter{functions}}, functions{&functions}
     {
         attachShader(vertex);
         attachShader(fragment);
     }
 
+    ShaderProgram::ShaderProgram(
+        uint32 programID,
+        ShaderFunctions const& functions) noexcept
+            : shaderProgramID{new uint32{programID},
+                ProgramDeleter{functions}}, functions{&functions} {}
+
     void ShaderProgram::ProgramDeleter::operator() (
         uint32* ptr) const noexcept
     {
         if (*ptr)
-            glDeleteProgram(*ptr);
+            functions->deleteProgram(*ptr);
         delete ptr;
     }
 
     bool ShaderProgram::isLinked(void) const noexcept {
         int32 status = 0;
-        glGetProgramiv(*shaderProgramID, GL_LINK_STATUS, &status);
+        functions->getProgramiv(*shaderProgramID, GL_LINK_STATUS,
+            &status);
         return status != 0;
     }
 
@@ -64,16 +74,52 @@ namespace mpgl {
         if (!isLinked()) {
             std::string info;
             info.resize(512);
-            glGetProgramInfoLog(*shaderProgramID, 512, nullptr,
-                info.data());
+            functions->getProgramInfoLog(*shaderProgramID, 512,
+                nullptr, info.data());
             throw ShaderProgramLinkingException{
                 "[" + programName + "]\t" + info};
         }
     }
 
     void ShaderProgram::link(std::string const& programName) const {
-        glLinkProgram(*shaderProgramID);
+        functions->linkProgram(*shaderProgramID);
         verifyLinkingStatus(programName);
     }
 
+    void ShaderProgram::setRetrievable(void) const noexcept {
+        functions->programParameteri(*shaderProgramID,
+            GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+
+    [[nodiscard]] std::optional<ShaderProgram::Binary>
+        ShaderProgram::getBinary(void) const
+    {
+        int32 length = 0;
+        functions->getProgramiv(*shaderProgramID,
+            GL_PROGRAM_BINARY_LENGTH, &length);
+        if (length <= 0)
+            return std::nullopt;
+        Binary binary{0, std::vector<char>(length)};
+        int32 written = 0;
+        functions->getProgramBinary(*shaderProgramID, length,
+            &written, &binary.format, binary.data.data());
+        if (written <= 0 || written > length)
+            return std::nullopt;
+        binary.data.resize(written);
+        return binary;
+    }
+
+    [[nodiscard]] std::optional<ShaderProgram> ShaderProgram::fromBinary(
+        uint32 format,
+        BinarySpan binary,
+        ShaderFunctions const& functions)
+    {
+        ShaderProgram program{functions.createProgram(), functions};
+        functions.programBinary(*program.shaderProgramID, format,
+            binary.data(), static_cast<int32>(binary.size()));
+        if (!program.isReady())
+            return std::nullopt;
+        return program;
+    }
+
 }
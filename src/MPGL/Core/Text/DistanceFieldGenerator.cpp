@@ -0,0 +1,148 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#include <MPGL/Core/Text/DistanceFieldGenerator.hpp>
+#include <MPGL/Mathematics/Systems.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <cmath>
+
+namespace mpgl {
+
+    DistanceFieldGenerator::DistanceFieldGenerator(
+        FontData const& mainData,
+        GlyphData const& glyph,
+        size_type size,
+        size_type spread)
+            : mainData{mainData}, glyph{glyph},
+            size{size}, spread{spread}
+    {
+        separateContours();
+    }
+
+    void DistanceFieldGenerator::separateContours(void) {
+        auto const& points = glyph.glyph.getGlyph().points;
+        auto const& ends = glyph.glyph.getGlyph().endPtsOfContours;
+        Contour contour;
+        for (uint16 i = 0, counter = 0; i != points.size(); ++i) {
+            contour.push_back(ContourPoint{remapPoint(points[i].position),
+                points[i].onCurve});
+            if (counter < ends.size() && ends[counter] == i) {
+                addContour(contour);
+                contour.clear();
+                ++counter;
+            }
+        }
+    }
+
+    void DistanceFieldGenerator::addContour(Contour const& contour) {
+        walkContour(contour,
+            [this](Vector2f const& begin, Vector2f const& end)
+                { edges.push_back(Edge{begin, end}); },
+            [this](Vector2f const& begin, Vector2f const& control,
+                Vector2f const& end)
+                    { addCurve(begin, control, end); });
+    }
+
+    void DistanceFieldGenerator::addCurve(
+        Vector2f const& begin,
+        Vector2f const& control,
+        Vector2f const& end)
+    {
+        std::size_t const samples = quadraticBezierSegments(
+            begin, control, end, Tolerance);
+        Vector2f last = begin;
+        for (std::size_t i = 1; i <= samples; ++i) {
+            float32 const t = float32(i) / samples;
+            Vector2f const next = (1.f - t) * ((1.f - t) * begin
+                + t * control) + t * ((1.f - t) * control + t * end);
+            edges.push_back(Edge{last, next});
+            last = next;
+        }
+    }
+
+    [[nodiscard]] Vector2f DistanceFieldGenerator::remapPoint(
+        Vector2si const& position) const noexcept
+    {
+        auto translated = position - glyph.glyph.getMinDimensions();
+        return float32(size) * vectorCast<float32>(translated)
+            / float32(mainData.unitsPerEm) + float32(spread);
+    }
+
+    [[nodiscard]] float32 DistanceFieldGenerator::squaredDistance(
+        Edge const& edge,
+        Vector2f const& point) noexcept
+    {
+        Vector2f const direction = edge.end - edge.begin;
+        Vector2f const shift = point - edge.begin;
+        float32 const length = dot(direction, direction);
+        float32 const t = length > 0.f ? std::clamp(
+            dot(shift, direction) / length, 0.f, 1.f) : 0.f;
+        Vector2f const distance = shift - t * direction;
+        return dot(distance, distance);
+    }
+
+    [[nodiscard]] float32 DistanceFieldGenerator::signedDistance(
+        Vector2f const& point) const noexcept
+    {
+        float32 distance = std::numeric_limits<float32>::max();
+        int32 winding = 0;
+        for (auto const& edge : edges) {
+            distance = std::min(distance, squaredDistance(edge, point));
+            auto const& [begin, end] = edge;
+            if ((begin[1] <= point[1]) != (end[1] <= point[1])) {
+                float32 const x = begin[0] + (point[1] - begin[1])
+                    * (end[0] - begin[0]) / (end[1] - begin[1]);
+                if (x > point[0])
+                    winding += end[1] > begin[1] ? 1 : -1;
+            }
+        }
+        distance = std::sqrt(distance);
+        return winding ? distance : -distance;
+    }
+
+    [[nodiscard]] Bitmap DistanceFieldGenerator::operator() (
+        void) const noexcept
+    {
+        auto const extent = glyph.glyph.getMaxDimensions()
+            - glyph.glyph.getMinDimensions();
+        auto const dimensions = vectorCast<size_type>(ceil(
+            float32(size) * vectorCast<float32>(extent)
+                / float32(mainData.unitsPerEm))) + 2 * spread;
+        Bitmap field{dimensions};
+        float32 const range = 2.f * spread;
+        for (size_type y = 0; y != field.getHeight(); ++y) {
+            for (size_type x = 0; x != field.getWidth(); ++x) {
+                float32 const distance = signedDistance(
+                    Vector2f{float32(x) + .5f, float32(y) + .5f});
+                field[y][x] = static_cast<uint8>(std::round(255.f
+                    * std::clamp(.5f + distance / range, 0.f, 1.f)));
+            }
+        }
+        return field;
+    }
+
+}
@@ -23,9 +23,11 @@
  *  3. This notice may not be removed or altered from any source
  *  distribution
  */
+#include <MPGL/Exceptions/TTFLoaderFileCorruptionException.hpp>
 #include <MPGL/Exceptions/FontNoRegularException.hpp>
 
 #include <MPGL/Utility/StringAlgorithm.hpp>
+#include <MPGL/IO/AsyncFileReader.hpp>
 #include <MPGL/Core/Text/Font.hpp>
 #include <MPGL/IO/FileIO.hpp>
 
@@ -55,8 +57,11 @@ namespace mpgl {
         signatures.reserve(files.size());
         std::ranges::transform(files, std::back_inserter(signatures),
             [](auto const& string) { return toLower(string); });
+        Selection selection;
         std::ranges::for_each(typeVector, [&](const auto& pair) {
-            findSubfont(files, signatures, pair.second, pair.first); });
+            findSubfont(files, signatures, selection, pair.second,
+                pair.first); });
+        loadSubfonts(selection);
         if (!pointer->subfonts.contains(Type::Regular))
             throw FontNoRegularException{fontName};
     }
@@ -64,25 +69,44 @@ namespace mpgl {
     void Font::findSubfont(
         Files& files,
         Files& signatures,
+        Selection& selection,
         std::string const& type,
         Type const& flag)
     {
         for (std::size_t i = files.size() - 1; i < files.size(); --i)
             if (std::string::npos != signatures[i].find(pointer->fontName))
                 if (std::string::npos != signatures[i].find_last_of(type))
-                    return addSubfont(i, files, signatures, flag);
+                    return addSubfont(i, files, signatures,
+                        selection, flag);
     }
 
     void Font::addSubfont(
         std::size_t position,
         Files& files,
         Files& signatures,
+        Selection& selection,
         Type const& flag)
     {
-        pointer->subfonts.emplace(flag, Subfont{files[position]});
+        selection.emplace_back(flag, std::move(files[position]));
         files.erase(files.cbegin() + position);
         signatures.erase(signatures.cbegin() + position);
-        pointer->mask += static_cast<uint8>(flag);
+    }
+
+    void Font::loadSubfonts(Selection const& selection) {
+        Files paths;
+        paths.reserve(selection.size());
+        std::ranges::transform(selection, std::back_inserter(paths),
+            &Selection::value_type::second);
+        AsyncFileReader{}(paths, [&](std::size_t index,
+            AsyncFileReader::Result&& file)
+        {
+            auto const& [flag, path] = selection[index];
+            if (!file)
+                throw TTFLoaderFileCorruptionException{path};
+            pointer->subfonts.emplace(flag,
+                Subfont{path, std::move(*file)});
+            pointer->mask += static_cast<uint8>(flag);
+        });
     }
 
     Subfont& Font::operator() (Type const& type) {
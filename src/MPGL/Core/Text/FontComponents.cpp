@@ -25,12 +25,44 @@
  */
 #include <MPGL/Core/Text/FontComponents.hpp>
 
+#include <bit>
+
 namespace mpgl {
 
-    void KernTable::setAxis(uint16 const& coverage) noexcept {
-        bool horizontal = coverage & 0x0001;
-        bool cross = coverage & 0x0002;
-        axis = cross == horizontal;
+    Kern::Kern(Pairs const& pairs) {
+        if (pairs.empty())
+            return;
+        uint32 const capacity = std::bit_ceil(
+            static_cast<uint32>(2 * pairs.size()));
+        shift = 32 - std::countr_zero(capacity);
+        mask = capacity - 1;
+        entries.resize(capacity, Entry{EmptyKey, 0});
+        for (auto const& [key, distance] : pairs) {
+            if (key == EmptyKey)
+                continue;
+            uint32 index = slot(key);
+            while (entries[index].key != EmptyKey
+                && entries[index].key != key)
+                    index = (index + 1) & mask;
+            if (entries[index].key == EmptyKey)
+                ++count;
+            entries[index].key = key;
+            entries[index].distance += distance;
+        }
+    }
+
+    [[nodiscard]] int16 Kern::operator() (
+        uint16 left,
+        uint16 right) const noexcept
+    {
+        if (entries.empty())
+            return 0;
+        uint32 const key = (uint32{left} << 16) | right;
+        for (uint32 index = slot(key); entries[index].key != EmptyKey;
+            index = (index + 1) & mask)
+                if (entries[index].key == key)
+                    return entries[index].distance;
+        return 0;
     }
 
 }
@@ -23,10 +23,11 @@
  *  3. This notice may not be removed or altered from any source
  *  distribution
  */
-#include <MPGL/Mathematics/FastFunctions.hpp>
 #include <MPGL/Core/Text/FontRasterizer.hpp>
+#include <MPGL/Mathematics/Systems.hpp>
 
-#include <math.h>
+#include <algorithm>
+#include <cmath>
 
 namespace mpgl {
 
@@ -34,14 +35,9 @@ namespace mpgl {
         FontData const& mainData,
         GlyphData const& glyph,
         size_type size)
-            : lastPosition{0, 0}, pixelSetter{
-                &FontRasterizer::deducingPixelSetter}, size{size},
-                aaCoefficient{fast2Sqrt(
-                context.windowOptions.antiAliasingSamples)},
-            mainData{mainData}, glyph{glyph},
-            ascending{false}
+            : size{size}, mainData{mainData}, glyph{glyph}
     {
-        primitiveQueue.reserve(3);
+        dimensions = canvaDimensions();
         separateContours(glyph);
     }
 
@@ -50,8 +46,9 @@ namespace mpgl {
         auto const& ends = glyph.glyph.getGlyph().endPtsOfContours;
         Contour contour;
         for (uint16 i = 0, counter = 0; i != points.size(); ++i) {
-            addPoint(contour, points[i]);
-            if (ends[counter] == i) {
+            contour.push_back(ContourPoint{remapPoint(points[i].position),
+                points[i].onCurve});
+            if (counter < ends.size() && ends[counter] == i) {
                 contours.emplace_back(std::move(contour));
                 contour = Contour{};
                 ++counter;
@@ -59,60 +56,18 @@ namespace mpgl {
         }
     }
 
-    void FontRasterizer::addPoint(
-        Contour& contour,
-       GlyphPoint const& point)
-    {
-        if (!point.onCurve)
-            if (!contour.back().onCurve)
-                contour.emplace_back(
-                        (contour.back().position + remapPoint(
-                            point.position)) / 2.f, true);
-        contour.emplace_back(remapPoint(point.position),
-            point.onCurve);
-    }
-
     Bitmap FontRasterizer::operator() (void) noexcept {
-        auto canva = prepareCanva();
-        for (auto const& contour : contours) {
-            lastPosition = vectorCast<uint16>(
-                round(contour.front().position));
-            drawContourAndSetFlags(contour, canva);
-        }
-        fillContour(canva);
-        return performAntiAliasing(canva);
+        accumulator.assign(dimensions[0] * dimensions[1] + 1, 0.f);
+        for (auto const& contour : contours)
+            drawContour(contour);
+        return accumulate();
     }
 
-    FontRasterizer::Pixel
-        FontRasterizer::antiAliasePixels(
-            Bitmap const& canva,
-            size_type x,
-            size_type y) const noexcept
+    FontRasterizer::Dimensions FontRasterizer::canvaDimensions(
+        void) const noexcept
     {
-        x *= aaCoefficient;
-        y *= aaCoefficient;
-        size_type sum = 0;
-        for (uint8 i = 0; i != aaCoefficient; ++i)
-            for (uint j = 0; j != aaCoefficient; ++j)
-                sum += canva[y + i][x + j];
-        return sum / (aaCoefficient * aaCoefficient);
-    }
-
-    Bitmap FontRasterizer::performAntiAliasing(
-        Bitmap& canva) const noexcept
-    {
-        if (aaCoefficient == 1)
-            return canva;
-        Bitmap antiAliased{canva.size() / size_type(aaCoefficient)};
-        for (size_type y = 0; y < antiAliased.getHeight(); ++y)
-            for (size_type x = 0; x < antiAliased.getWidth(); ++x)
-                antiAliased[y][x] = antiAliasePixels(canva, x, y);
-        return antiAliased;
-    }
-
-    Bitmap FontRasterizer::prepareCanva(void) const noexcept {
         auto dimensions = remapPoint(glyph.glyph.getMaxDimensions());
-        return Bitmap{vectorCast<size_type>(ceil(dimensions + 1.f))};
+        return vectorCast<size_type>(ceil(dimensions + 1.f));
     }
 
     Vector2f FontRasterizer::remapPoint(
@@ -123,150 +78,113 @@ namespace mpgl {
             / float32(mainData.unitsPerEm);
     }
 
-    void FontRasterizer::drawContourAndSetFlags(
-        Contour const& contour,
-        Bitmap& canva) noexcept
-    {
-        pixelSetter = &FontRasterizer::deducingPixelSetter;
-        for (auto const& point : contour)
-            drawPrimitive(canva, point);
-        drawPrimitive(canva, contour.front());
-        primitiveQueue.clear();
-    }
-
-    void FontRasterizer::drawPrimitive(
-        Bitmap& canva,
-        Point const& point) noexcept
-    {
-        primitiveQueue.push_back(point);
-        if (primitiveQueue.size() == 2) {
-            if (!primitiveQueue.back().onCurve)
-                return;
-            drawLine(canva);
-        } else if (primitiveQueue.size() == 3)
-            drawBezierCurve(canva);
-    }
-
-    void FontRasterizer::clearQueue(void) noexcept {
-        primitiveQueue.erase(primitiveQueue.begin(),
-            primitiveQueue.end() - 1);
-    }
-
-    void FontRasterizer::drawLine(
-        Bitmap& canva) noexcept
-    {
-        auto const& firstVertex = primitiveQueue[0].position;
-        auto const& secondVertex = primitiveQueue[1].position;
-        if (std::abs(firstVertex[0] - secondVertex[0]) >
-                std::abs(firstVertex[1] - secondVertex[1]))
-            drawLineByAxis<0>(canva, firstVertex, secondVertex);
-        else
-            drawLineByAxis<1>(canva, firstVertex, secondVertex);
-        clearQueue();
+    void FontRasterizer::drawContour(Contour const& contour) noexcept {
+        walkContour(contour,
+            [this](Vector2f const& begin, Vector2f const& end)
+                { drawLine(begin, end); },
+            [this](Vector2f const& begin, Vector2f const& control,
+                Vector2f const& end)
+                    { drawBezierCurve(begin, control, end); });
     }
 
     void FontRasterizer::drawBezierCurve(
-        Bitmap& canva) noexcept
+        Vector2f const& firstVertex,
+        Vector2f const& secondVertex,
+        Vector2f const& thirdVertex) noexcept
     {
-        auto const& firstVertex = primitiveQueue[0].position;
-        auto const& secondVertex = primitiveQueue[1].position;
-        auto const& thridVertex = primitiveQueue[2].position;
-        auto samples = getBezierSamples(firstVertex, secondVertex, thridVertex);
-        for (float32 t = 0, step = 1.f / samples; t < 1.f; t += step) {
-            auto result = (1.f - t) * ((1.f - t) * firstVertex + t * secondVertex)
-                + t * ((1.f - t) * secondVertex + t * thridVertex);
-            setCanvaPixel<0>(canva, std::round(result[0]), result[1]);
+        auto const samples = quadraticBezierSegments(firstVertex,
+            secondVertex, thirdVertex, Tolerance);
+        Vector2f last = firstVertex;
+        for (std::size_t i = 1; i < samples; ++i) {
+            float32 const t = float32(i) / samples;
+            auto result = (1.f - t) * ((1.f - t) * firstVertex
+                + t * secondVertex) + t * ((1.f - t) * secondVertex
+                + t * thirdVertex);
+            drawLine(last, result);
+            last = result;
         }
-        setCanvaPixel<0>(canva, std::round(thridVertex[0]), thridVertex[1]);
-        clearQueue();
+        drawLine(last, thirdVertex);
     }
 
-    FontRasterizer::size_type
-        FontRasterizer::getBezierSamples(
-            Vector2f const& firstVertex,
-            Vector2f const& secondVertex,
-            Vector2f const& thirdVertex) const noexcept
-    {
-        auto line = (secondVertex - firstVertex).length();
-        line += (thirdVertex - secondVertex).length();
-        return static_cast<size_type>(1.41f * std::ceil(line));
-    }
-
-    void FontRasterizer::defaultPixelSetter(Bitmap& canva,
-        Vector2<uint16> const& position) noexcept
-    {
-        if (position[1] == lastPosition[1]) {
-            if (!canva[position])
-                canva[position] = Hit;
-        } else {
-            if (ascending)
-                correctWhenTrue(canva, lastPosition, position,
-                    std::less<>{});
-            else
-                correctWhenTrue(canva, lastPosition, position,
-                    std::greater<>{});
-            canva[position] = canva[position] == Flag ? Hit : Flag;
-        }
-    }
-
-    void FontRasterizer::deducingPixelSetter(
-        Bitmap& canva,
-        Vector2<uint16> const& position) noexcept
+    void FontRasterizer::drawLine(
+        Vector2f const& firstVertex,
+        Vector2f const& secondVertex) noexcept
     {
-        if (position[1] == lastPosition[1]) {
-            if (!canva[position])
-                canva[position] = Hit;
-        } else {
-            ascending = lastPosition[1] < position[1];
-            canva[position] = canva[position] == Flag ? Hit : Flag;
-            pixelSetter = &FontRasterizer::defaultPixelSetter;
-        }
-    }
-
-    void FontRasterizer::fillContour(Bitmap& canva) const noexcept {
-        for (size_type i = 0; i != canva.getHeight(); ++i) {
-            auto& row = canva[i];
-            if (auto pixels = rasterizeLine(row))
-                std::ranges::copy(*pixels, row.begin());
-            else {  // slow but i have no time to fix this
-                tryRepairBrokenPixel(row, i);
-                if (auto pixels = rasterizeLine(row))
-                    std::ranges::copy(*pixels, row.begin());
-                else
-                    std::ranges::copy(canva[i == 0 ? i + 1 :
-                        i - 1], row.begin());
+        if (firstVertex[1] == secondVertex[1])
+            return;
+        /// the upward edges add the coverage, the downward ones
+        /// remove it
+        bool const upward = firstVertex[1] < secondVertex[1];
+        float32 const direction = upward ? 1.f : -1.f;
+        auto const& begin = upward ? firstVertex : secondVertex;
+        auto const& end = upward ? secondVertex : firstVertex;
+        if (end[1] <= 0.f)
+            return;
+        float32 const slope = (end[0] - begin[0]) / (end[1] - begin[1]);
+        float32 const width = dimensions[0];
+        float32 const bottom = std::max(begin[1], 0.f);
+        float32 x = begin[0] + slope * (bottom - begin[1]);
+        size_type const last = std::min(float32(dimensions[1]),
+            std::ceil(end[1]));
+        for (size_type y = std::floor(bottom); y < last; ++y) {
+            float32 const height = std::min(y + 1.f, end[1])
+                - std::max(float32(y), bottom);
+            float32 const next = x + slope * height;
+            float32 const area = height * direction;
+            float32 const left = std::clamp(std::min(x, next),
+                0.f, width);
+            float32 const right = std::clamp(std::max(x, next),
+                0.f, width);
+            auto row = accumulator.begin() + y * dimensions[0];
+            size_type const leftCell = std::floor(left);
+            size_type const rightCell = std::ceil(right);
+            if (rightCell <= leftCell + 1) {
+                /// the segment lies in a single cell
+                float32 const middle = (left + right) / 2.f - leftCell;
+                row[leftCell] += area * (1.f - middle);
+                /// the segment lying on the right border leaves
+                /// nothing for the next cell
+                if (leftCell != dimensions[0])
+                    row[leftCell + 1] += area * middle;
+            } else {
+                /// the segment spreads over several cells
+                float32 const inverse = 1.f / (right - left);
+                float32 const leftPart = left - leftCell;
+                float32 const rightPart = right - rightCell + 1.f;
+                float32 const first = .5f * inverse
+                    * (1.f - leftPart) * (1.f - leftPart);
+                float32 const lastArea = .5f * inverse
+                    * rightPart * rightPart;
+                row[leftCell] += area * first;
+                float32 covered = first;
+                for (size_type cell = leftCell + 1;
+                    cell + 1 < rightCell; ++cell)
+                {
+                    float32 const part = cell == leftCell + 1
+                        ? inverse * (1.5f - leftPart) - first
+                        : inverse;
+                    row[cell] += area * part;
+                    covered += part;
+                }
+                row[rightCell - 1] += area * (1.f - covered - lastArea);
+                row[rightCell] += area * lastArea;
             }
+            x = next;
         }
     }
 
-    void FontRasterizer::tryRepairBrokenPixel(
-        BitmapRow& row,
-        size_type index) const noexcept
-    {
-        for (auto const& contour : contours) {
-            if (std::round(contour.front().position[1]) == index) {
-                uint16 brokenPixel = std::round(
-                    contour.front().position[0]);
-                row[brokenPixel] ^= Mask;
-                break;
+    Bitmap FontRasterizer::accumulate(void) const noexcept {
+        Bitmap canva{dimensions};
+        float32 sum = 0.f;
+        for (size_type y = 0; y != dimensions[1]; ++y) {
+            auto row = accumulator.begin() + y * dimensions[0];
+            for (size_type x = 0; x != dimensions[0]; ++x) {
+                sum += row[x];
+                canva[y][x] = static_cast<uint8>(std::round(255.f
+                    * std::min(std::abs(sum), 1.f)));
             }
         }
-    }
-
-    FontRasterizer::CanvaRow FontRasterizer::rasterizeLine(
-        BitmapRow& row) const noexcept
-    {
-        PixelRow pixelRow(row.size(), 0);
-        bool flag = false;
-        for (size_type i = 0; i != row.size(); ++i) {
-            if (row[i] == Flag) {
-                flag = !flag;
-                pixelRow[i] = Hit;
-            } else if (flag)
-                pixelRow[i] = Hit;
-        }
-        if (flag) return {};
-        return {pixelRow};
+        return canva;
     }
 
 }
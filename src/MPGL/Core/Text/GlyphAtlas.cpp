@@ -0,0 +1,97 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#include <MPGL/Core/Text/GlyphAtlas.hpp>
+
+#include <algorithm>
+#include <ranges>
+#include <bit>
+
+namespace mpgl {
+
+    GlyphAtlas::GlyphAtlas(Vector2u const& pageDimensions)
+        : pageDimensions{pageDimensions} {}
+
+    [[nodiscard]] Vector2u GlyphAtlas::pageDimensionsFor(
+        std::size_t size) noexcept
+    {
+        uint32 const side = std::bit_ceil(static_cast<uint32>(
+            std::clamp<std::size_t>(GlyphsPerSide * size,
+                MinPageSize, MaxPageSize)));
+        return {side, side};
+    }
+
+    GlyphAtlas::Page& GlyphAtlas::addPage(
+        Vector2u const& dimensions)
+    {
+        Texture texture{Bitmap{dimensions[0], dimensions[1]}, {
+            Texture::Options::TextureWrapper::ClampToEdge,
+            Texture::Options::TextureWrapper::ClampToEdge,
+            Texture::Options::MinifyingTextureFilter::Linear,
+            Texture::Options::MagnifyingTextureFilter::Linear,
+            {},
+            false
+        }};
+        return pages.emplace_back(std::move(texture),
+            AtlasPacker{dimensions, Padding});
+    }
+
+    GlyphAtlas::TextureCoords GlyphAtlas::makeCoords(
+        Page const& page,
+        Vector2u const& position,
+        Bitmap const& bitmap) noexcept
+    {
+        Vector2f const dimensions = vectorCast<float32>(
+            page.packer.getDimensions());
+        Vector2f const begin = vectorCast<float32>(position);
+        Vector2f const end = begin + Vector2f{
+            float32(bitmap.getWidth()), float32(bitmap.getHeight())};
+        return {begin / dimensions, end / dimensions};
+    }
+
+    [[nodiscard]] GlyphAtlas::Region GlyphAtlas::insert(
+        Bitmap const& bitmap)
+    {
+        Vector2u const dimensions{
+            static_cast<uint32>(bitmap.getWidth()),
+            static_cast<uint32>(bitmap.getHeight())};
+        for (auto& page : pages | std::views::reverse) {
+            if (auto position = page.packer.insert(dimensions)) {
+                page.texture.update(bitmap, *position);
+                return {page.texture,
+                    makeCoords(page, *position, bitmap)};
+            }
+        }
+        auto& page = addPage({
+            std::max(pageDimensions[0],
+                std::bit_ceil(dimensions[0] + Padding)),
+            std::max(pageDimensions[1],
+                std::bit_ceil(dimensions[1] + Padding))});
+        auto const position = *page.packer.insert(dimensions);
+        page.texture.update(bitmap, position);
+        return {page.texture, makeCoords(page, position, bitmap)};
+    }
+
+}
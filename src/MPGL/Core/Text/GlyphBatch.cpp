@@ -0,0 +1,112 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#include <MPGL/Core/Context/Buffers/BindGuard.hpp>
+#include <MPGL/Core/Text/GlyphBatch.hpp>
+
+namespace mpgl {
+
+    template <Dimension Dim>
+    GlyphBatch<Dim>::GlyphBatch(void) : isModified{true} {
+        initializeBuffers();
+    }
+
+    template <Dimension Dim>
+    GlyphBatch<Dim>::GlyphBatch(GlyphBatch const&)
+        : isModified{true}
+    {
+        initializeBuffers();
+    }
+
+    template <Dimension Dim>
+    GlyphBatch<Dim>& GlyphBatch<Dim>::operator= (
+        GlyphBatch const&) noexcept
+    {
+        isModified = true;
+        return *this;
+    }
+
+    template <Dimension Dim>
+    void GlyphBatch<Dim>::initializeBuffers(void) const noexcept {
+        BindGuard<VertexArray> vaoGuard{vertexArray};
+        BindGuard<VertexBuffer> vboGuard{vertexBuffer};
+        elementBuffer.bind();
+        vertexArray.setArrayData(VertexArray::VertexTag<Vertex>{});
+    }
+
+    template <Dimension Dim>
+    void GlyphBatch<Dim>::actualize(
+        Sprites const& sprites) const noexcept
+    {
+        Vertices vertices;
+        Indices indices;
+        vertices.reserve(4 * sprites.size());
+        indices.reserve(SpriteIndices.size() * sprites.size());
+        runs.clear();
+        for (auto const& sprite : sprites) {
+            uint32 const base = vertices.size();
+            vertices.insert(vertices.end(),
+                sprite.begin(), sprite.end());
+            auto const& texture = sprite.getTexture();
+            if (runs.empty() || &runs.back().texture.getTextureBuffer()
+                != &texture.getTextureBuffer())
+            {
+                runs.push_back(Run{texture,
+                    indices.size() * sizeof(uint32), 0});
+            }
+            for (uint32 const index : SpriteIndices)
+                indices.push_back(base + index);
+            runs.back().count += SpriteIndices.size();
+        }
+        BindGuard<VertexArray> vaoGuard{vertexArray};
+        {
+            BindGuard<VertexBuffer> vboGuard{vertexBuffer};
+            vertexBuffer.setBufferData(vertices,
+                VertexBuffer::BufferType::Dynamic);
+        }
+        elementBuffer.bind();
+        elementBuffer.setBufferData(indices,
+            ElementArrayBuffer::BufferType::Dynamic);
+    }
+
+    template <Dimension Dim>
+    void GlyphBatch<Dim>::draw(
+        Sprites const& sprites) const noexcept
+    {
+        if (isModified) {
+            actualize(sprites);
+            isModified = false;
+        }
+        BindGuard<VertexArray> vaoGuard{vertexArray};
+        for (auto const& run : runs) {
+            auto const& textureBuffer = run.texture.getTextureBuffer();
+            textureBuffer.activate();
+            BindGuard textureGuard{textureBuffer};
+            vertexArray.drawElements(VertexArray::DrawMode::Triangles,
+                run.count, DataType::UInt32, run.offset);
+        }
+    }
+
+}
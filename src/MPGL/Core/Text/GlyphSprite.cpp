@@ -34,13 +34,15 @@ namespace mpgl {
     GlyphSprite<Dim>::Vertices
         GlyphSprite<Dim>::makeVertices(
             Color const& color,
-            Positions const& positions)
+            Positions const& positions,
+            TextureCoords const& coords)
     {
+        auto const& [min, max] = coords;
         return {
-            Vertex{positions[0], Vector2f{0.f, 0.f}, color},
-            Vertex{positions[1], Vector2f{0.f, 1.f}, color},
-            Vertex{positions[2], Vector2f{1.f, 1.f}, color},
-            Vertex{positions[3], Vector2f{1.f, 0.f}, color}
+            Vertex{positions[0], Vector2f{min[0], min[1]}, color},
+            Vertex{positions[1], Vector2f{min[0], max[1]}, color},
+            Vertex{positions[2], Vector2f{max[0], max[1]}, color},
+            Vertex{positions[3], Vector2f{max[0], min[1]}, color}
         };
     }
 
@@ -71,13 +73,14 @@ namespace mpgl {
         Vector const& firstVertex,
         Vector const& secondVertex,
         Vector const& thirdVertex,
-        Color const& color)
+        Color const& color,
+        TextureCoords const& coords)
             : Texturable<Dim>{texture}, vertices{makeVertices(color, {
                 firstVertex,
                 secondVertex,
                 thirdVertex,
                 thirdVertex - secondVertex + firstVertex
-            })}
+            }, coords)}
     {
         initializeBuffers();
     }
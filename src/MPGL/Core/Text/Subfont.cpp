@@ -23,6 +23,7 @@
  *  3. This notice may not be removed or altered from any source
  *  distribution
  */
+#include <MPGL/Core/Text/DistanceFieldGenerator.hpp>
 #include <MPGL/Core/Text/FontRasterizer.hpp>
 #include <MPGL/Core/Text/Subfont.hpp>
 
@@ -30,11 +31,27 @@
 
 namespace mpgl {
 
-    Subfont::Subfont(std::string const& path) {
-        TTFLoader loader{path};
-        glyphMap = std::move(loader.getGlyphs());
-        fontData = std::move(loader.getFontData());
-        kern = std::move(loader.getKern());
+    Subfont::Subfont(std::string const& path)
+        : Subfont{TTFLoader<>{path}} {}
+
+    Subfont::Subfont(
+        std::string const& path,
+        MappedFile&& file)
+            : Subfont{TTFLoader<>{path, std::move(file)}} {}
+
+    Subfont::Subfont(TTFLoader<>&& loader)
+        : face{std::move(loader)}
+    {
+        fontData = face.getFontData();
+        kern = face.getKern();
+    }
+
+    Subfont::Iter Subfont::findGlyph(uint16 number) {
+        if (auto iter = glyphMap.find(number); iter != glyphMap.end())
+            return iter;
+        if (auto glyph = face.getGlyph(number))
+            return glyphMap.emplace(number, std::move(*glyph)).first;
+        return glyphMap.end();
     }
 
     Subfont::FontGlyph Subfont::operator() (
@@ -43,11 +60,14 @@ namespace mpgl {
         auto& map = getMap(level);
         auto iter = map.find(number);
         if (iter == map.end()) {
-            auto glpyhIter = glyphMap.find(number);
+            auto glpyhIter = findGlyph(number);
             if (glpyhIter == glyphMap.end())
                 return {};
-            iter = map.emplace(number,
-                createGlyph(glpyhIter, level)).first;
+            commitPrerendered();
+            iter = map.find(number);
+            if (iter == map.end())
+                iter = map.emplace(number,
+                    createGlyph(glpyhIter, level)).first;
         }
         return {std::cref(iter->second)};
     }
@@ -64,6 +84,117 @@ namespace mpgl {
         return {};
     }
 
+    Subfont::FontGlyph Subfont::distanceField(uint16 number) {
+        auto iter = fieldMap.find(number);
+        if (iter == fieldMap.end()) {
+            auto glpyhIter = findGlyph(number);
+            if (glpyhIter == glyphMap.end())
+                return {};
+            iter = fieldMap.emplace(number,
+                createDistanceField(glpyhIter)).first;
+        }
+        return {std::cref(iter->second)};
+    }
+
+    Subfont::FontGlyph Subfont::distanceField(uint16 number) const {
+        auto iter = fieldMap.find(number);
+        if (iter == fieldMap.end())
+            return {};
+        return {std::cref(iter->second)};
+    }
+
+    [[nodiscard]] Subfont::Futures Subfont::prerender(
+        async::Threadpool& threadpool,
+        CodePoints const& numbers,
+        Levels const& levels)
+    {
+        commitPrerendered();
+        Futures futures;
+        for (uint8 const level : levels) {
+            auto const& map = getMap(level);
+            auto& pending = pendingMap[level];
+            CodePoints batch;
+            GlyphsData glyphs;
+            for (uint16 const number : numbers) {
+                if (map.contains(number) || pending.contains(number))
+                    continue;
+                auto iter = findGlyph(number);
+                if (iter == glyphMap.end())
+                    continue;
+                pending.insert(number);
+                batch.push_back(number);
+                glyphs.push_back(iter->second);
+                if (batch.size() == prerenderBatch)
+                    futures.push_back(schedulePrerendering(threadpool,
+                        std::exchange(batch, {}),
+                        std::exchange(glyphs, {}), level));
+            }
+            if (!batch.empty())
+                futures.push_back(schedulePrerendering(threadpool,
+                    std::move(batch), std::move(glyphs), level));
+        }
+        return futures;
+    }
+
+    std::future<void> Subfont::schedulePrerendering(
+        async::Threadpool& threadpool,
+        CodePoints&& numbers,
+        GlyphsData&& glyphs,
+        uint8 level) const
+    {
+        return threadpool.appendTask(
+            [queue = prerendered, data = fontData, level,
+                numbers = std::move(numbers),
+                glyphs = std::move(glyphs)]() -> void
+        {
+            PrerenderedGlyphs rendered;
+            rendered.reserve(glyphs.size());
+            for (std::size_t i = 0; i != glyphs.size(); ++i) {
+                BitmapVar bitmap;
+                if (glyphs[i].glyph.exist())
+                    bitmap = FontRasterizer{data, glyphs[i],
+                        shiftBase << level}();
+                rendered.push_back(PrerenderedGlyph{
+                    numbers[i], level, std::move(bitmap)});
+            }
+            Guard guard{queue->mutex};
+            std::ranges::move(rendered,
+                std::back_inserter(queue->glyphs));
+        });
+    }
+
+    void Subfont::commitPrerendered(void) {
+        PrerenderedGlyphs rendered;
+        {
+            Guard guard{prerendered->mutex};
+            rendered.swap(prerendered->glyphs);
+        }
+        for (auto& [number, level, bitmap] : rendered) {
+            pendingMap[level].erase(number);
+            auto& map = getMap(level);
+            if (map.contains(number))
+                continue;
+            RegionVar region;
+            if (bitmap)
+                region = getAtlas(level).insert(*bitmap);
+            map.emplace(number, makeGlyph(
+                glyphMap.find(number)->second, level, region));
+        }
+    }
+
+    [[nodiscard]] int16 Subfont::getKerning(
+        uint16 left,
+        uint16 right) const
+    {
+        if (kern.empty())
+            return 0;
+        auto leftIndex = face.getGlyphIndex(left);
+        auto rightIndex = face.getGlyphIndex(right);
+        if (leftIndex && rightIndex)
+            return kern(*leftIndex, *rightIndex);
+        return 0;
+    }
+
     Subfont::RasterMap& Subfont::getMap(uint8 level) {
         auto iter = sizeMap.find(level);
         if (iter == sizeMap.end())
@@ -97,30 +228,63 @@ namespace mpgl {
     }
 
     Glyph Subfont::createGlyph(Iter const& iter, uint8 level) {
+        return makeGlyph(iter->second, level,
+            renderTexture(iter, level));
+    }
+
+    Glyph Subfont::makeGlyph(
+        GlyphData const& glyphData,
+        uint8 level,
+        RegionVar const& region) const noexcept
+    {
         std::size_t size = shiftBase << level;
-        auto const& glyphData = iter->second;
         auto&& dimensions = getDimensions(glyphData, size);
         auto&& bearings = getBearings(glyphData, size);
         uint16 advanceWidth = size * glyphData.advanceWidth
             / fontData.unitsPerEm;
-        return Glyph{renderTexture(iter, size),
-            dimensions, bearings, advanceWidth};
+        if (region)
+            return Glyph{region->texture, dimensions,
+                bearings, advanceWidth, region->coords};
+        return Glyph{{}, dimensions, bearings, advanceWidth};
+    }
+
+    Glyph Subfont::createDistanceField(Iter const& iter) {
+        auto const& glyphData = iter->second;
+        auto&& bearings = getBearings(glyphData, distanceFieldSize);
+        uint16 advanceWidth = distanceFieldSize
+            * glyphData.advanceWidth / fontData.unitsPerEm;
+        if (!glyphData.glyph.exist())
+            return Glyph{{}, getDimensions(glyphData,
+                distanceFieldSize), bearings, advanceWidth};
+        DistanceFieldGenerator generator{fontData, glyphData,
+            distanceFieldSize, distanceFieldSpread};
+        auto const field = generator();
+        auto region = fieldAtlas.insert(field);
+        int32 const spread = distanceFieldSpread;
+        return Glyph{region.texture, Vector2u{
+                static_cast<uint32>(field.getWidth()),
+                static_cast<uint32>(field.getHeight())},
+            bearings - Vector2i{spread, spread}, advanceWidth,
+            region.coords};
+    }
+
+    GlyphAtlas& Subfont::getAtlas(uint8 level) {
+        auto iter = atlasMap.find(level);
+        if (iter == atlasMap.end())
+            iter = atlasMap.emplace(level, GlyphAtlas{
+                GlyphAtlas::pageDimensionsFor(shiftBase << level)
+            }).first;
+        return iter->second;
     }
 
-    Subfont::TextureVar Subfont::renderTexture(
-        Iter const& iter, std::size_t size) const
+    Subfont::RegionVar Subfont::renderTexture(
+        Iter const& iter, uint8 level)
     {
         if (!iter->second.glyph.exist())
             return {};
-        FontRasterizer raster{fontData, iter->second, size};
-        return {Texture{raster(), {
-            Texture::Options::TextureWrapper::ClampToEdge,
-            Texture::Options::TextureWrapper::ClampToEdge,
-            Texture::Options::MinifyingTextureFilter::Linear,
-            Texture::Options::MagnifyingTextureFilter::Linear,
-            {},
-            false
-        }}};
+        FontRasterizer raster{fontData, iter->second,
+            shiftBase << level};
+        return {getAtlas(level).insert(raster())};
     }
 
 }
@@ -27,6 +27,7 @@
 #include <MPGL/Exceptions/SecurityUnknownPolicyException.hpp>
 #include <MPGL/Core/Text/TTFLoader.hpp>
 
+#include <algorithm>
 #include <fstream>
 #include <ranges>
 
@@ -38,14 +39,23 @@ namespace mpgl {
 
     template <security::SecurityPolicy Policy>
     TTFLoader<Policy>::TTFLoader(
-        [[maybe_unused]] Policy policy,
+        Policy policy,
         FileName const& fileName)
-            : fileName{fileName}
+            : TTFLoader{policy, fileName, openFile(fileName)} {}
+
+    template <security::SecurityPolicy Policy>
+    TTFLoader<Policy>::TTFLoader(
+        FileName const& fileName,
+        MappedFile&& file)
+            : TTFLoader{Policy{}, fileName, std::move(file)} {}
+
+    template <security::SecurityPolicy Policy>
+    TTFLoader<Policy>::TTFLoader(
+        [[maybe_unused]] Policy policy,
+        FileName const& fileName,
+        MappedFile&& file)
+            : file{std::move(file)}, fileName{fileName}
     {
-        if (auto stream = FileIO::readFile(fileName))
-            buffer = stream->str();
-        else
-            throw TTFLoaderFileCorruptionException{fileName};
         try {
             parseFile(getIterator());
         } catch (std::out_of_range const&) {
@@ -53,11 +63,26 @@ namespace mpgl {
         }
     }
 
+    template <security::SecurityPolicy Policy>
+    MappedFile TTFLoader<Policy>::openFile(FileName const& fileName) {
+        if (auto file = MappedFile::open(fileName,
+            MappedFile::Access::Random))
+                return std::move(*file);
+        throw TTFLoaderFileCorruptionException{fileName};
+    }
+
     template <security::SecurityPolicy Policy>
     TTFLoader<Policy>::Iter
         TTFLoader<Policy>::getIterator(void) const
     {
-        return makeIterator<Policy>(buffer);
+        return makeIterator<Policy>(file);
+    }
+
+    template <security::SecurityPolicy Policy>
+    TTFLoader<Policy>::Iter
+        TTFLoader<Policy>::getIterator(Table table) const
+    {
+        return getIterator() + getTable(table).offset;
     }
 
     template <security::SecurityPolicy Policy>
@@ -66,54 +91,151 @@ namespace mpgl {
         loadHead();
         loadMaxp();
         loadHhea();
-        loadHmtx();
         loadLoca();
-        loadKern();
         loadCmap();
     }
 
+    template <security::SecurityPolicy Policy>
+    [[nodiscard]] TTFLoader<Policy>::IndexVar
+        TTFLoader<Policy>::getGlyphIndex(uint32 codePoint) const
+    {
+        auto segment = std::ranges::lower_bound(cmap, codePoint,
+            {}, &CmapSegment::endCode);
+        if (segment == cmap.end() || segment->startCode > codePoint)
+            return {};
+        uint32 index = codePoint;
+        if (segment->rangeOffset) {
+            try {
+                auto iter = getIterator() + (segment->rangeOffset
+                    + 2 * (codePoint - segment->startCode));
+                index = readType<uint16, true>(iter);
+            } catch (std::out_of_range const&) {
+                throw TTFLoaderFileCorruptionException{fileName};
+            }
+            if (!index)
+                return {};
+        }
+        if (uint16 glyph = (index + segment->idDelta) & 0xFFFF)
+            return { glyph };
+        return {};
+    }
+
+    template <security::SecurityPolicy Policy>
+    [[nodiscard]] TTFLoader<Policy>::GlyphVar
+        TTFLoader<Policy>::getGlyph(uint32 codePoint) const
+    {
+        auto index = getGlyphIndex(codePoint);
+        if (!index)
+            return {};
+        try {
+            return { createGlyph(*index) };
+        } catch (std::out_of_range const&) {
+            throw TTFLoaderFileCorruptionException{fileName};
+        }
+    }
+
     template <security::SecurityPolicy Policy>
     void TTFLoader<Policy>::loadMaxp(void) {
-        auto iter = getIterator() + tables["maxp"].offset;
+        auto iter = getIterator(Table::Maxp);
         std::advance(iter, 4);
         numGlyphs = readType<uint16, true>(iter);
     }
 
     template <security::SecurityPolicy Policy>
     void TTFLoader<Policy>::loadHhea(void) {
-        auto iter = getIterator() + tables["hhea"].offset;
-        std::advance(iter, 48);
+        auto iter = getIterator(Table::Hhea);
+        std::advance(iter, 34);
         numberOfHMetrics = readType<uint16, true>(iter);
+        if (numberOfHMetrics > numGlyphs)
+            throw TTFLoaderFileCorruptionException{fileName};
     }
 
     template <security::SecurityPolicy Policy>
     void TTFLoader<Policy>::loadLoca(void) {
-        locaTable = LocaTable{getIterator() + tables["loca"].offset,
-            indexFormat, numGlyphs};
+        auto const& table = getTable(Table::Loca);
+        if (std::size_t(table.offset) + table.length > file.size())
+            throw TTFLoaderFileCorruptionException{fileName};
+        locaTable = LocaTable{file.getSpan().subspan(table.offset,
+            table.length), indexFormat, numGlyphs};
+    }
+
+    template <security::SecurityPolicy Policy>
+    TTFLoader<Policy>::LongHorMatrix
+        TTFLoader<Policy>::getMetrics(uint16 index) const
+    {
+        if (index >= numGlyphs || !numberOfHMetrics)
+            throw std::out_of_range{"The glyph has no metrics"};
+        auto iter = getIterator(Table::Hmtx);
+        if (index < numberOfHMetrics) {
+            std::advance(iter, 4 * index);
+            uint16 advanceWidth = readType<uint16, true>(iter);
+            return LongHorMatrix{advanceWidth,
+                readType<int16, true>(iter)};
+        }
+        auto bearing = iter + (4 * numberOfHMetrics
+            + 2 * (index - numberOfHMetrics));
+        std::advance(iter, 4 * (numberOfHMetrics - 1));
+        return LongHorMatrix{readType<uint16, true>(iter),
+            readType<int16, true>(bearing)};
     }
 
     template <security::SecurityPolicy Policy>
-    GlyphData TTFLoader<Policy>::createGlyph(uint16 index) {
-        auto iter = getIterator() + tables["glyf"].offset;
+    GlyphData TTFLoader<Policy>::createGlyph(uint16 index) const {
         auto glyphOffset = locaTable(index);
         auto nextGlyph = locaTable(index + 1);
+        auto const metrics = getMetrics(index);
         if (glyphOffset == nextGlyph)
             return GlyphData{VectorizedGlyph{},
-                metrics.at(index).advanceWidth,
-                metrics.at(index).leftSideBearing};
-        return GlyphData{VectorizedGlyph{iter, glyphOffset, locaTable},
-            metrics.at(index).advanceWidth,
-            metrics.at(index).leftSideBearing};
+                metrics.advanceWidth, metrics.leftSideBearing};
+        return GlyphData{VectorizedGlyph{getIterator(Table::Glyf),
+                glyphOffset, locaTable},
+            metrics.advanceWidth, metrics.leftSideBearing};
     }
 
     template <security::SecurityPolicy Policy>
-    void TTFLoader<Policy>::loadKern(void) {
-        auto iter = getIterator() + tables["kern"].offset;
-        std::advance(iter, 2);
-        auto size = readType<uint16, true>(iter);
-        kernTable.reserve(size);
-        for (uint16 i = 0; i < size; ++i)
-            kernTable.emplace_back(iter);
+    [[nodiscard]] Kern TTFLoader<Policy>::getKern(void) const {
+        if (!getTable(Table::Kern).length)
+            return Kern{};
+        Kern::Pairs pairs;
+        try {
+            auto iter = getIterator(Table::Kern);
+            std::advance(iter, 2);
+            auto const size = readType<uint16, true>(iter);
+            for (uint16 i = 0; i < size; ++i) {
+                auto const subtable = iter;
+                std::advance(iter, 2);
+                auto const length = readType<uint16, true>(iter);
+                if (isHorizontalKern(readType<uint16, true>(iter)))
+                    loadKernPairs(iter, pairs);
+                iter = subtable + length;
+            }
+        } catch (std::out_of_range const&) {
+            throw TTFLoaderFileCorruptionException{fileName};
+        }
+        return Kern{pairs};
+    }
+
+    template <security::SecurityPolicy Policy>
+    bool TTFLoader<Policy>::isHorizontalKern(
+        uint16 coverage) noexcept
+    {
+        /// format 0, horizontal, not minimum, not cross-stream
+        return (coverage & 0xFF07) == 0x0001;
+    }
+
+    template <security::SecurityPolicy Policy>
+    void TTFLoader<Policy>::loadKernPairs(
+        Iter& iter,
+        Kern::Pairs& pairs)
+    {
+        auto const size = readType<uint16, true>(iter);
+        std::advance(iter, 6);
+        pairs.reserve(pairs.size() + size);
+        for (uint16 i = 0; i < size; ++i) {
+            uint32 key = readType<uint16, true>(iter) << 16;
+            key |= readType<uint16, true>(iter);
+            pairs.emplace_back(key, readType<int16, true>(iter));
+        }
     }
 
     template <security::SecurityPolicy Policy>
@@ -125,8 +247,15 @@ namespace mpgl {
         auto range = tablesRange | std::views::transform(
             [&iter]([[maybe_unused]] auto const& _){
                 return readNChars(4, iter); });
-        std::ranges::for_each(range, [this, &iter](auto const& tag)
-            { tables[tag] = TableDirectory{iter}; });
+        std::ranges::for_each(range, [this, &iter](auto const& tag) {
+            TableDirectory directory{iter};
+            if (auto found = std::ranges::find(TableTags, tag);
+                found != TableTags.end())
+                    tables[found - TableTags.begin()] = directory;
+        });
+        for (std::size_t i = 0; i != TablesCount; ++i)
+            if (!tables[i].length && i != std::size_t(Table::Kern))
+                throw TTFLoaderFileCorruptionException{fileName};
     }
 
     template <security::SecurityPolicy Policy>
@@ -138,7 +267,7 @@ namespace mpgl {
 
     template <security::SecurityPolicy Policy>
     void TTFLoader<Policy>::loadHead(void) {
-        auto iter = getIterator() + tables["head"].offset;
+        auto iter = getIterator(Table::Head);
         std::advance(iter, 12);
         if (readType<uint32, true>(iter) != 0x5F0F3CF5)
             throw TTFLoaderFileCorruptionException{fileName};
@@ -153,25 +282,6 @@ namespace mpgl {
         indexFormat = readType<int16, true>(iter);
     }
 
-    template <security::SecurityPolicy Policy>
-    void TTFLoader<Policy>::loadHmtx(void) {
-        auto iter = getIterator() + tables["hmtx"].offset;
-        metrics.reserve(numGlyphs);
-        for (uint16 i = 0; i != numberOfHMetrics; ++i)
-            metrics.emplace_back(iter);
-        auto advanceWidth = metrics.size() ?
-            metrics.back().advanceWidth : 0;
-        for (uint16 i = 0; i != (numGlyphs - numberOfHMetrics); ++i)
-            metrics.emplace_back(advanceWidth,
-                readType<int16, true>(iter));
-    }
-
-    template <security::SecurityPolicy Policy>
-    TTFLoader<Policy>::LongHorMatrix::LongHorMatrix(Iter& iter) {
-        advanceWidth = readType<uint16, true>(iter);
-        leftSideBearing = readType<int16, true>(iter);
-    }
-
     template <security::SecurityPolicy Policy>
     TTFLoader<Policy>::LongHorMatrix::LongHorMatrix(
         uint16 advanceWidth,
@@ -181,39 +291,49 @@ namespace mpgl {
 
     template <security::SecurityPolicy Policy>
     void TTFLoader<Policy>::loadCmap(void) {
-        auto iter = getIterator() + tables["cmap"].offset;
-        auto const begin = iter;
+        uint32 const begin = getTable(Table::Cmap).offset;
+        auto iter = getIterator(Table::Cmap);
         if (readType<uint16, true>(iter))
             throw TTFLoaderFileCorruptionException{fileName};
-        loadCmapSubtables(iter, begin);
-    }
-
-    template <security::SecurityPolicy Policy>
-    void TTFLoader<Policy>::loadCmapSubtables(
-        Iter& iter,
-        Iter const& begin)
-    {
-        uint16 end = readType<uint16, true>(iter);
-        for (uint16 i = 0;i < end; ++i) {
-            if (auto offset = readPlatform({iter})) {
-                auto subtableIter = begin + *offset;
-                if (readType<uint16, true>(subtableIter) == 4)
-                    Format4Subtable{subtableIter, *this};
-                else
-                    throw TTFLoaderFileCorruptionException{fileName};
+        uint16 const end = readType<uint16, true>(iter);
+        uint8 bestPriority = 0;
+        uint32 bestOffset = 0;
+        for (uint16 i = 0; i < end; ++i) {
+            EncodingRecord const record{iter};
+            auto subtableIter = getIterator() + (begin
+                + record.subtableOffset);
+            uint8 const priority = subtablePriority(record,
+                readType<uint16, true>(subtableIter));
+            if (priority > bestPriority) {
+                bestPriority = priority;
+                bestOffset = begin + record.subtableOffset;
             }
         }
+        if (!bestPriority)
+            throw TTFLoaderFileCorruptionException{fileName};
+        auto subtableIter = getIterator() + bestOffset;
+        if (readType<uint16, true>(subtableIter) == 12)
+            loadFormat12(subtableIter);
+        else
+            loadFormat4(subtableIter, bestOffset);
+        std::ranges::sort(cmap, {}, &CmapSegment::endCode);
     }
 
     template <security::SecurityPolicy Policy>
-    std::optional<uint32> TTFLoader<Policy>::readPlatform(
-        EncodingRecord const& record)
+    uint8 TTFLoader<Policy>::subtablePriority(
+        EncodingRecord const& record,
+        uint16 format) noexcept
     {
-        bool windowsPlatform = (record.platformID == 3) &&
-            (record.encodingID < 2 || record.encodingID == 10);
-        if (windowsPlatform)
-            return {record.subtableOffset};
-        return {};
+        bool const unicode = record.platformID == 0;
+        bool const windows = record.platformID == 3;
+        if (format == 12 && ((windows && record.encodingID == 10)
+            || (unicode && (record.encodingID == 4
+                || record.encodingID == 6))))
+                    return 2;
+        if (format == 4 && ((windows && record.encodingID < 2)
+            || (unicode && record.encodingID < 4)))
+                return 1;
+        return 0;
     }
 
     template <security::SecurityPolicy Policy>
@@ -224,63 +344,45 @@ namespace mpgl {
     }
 
     template <security::SecurityPolicy Policy>
-    TTFLoader<Policy>::Format4Subtable::Format4Subtable(
-        Iter& iter,
-        TTFLoader& loader)
-    {
+    void TTFLoader<Policy>::loadFormat4(Iter iter, uint32 offset) {
         std::advance(iter, 4);
-        auto limit = reserve(readType<uint16, true>(iter) >> 1);
+        uint16 const segCount = readType<uint16, true>(iter) >> 1;
         std::advance(iter, 6);
-        auto reader = [&iter]([[maybe_unused]] uint16 const& _)
-            { return readType<uint16, true>(iter); };
-        std::ranges::transform(limit, std::back_inserter(endCode), reader);
-        std::advance(iter, 2);
-        std::ranges::transform(limit, std::back_inserter(startCode), reader);
-        std::ranges::transform(limit, std::back_inserter(idDelta), reader);
-        rangeOffsets = iter;
-        std::ranges::transform(limit, std::back_inserter(idRangeOffsets), reader);
-        loadGlyphs(loader);
-    }
-
-    template <security::SecurityPolicy Policy>
-    auto TTFLoader<Policy>::Format4Subtable::reserve(
-        uint16 segCount)
-    {
-        endCode.reserve(segCount);
-        startCode.reserve(segCount);
-        idDelta.reserve(segCount);
-        idRangeOffsets.reserve(segCount);
-        return std::views::iota(uint16(0), segCount);
-    }
-
-    template <security::SecurityPolicy Policy>
-    void TTFLoader<Policy>::Format4Subtable::loadGlyphs(
-        TTFLoader& loader)
-    {
-        for (std::size_t i = 0; i != endCode.size(); ++i)
-            for (int64 j = startCode[i];
-                j != endCode[i] + 1; ++j)
-                    tryReadGlyph(i, j, loader);
+        auto startCodes = iter + (2 * segCount + 2);
+        auto idDeltas = startCodes + 2 * segCount;
+        auto idRangeOffsets = idDeltas + 2 * segCount;
+        /// the range offsets are relative to their own position
+        uint32 rangeOffsetsBegin = offset + 16 + 6 * segCount;
+        cmap.reserve(segCount);
+        for (uint16 i = 0; i != segCount; ++i) {
+            uint32 const endCode = readType<uint16, true>(iter);
+            uint32 const startCode = readType<uint16, true>(
+                startCodes);
+            uint32 const idDelta = readType<uint16, true>(idDeltas);
+            uint32 rangeOffset = readType<uint16, true>(
+                idRangeOffsets);
+            if (rangeOffset)
+                rangeOffset += rangeOffsetsBegin + 2 * i;
+            if (startCode <= endCode && startCode != 0xFFFF)
+                cmap.push_back(CmapSegment{startCode, endCode,
+                    idDelta, rangeOffset});
+        }
     }
 
     template <security::SecurityPolicy Policy>
-    void TTFLoader<Policy>::Format4Subtable::tryReadGlyph(
-        std::size_t const& i,
-        std::size_t const& j,
-        TTFLoader& loader)
-    {
-        uint16 index = 0;
-        if (auto&& [iter, empty] = loader.glyphMap.try_emplace(j,
-            GlyphData{}); empty)
-        {
-            if (idRangeOffsets[i]) {
-                auto glyphOffset = rangeOffsets + (j
-                    - startCode[i] + i) * 2 + idRangeOffsets[i];
-                if ((index = readType<uint16, true>(glyphOffset)))
-                    index = (index + idDelta[i]) & 0xFFFF;
-            } else
-                index = (j + idDelta[i]) & 0xFFFF;
-            iter->second = std::move(loader.createGlyph(index));
+    void TTFLoader<Policy>::loadFormat12(Iter iter) {
+        std::advance(iter, 10);
+        uint32 const groups = readType<uint32, true>(iter);
+        if (std::size_t(groups) * 12 > file.size())
+            throw TTFLoaderFileCorruptionException{fileName};
+        cmap.reserve(groups);
+        for (uint32 i = 0; i != groups; ++i) {
+            uint32 const startCode = readType<uint32, true>(iter);
+            uint32 const endCode = readType<uint32, true>(iter);
+            uint32 const startGlyph = readType<uint32, true>(iter);
+            if (startCode <= endCode)
+                cmap.push_back(CmapSegment{startCode, endCode,
+                    startGlyph - startCode, 0});
         }
     }
 
@@ -155,12 +155,12 @@ namespace mpgl {
 
     template <Dimension Dim>
     Text<Dim>::String const
-        Text<Dim>::shaderType(void)
+        Text<Dim>::shaderType(bool distanceField)
     {
         if constexpr (TwoDimensional<Dim>)
-            return "MPGL/2D/Glyph";
+            return distanceField ? "MPGL/2D/GlyphSDF" : "MPGL/2D/Glyph";
         else
-            return "MPGL/3D/Glyph";
+            return distanceField ? "MPGL/3D/GlyphSDF" : "MPGL/3D/Glyph";
     }
 
     template <Dimension Dim>
@@ -205,7 +205,8 @@ namespace mpgl {
         Font const& font,
         Vector const& position,
         String const& text,
-        TextOptions const& options) : Shadeable{shaderType()},
+        TextOptions const& options)
+            : Shadeable{shaderType(options.distanceField)},
             positionSpace{position}, text{text},
             font{font}, underlines{
                 generateUnderline(positionSpace, options.size,
@@ -214,7 +215,8 @@ namespace mpgl {
                 generateStrikethrough(positionSpace, options.size,
                 options.color)},
             color{options.color}, textSize{options.size},
-            style{options.style}, mods{options.mods}
+            style{options.style}, mods{options.mods},
+            distanceField{options.distanceField}
     {
         loadGlyphs(parseString(text));
         setLocations();
@@ -292,10 +294,34 @@ namespace mpgl {
     Text<Dim>::ArgTuple
         Text<Dim>::glyphCoefficients(void) const noexcept
     {
+        if (distanceField)
+            return {0, textSize / DistanceFieldSize};
         uint8 level = getLevel();
         return {level, (float32) textSize / (ShiftBase << level)};
     }
 
+    template <Dimension Dim>
+    Subfont::FontGlyph Text<Dim>::fetchGlyph(
+        Subfont& subfont,
+        uint16 index,
+        uint8 level) const
+    {
+        if (distanceField)
+            return subfont.distanceField(index);
+        return subfont(index, level);
+    }
+
+    template <Dimension Dim>
+    Subfont::FontGlyph Text<Dim>::fetchGlyph(
+        Subfont const& subfont,
+        uint16 index,
+        uint8 level) const
+    {
+        if (distanceField)
+            return subfont.distanceField(index);
+        return subfont(index, level);
+    }
+
     template <Dimension Dim>
     void Text<Dim>::loadGlyphs(IDArray const& indices) {
         auto& subfont = font(style);
@@ -328,7 +354,7 @@ namespace mpgl {
         float32 scale)
     {
         /// tab is 4 times longer than space
-        if (auto glyph = subfont(32, level))
+        if (auto glyph = fetchGlyph(subfont, 32, level))
             extendModifiers(positionSpace.advance({
                 4.f * float32(glyph->get().advance * scale), 0.f}));
     }
@@ -364,7 +390,8 @@ namespace mpgl {
         auto const& [firstVertex, secondVertex, thirdVertex]
             = positionSpace.calculatePositon(bearing, width, height);
         glyphs.emplace_back(texture, firstVertex, secondVertex,
-            thirdVertex, color);
+            thirdVertex, color, glyph.get().textureCoords);
+        batch.invalidate();
     }
 
     template <Dimension Dim>
@@ -374,7 +401,7 @@ namespace mpgl {
         float32 scale,
         uint16 index)
     {
-        if (auto glyph = subfont(index, level)) {
+        if (auto glyph = fetchGlyph(subfont, index, level)) {
             if (auto texture = glyph->get().texture)
                 emplaceGlyph(*texture, *glyph, scale);
             extendModifiers(positionSpace.advance({
@@ -405,7 +432,7 @@ namespace mpgl {
         shaderProgram->use();
         if constexpr (ThreeDimensional<Dim>)
             this->actualizeLocations();
-        glyphs.draw();
+        batch.draw(glyphs);
         underlines.draw();
         strikethroughs.draw();
     }
@@ -419,7 +446,7 @@ namespace mpgl {
         for (auto iter = text.begin(); iter < text.end(); ++id) {
             std::size_t seqLen = getUTF8SequenceLength(*iter);
             uint16 index = fromUTF8(iter, std::next(iter, seqLen));
-            if (auto glyph = font(style)(index, level))
+            if (auto glyph = fetchGlyph(font(style), index, level))
                 return {std::get<2>(getGlyphDimensions(*glyph, scale)),
                     id};
             std::advance(iter, seqLen);
@@ -450,6 +477,7 @@ namespace mpgl {
         positionSpace.move(getPosition());
         text.clear();
         glyphs.clear();
+        batch.invalidate();
         if (mods & Modifiers::Underline)
             underlines.clear();
         if (mods & Modifiers::Strikethrough)
@@ -460,6 +488,7 @@ namespace mpgl {
     void Text<Dim>::reloadGlyphs(void) {
         positionSpace.move(getPosition());
         glyphs.clear();
+        batch.invalidate();
         loadGlyphs(parseString(text));
     }
 
@@ -492,6 +521,7 @@ namespace mpgl {
     void  Text<Dim>::setColor(Color const& color) {
         this->color = color;
         setColorOnJoinableRange(glyphs, color);
+        batch.invalidate();
         if (mods & Modifiers::Underline)
             setColorOnJoinableRange(underlines, color);
         if (mods & Modifiers::Strikethrough)
@@ -510,6 +540,16 @@ namespace mpgl {
         reloadGlyphs();
     }
 
+    template <Dimension Dim>
+    void Text<Dim>::setDistanceField(bool distanceField) {
+        positionSpace.move(getPosition());
+        this->distanceField = distanceField;
+        setShader(shaderType(distanceField));
+        glyphs.clear();
+        batch.invalidate();
+        loadGlyphs(parseString(text));
+    }
+
     template <Dimension Dim>
     void Text<Dim>::setFont(Font const& font) {
         this->font = font;
@@ -521,6 +561,7 @@ namespace mpgl {
         Transformation<Dim> const& transformator) noexcept
     {
         glyphs.transform(transformator);
+        batch.invalidate();
         if (mods & Modifiers::Underline)
             underlines.transform(transformator);
         if (mods & Modifiers::Strikethrough)
@@ -25,6 +25,8 @@
  */
 #include <MPGL/Core/Text/VectorizedGlyph.hpp>
 
+#include <stdexcept>
+
 namespace mpgl {
 
     void VectorizedGlyph::generatePoints(
@@ -36,10 +38,27 @@ namespace mpgl {
                 (flag & SimpleFlags::OnCurvePoint) > 0);
     }
 
-    [[nodiscard]] uint32 LocaTable::operator() (uint16 index) const {
-        if (std::holds_alternative<Loca16>(locaTable))
-            return 2 * uint32(std::get<Loca16>(locaTable).at(index));
-        return std::get<Loca32>(locaTable).at(index);
+    LocaTable::LocaTable(
+        Span table,
+        int16 indexFormat,
+        uint16 numGlyphs)
+            : longOffsets{indexFormat != 0}
+    {
+        std::size_t const size = (std::size_t{numGlyphs} + 1)
+            * (longOffsets ? 4 : 2);
+        if (table.size() < size)
+            throw std::out_of_range{"Loca table is too short"};
+        this->table = table.first(size);
+    }
+
+    [[nodiscard]] uint32 LocaTable::operator() (uint32 index) const {
+        std::size_t const width = longOffsets ? 4 : 2;
+        if ((std::size_t{index} + 1) * width > table.size())
+            throw std::out_of_range{"Loca is not available"};
+        auto iter = table.data() + index * width;
+        if (longOffsets)
+            return readType<uint32, true>(iter);
+        return 2 * uint32(readType<uint16, true>(iter));
     }
 
     void VectorizedGlyph::Component::readArgs(
@@ -0,0 +1,114 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#include <MPGL/Core/Textures/AtlasPacker.hpp>
+
+namespace mpgl {
+
+    AtlasPacker::AtlasPacker(
+        Vector2u const& dimensions,
+        uint32 padding)
+            : dimensions{dimensions}, usedArea{0}, padding{padding}
+    {
+        clear();
+    }
+
+    void AtlasPacker::clear(void) {
+        skyline.assign(1, Segment{0, 0, dimensions[0]});
+        usedArea = 0;
+    }
+
+    AtlasPacker::OptHeight AtlasPacker::fit(
+        size_type index,
+        Vector2u const& dimensions) const noexcept
+    {
+        uint32 const x = skyline[index].x;
+        if (dimensions[0] > this->dimensions[0] - x)
+            return std::nullopt;
+        uint32 y = 0;
+        for (uint32 left = dimensions[0]; left; ++index) {
+            y = std::max(y, skyline[index].y);
+            if (dimensions[1] > this->dimensions[1] - y)
+                return std::nullopt;
+            left -= std::min(left, skyline[index].width);
+        }
+        return y;
+    }
+
+    [[nodiscard]] AtlasPacker::OptPosition AtlasPacker::insert(
+        Vector2u const& dimensions)
+    {
+        if (!dimensions[0] || !dimensions[1])
+            return Vector2u{0, 0};
+        Vector2u const padded = dimensions + Vector2u{padding, padding};
+        OptPosition best;
+        size_type bestIndex = 0;
+        uint32 bestWidth = 0;
+        for (size_type i = 0; i != skyline.size(); ++i) {
+            if (auto const y = fit(i, padded)) {
+                if (!best || *y < (*best)[1] || (*y == (*best)[1]
+                    && skyline[i].width < bestWidth))
+                {
+                    best = Vector2u{skyline[i].x, *y};
+                    bestIndex = i;
+                    bestWidth = skyline[i].width;
+                }
+            }
+        }
+        if (best)
+            place(bestIndex, *best, padded);
+        return best;
+    }
+
+    void AtlasPacker::place(
+        size_type index,
+        Vector2u const& position,
+        Vector2u const& dimensions)
+    {
+        uint32 const right = position[0] + dimensions[0];
+        auto iter = skyline.begin() + index;
+        while (iter != skyline.end() && iter->x + iter->width <= right)
+            iter = skyline.erase(iter);
+        if (iter != skyline.end() && iter->x < right) {
+            iter->width -= right - iter->x;
+            iter->x = right;
+        }
+        skyline.insert(iter, Segment{position[0],
+            position[1] + dimensions[1], dimensions[0]});
+        usedArea += size_type{dimensions[0]} * dimensions[1];
+        merge();
+    }
+
+    void AtlasPacker::merge(void) {
+        for (size_type i = 1; i < skyline.size();) {
+            if (skyline[i - 1].y == skyline[i].y) {
+                skyline[i - 1].width += skyline[i].width;
+                skyline.erase(skyline.begin() + i);
+            } else
+                ++i;
+        }
+    }
+
+}
@@ -69,6 +69,18 @@ namespace mpgl {
             texturePtr->textureBuffer.generateMipmaps();
     }
 
+    void Texture::update(
+        Bitmap const& bitmap,
+        Vector2u const& position) const noexcept
+    {
+        texturePtr->textureBuffer.bind();
+        texturePtr->textureBuffer.loadSubImage(
+            TextureBuffer::PixelFormat::R,
+            position[0], position[1],
+            bitmap.getWidth(), bitmap.getHeight(),
+            bitmap.data());
+    }
+
     [[nodiscard]] Texture Texture::defaultTexture(
         Options const& options)
     {
@@ -67,11 +67,13 @@ namespace mpgl {
         String const& title,
         Options const& options,
         EventManagerPtr eventManager,
-        Paths const& shaderDirectories)
+        Paths const& shaderDirectories,
+        String const& shaderCache)
             : platform::PlatformHandler{defaultWindowPlatfrom(
                 dimensions, title, options)},
             WindowBase{std::move(eventManager)},
-            shaders{shaderDirectories}, sleepTime{0us}, lastTime{0us}
+            shaders{shaderDirectories, {}, shaderCache},
+            sleepTime{0us}, lastTime{0us}
     {
         windowImpl->setEventManager(this->eventManager.get());
         context.shaders.setLibrary(shaders);
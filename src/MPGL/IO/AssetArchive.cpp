@@ -0,0 +1,174 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#include <MPGL/Exceptions/AssetArchiveCorruptionException.hpp>
+#include <MPGL/Exceptions/HuffmanTree/HuffmanTreeException.hpp>
+#include <MPGL/Exceptions/Inflate/InflateException.hpp>
+#include <MPGL/Compression/Checksums/CRC32.hpp>
+#include <MPGL/Compression/InflateStream.hpp>
+#include <MPGL/IO/AssetArchive.hpp>
+#include <MPGL/IO/Readers.hpp>
+
+#include <algorithm>
+
+namespace mpgl {
+
+    AssetArchive::AssetArchive(Path const& path)
+        : path{path}
+    {
+        if (auto mapped = MappedFile::open(path,
+            MappedFile::Access::Random))
+                file = std::move(*mapped);
+        else
+            throw AssetArchiveCorruptionException{path};
+        parseIndex();
+    }
+
+    AssetArchive::AssetArchive(
+        MappedFile&& file,
+        Path const& path)
+            : file{std::move(file)}, path{path}
+    {
+        parseIndex();
+    }
+
+    void AssetArchive::parseIndex(void) {
+        Span const data = file.getSpan();
+        if (data.size() < HeaderSize)
+            throw AssetArchiveCorruptionException{path};
+        char const* iter = data.data();
+        if (readType<uint32>(iter) != Magic
+            || readType<uint16>(iter) != Version)
+                throw AssetArchiveCorruptionException{path};
+        std::advance(iter, 2);  // reserved
+        uint32 const count = readType<uint32>(iter);
+        uint32 const namesSize = readType<uint32>(iter);
+        std::advance(iter, 4);  // alignment
+        uint32 const checksum = readType<uint32>(iter);
+        uint64 const indexSize = uint64{count} * RecordSize + namesSize;
+        if (indexSize > data.size() - HeaderSize
+            || crc32(data.subspan(HeaderSize, indexSize)) != checksum)
+                throw AssetArchiveCorruptionException{path};
+        char const* const names = iter + count * RecordSize;
+        entries.reserve(count);
+        for (uint32 i = 0; i != count; ++i) {
+            uint64 const offset = readType<uint64>(iter);
+            uint64 const storedSize = readType<uint64>(iter);
+            uint64 const size = readType<uint64>(iter);
+            uint32 const nameOffset = readType<uint32>(iter);
+            uint32 const nameLength = readType<uint32>(iter);
+            uint32 const entryChecksum = readType<uint32>(iter);
+            uint8 const method = readType<uint8>(iter);
+            std::advance(iter, 3);  // padding
+            if (nameOffset > namesSize
+                || nameLength > namesSize - nameOffset
+                || offset > data.size()
+                || storedSize > data.size() - offset
+                || method > static_cast<uint8>(Method::Deflate)
+                || (method == static_cast<uint8>(Method::Stored)
+                    && storedSize != size)
+                || size > storedSize * MaxRatio)
+                        throw AssetArchiveCorruptionException{path};
+            Entry const& entry = entries.emplace_back(Entry{
+                Name{names + nameOffset, nameLength}, offset,
+                storedSize, size, entryChecksum, Method{method}});
+            // the binary search requires the strictly sorted names
+            if (i && entries[i - 1].name >= entry.name)
+                throw AssetArchiveCorruptionException{path};
+        }
+    }
+
+    [[nodiscard]] AssetArchive::const_iterator
+        AssetArchive::find(Name name) const noexcept
+    {
+        auto iter = std::ranges::lower_bound(entries, name,
+            std::ranges::less{}, &Entry::name);
+        if (iter != entries.end() && iter->name == name)
+            return iter;
+        return entries.end();
+    }
+
+    [[nodiscard]] std::optional<AssetArchive::Span>
+        AssetArchive::view(Entry const& entry) const noexcept
+    {
+        if (entry.method != Method::Stored)
+            return {};
+        return storedBytes(entry);
+    }
+
+    [[nodiscard]] std::optional<AssetArchive::Span>
+        AssetArchive::view(Name name) const noexcept
+    {
+        if (auto iter = find(name); iter != end())
+            return view(*iter);
+        return {};
+    }
+
+    [[nodiscard]] AssetArchive::Buffer
+        AssetArchive::read(Entry const& entry) const
+    {
+        Span const stored = storedBytes(entry);
+        Buffer buffer;
+        if (entry.method == Method::Stored)
+            buffer.assign(stored.begin(), stored.end());
+        else try {
+            buffer.resize(entry.size);
+            InflateStream stream;
+            auto [consumed, produced, status] = stream(stored, buffer);
+            if (status != InflateStream::Status::Finished
+                || produced != entry.size)
+                    throw AssetArchiveCorruptionException{path};
+        } catch (InflateException const&) {
+            throw AssetArchiveCorruptionException{path};
+        } catch (HuffmanTreeException const&) {
+            throw AssetArchiveCorruptionException{path};
+        }
+        if (crc32(buffer) != entry.checksum)
+            throw AssetArchiveCorruptionException{path};
+        return buffer;
+    }
+
+    [[nodiscard]] std::optional<AssetArchive::Buffer>
+        AssetArchive::read(Name name) const
+    {
+        if (auto iter = find(name); iter != end())
+            return read(*iter);
+        return {};
+    }
+
+    [[nodiscard]] bool AssetArchive::verify(
+        Entry const& entry) const noexcept
+    {
+        if (entry.method == Method::Stored)
+            return crc32(storedBytes(entry)) == entry.checksum;
+        try {
+            (void) read(entry);
+            return true;
+        } catch (...) {
+            return false;
+        }
+    }
+
+}
@@ -0,0 +1,174 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#include <MPGL/Compression/Checksums/CRC32.hpp>
+#include <MPGL/Utility/StringAlgorithm.hpp>
+#include <MPGL/IO/AssetArchiveWriter.hpp>
+#include <MPGL/IO/AsyncFileReader.hpp>
+#include <MPGL/IO/FileIO.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <array>
+#include <bit>
+
+namespace mpgl {
+
+    AssetArchiveWriter::AssetArchiveWriter(
+        uint32 alignment,
+        CompressionLevel level) noexcept
+            : deflate{level},
+            alignment{std::bit_ceil(std::max<uint32>(alignment, 1))} {}
+
+    template <std::unsigned_integral Tp>
+    void AssetArchiveWriter::saveLittleEndian(Tp value, Buffer& output) {
+        for (uint8 i = 0; i != sizeof(Tp); ++i, value >>= 8)
+            output.push_back(static_cast<char>(value & 0xFF));
+    }
+
+    AssetArchiveWriter::size_type AssetArchiveWriter::align(
+        size_type offset) const noexcept
+    {
+        return (offset + alignment - 1) & ~size_type{alignment - 1};
+    }
+
+    void AssetArchiveWriter::add(
+        std::string const& name,
+        InputSpan content,
+        Method method)
+    {
+        Record record{{}, content.size(), crc32(content), Method::Stored};
+        if (method == Method::Deflate) {
+            deflate(content, record.data);
+            if (record.data.size() < content.size())
+                record.method = Method::Deflate;
+            else
+                record.data.clear();
+        }
+        if (record.method == Method::Stored)
+            record.data.assign(content.begin(), content.end());
+        records.insert_or_assign(name, std::move(record));
+    }
+
+    [[nodiscard]] bool AssetArchiveWriter::addFile(
+        std::string const& name,
+        Path const& filePath,
+        Method method)
+    {
+        if (auto file = MappedFile::open(filePath)) {
+            add(name, file->getSpan(), method);
+            return true;
+        }
+        return false;
+    }
+
+    AssetArchiveWriter::size_type AssetArchiveWriter::addDirectory(
+        Path const& directory)
+    {
+        auto const files = FileIO::getRecursiveDirFiles(directory);
+        size_type const prefix = directory.size() + 1;
+        size_type added = 0;
+        AsyncFileReader{}(files, [&](size_type index,
+            AsyncFileReader::Result&& file)
+        {
+            if (!file)
+                return;
+            Path const& path = files[index];
+            add(path.substr(prefix), file->getSpan(), chooseMethod(path));
+            ++added;
+        });
+        return added;
+    }
+
+    [[nodiscard]] AssetArchiveWriter::Method
+        AssetArchiveWriter::chooseMethod(Path const& filePath)
+    {
+        static std::array<std::string_view, 6> const compressed{
+            "png", "jpg", "jpe", "jpeg", "gz", "zip"};
+        size_type dot = filePath.find_last_of('.');
+        if (dot == Path::npos)
+            return Method::Deflate;
+        std::string const tag = toLower(filePath.substr(dot + 1));
+        if (std::ranges::find(compressed, tag) != compressed.end())
+            return Method::Stored;
+        return Method::Deflate;
+    }
+
+    [[nodiscard]] AssetArchiveWriter::Buffer
+        AssetArchiveWriter::operator() (void) const
+    {
+        size_type namesSize = 0;
+        for (auto const& [name, record] : records)
+            namesSize += name.size();
+        Buffer index, names;
+        index.reserve(records.size() * AssetArchive::RecordSize
+            + namesSize);
+        names.reserve(namesSize);
+        size_type offset = align(AssetArchive::HeaderSize
+            + records.size() * AssetArchive::RecordSize + namesSize);
+        for (auto const& [name, record] : records) {
+            saveLittleEndian<uint64>(offset, index);
+            saveLittleEndian<uint64>(record.data.size(), index);
+            saveLittleEndian<uint64>(record.size, index);
+            saveLittleEndian<uint32>(names.size(), index);
+            saveLittleEndian<uint32>(name.size(), index);
+            saveLittleEndian<uint32>(record.checksum, index);
+            index.insert(index.end(), {static_cast<char>(record.method),
+                '\0', '\0', '\0'});
+            names.insert(names.end(), name.begin(), name.end());
+            offset = align(offset + record.data.size());
+        }
+        index.insert(index.end(), names.begin(), names.end());
+        Buffer output;
+        output.reserve(offset);
+        saveLittleEndian<uint32>(AssetArchive::Magic, output);
+        saveLittleEndian<uint16>(AssetArchive::Version, output);
+        saveLittleEndian<uint16>(0, output);
+        saveLittleEndian<uint32>(records.size(), output);
+        saveLittleEndian<uint32>(namesSize, output);
+        saveLittleEndian<uint32>(alignment, output);
+        saveLittleEndian<uint32>(crc32(index), output);
+        output.insert(output.end(), index.begin(), index.end());
+        for (auto const& [name, record] : records) {
+            output.resize(align(output.size()));
+            output.insert(output.end(), record.data.begin(),
+                record.data.end());
+        }
+        return output;
+    }
+
+    [[nodiscard]] bool AssetArchiveWriter::save(
+        Path const& filePath) const
+    {
+        Buffer const archive = (*this)();
+        std::ofstream file{filePath.c_str(), std::ios::binary
+            | std::ios::trunc};
+        if (!file.is_open() || !file.good())
+            return false;
+        return static_cast<bool>(file.write(archive.data(),
+            archive.size()));
+    }
+
+}
@@ -0,0 +1,606 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#include <MPGL/IO/AsyncFileReader.hpp>
+
+#include <condition_variable>
+#include <algorithm>
+#include <exception>
+#include <utility>
+#include <cstdint>
+#include <future>
+#include <mutex>
+#include <deque>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <atomic>
+#include <cerrno>
+#include <thread>
+#endif
+
+namespace mpgl {
+
+    #if defined(__linux__) && __has_include(<linux/io_uring.h>)
+
+    /**
+     * The io_uring submission and completion queues used by
+     * the reader. Talks with the kernel through the raw system
+     * calls, so no additional library is required
+     */
+    class AsyncFileReader::Ring {
+    public:
+        /**
+         * Sets up a new ring with the given number of entries.
+         * Returns a null pointer when the io_uring is unavailable
+         *
+         * @param entries the number of the submission queue entries
+         * @return the pointer to the ring
+         */
+        [[nodiscard]] static RingPtr make(uint32 entries);
+
+        Ring(Ring const&) = delete;
+        Ring(Ring&&) = delete;
+
+        Ring& operator=(Ring const&) = delete;
+        Ring& operator=(Ring&&) = delete;
+
+        /**
+         * Reads all of the files with the given paths and passes
+         * them to the callback as they are completed
+         *
+         * @param paths the paths to the files
+         * @param callback the callback receiving the files
+         */
+        void operator() (
+            Paths const& paths,
+            Callback const& callback);
+
+        /**
+         * Returns whether the kernel has refused the submissions.
+         * The broken ring must not be used anymore
+         *
+         * @return if the ring is broken
+         */
+        [[nodiscard]] bool isBroken(void) const noexcept
+            { return broken; }
+
+        /**
+         * Unmaps the queues and closes the ring
+         */
+        ~Ring(void) noexcept;
+    private:
+        /**
+         * The state of the file being read
+         */
+        struct Request {
+            MappedFile::Buffer                      buffer;
+            size_type                               offset = 0;
+            size_type                               index = 0;
+            int                                     descriptor = -1;
+        };
+
+        typedef std::vector<Request>                Requests;
+        typedef std::deque<size_type>               Indices;
+
+        /**
+         * Constructs a new Ring object
+         *
+         * @param descriptor the ring's file descriptor
+         */
+        explicit Ring(int descriptor) noexcept
+            : descriptor{descriptor} {}
+
+        /**
+         * Maps the ring's queues described by the given parameters
+         *
+         * @param params the parameters returned by the setup
+         * @return if the queues have been mapped
+         */
+        [[nodiscard]] bool map(io_uring_params const& params) noexcept;
+
+        /**
+         * Opens the file and prepares the request reading it.
+         * Returns false when the file cannot be read by the ring
+         *
+         * @param request the reference to the request
+         * @param path the path to the file
+         * @return if the request has been prepared
+         */
+        [[nodiscard]] static bool open(
+            Request& request,
+            Path const& path) noexcept;
+
+        /**
+         * Places the read of the remaining part of the request's
+         * file in the submission queue
+         *
+         * @param request the reference to the request
+         * @param slot the index of the request
+         */
+        void prepare(Request const& request, size_type slot);
+
+        /**
+         * Submits the prepared reads and waits for at least one
+         * completion. Returns false when the ring is broken
+         * or stays busy while no read is in flight
+         *
+         * @return if the reads have been submitted
+         */
+        [[nodiscard]] bool submit(void) noexcept;
+
+        /**
+         * Withdraws the prepared reads that the kernel has not
+         * consumed from the submission queue
+         */
+        void rewind(void) noexcept;
+
+        /**
+         * Waits for at least one completion without submitting
+         * anything
+         */
+        void wait(void) noexcept;
+
+        /**
+         * Handles all of the available completions
+         *
+         * @param paths the paths to the files
+         * @param callback the callback receiving the files
+         */
+        void complete(
+            Paths const& paths,
+            Callback const& callback);
+
+        /**
+         * Finishes the request and passes the result to
+         * the callback
+         *
+         * @param slot the index of the request
+         * @param result the result of the request
+         * @param callback the callback receiving the files
+         */
+        void finish(
+            size_type slot,
+            Result&& result,
+            Callback const& callback);
+
+        /**
+         * Returns the atomic reference to the given ring's index
+         *
+         * @param offset the offset of the index in the ring
+         * @param base the base address of the ring
+         * @return the atomic reference to the index
+         */
+        [[nodiscard]] static std::atomic_ref<uint32> ringIndex(
+            void* base, uint32 offset) noexcept
+                { return std::atomic_ref<uint32>{*reinterpret_cast<
+                    uint32*>(static_cast<char*>(base) + offset)}; }
+
+        Requests                                    requests;
+        Indices                                     freeSlots;
+        Indices                                     pending;
+        Indices                                     queued;
+        io_uring_params                             params{};
+        void*                                       submissionRing
+            = MAP_FAILED;
+        void*                                       completionRing
+            = MAP_FAILED;
+        io_uring_sqe*                               submissions
+            = static_cast<io_uring_sqe*>(MAP_FAILED);
+        size_type                                   submissionSize = 0;
+        size_type                                   completionSize = 0;
+        size_type                                   inFlight = 0;
+        int                                         descriptor;
+        bool                                        broken = false;
+
+        /// The number of the busy ring's retries before the reads
+        /// are passed to the fallback
+        static constexpr const size_type            MaxBusyRetries = 64;
+    };
+
+    AsyncFileReader::RingPtr AsyncFileReader::Ring::make(
+        uint32 entries)
+    {
+        io_uring_params params{};
+        long descriptor = syscall(__NR_io_uring_setup,
+            std::max<uint32>(entries, 1), &params);
+        if (descriptor < 0)
+            return {};
+        RingPtr ring{new Ring{static_cast<int>(descriptor)}};
+        if (!ring->map(params))
+            return {};
+        return ring;
+    }
+
+    bool AsyncFileReader::Ring::map(
+        io_uring_params const& params) noexcept
+    {
+        this->params = params;
+        submissionSize = params.sq_off.array
+            + params.sq_entries * sizeof(uint32);
+        completionSize = params.cq_off.cqes
+            + params.cq_entries * sizeof(io_uring_cqe);
+        if (params.features & IORING_FEAT_SINGLE_MMAP)
+            submissionSize = completionSize = std::max(
+                submissionSize, completionSize);
+        submissionRing = mmap(nullptr, submissionSize,
+            PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+            descriptor, IORING_OFF_SQ_RING);
+        if (submissionRing == MAP_FAILED)
+            return false;
+        if (params.features & IORING_FEAT_SINGLE_MMAP)
+            completionRing = submissionRing;
+        else if ((completionRing = mmap(nullptr, completionSize,
+            PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+            descriptor, IORING_OFF_CQ_RING)) == MAP_FAILED)
+                return false;
+        void* address = mmap(nullptr,
+            params.sq_entries * sizeof(io_uring_sqe),
+            PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+            descriptor, IORING_OFF_SQES);
+        if (address == MAP_FAILED)
+            return false;
+        submissions = static_cast<io_uring_sqe*>(address);
+        return true;
+    }
+
+    AsyncFileReader::Ring::~Ring(void) noexcept {
+        if (submissions != MAP_FAILED)
+            munmap(submissions, params.sq_entries * sizeof(io_uring_sqe));
+        if (completionRing != MAP_FAILED
+            && completionRing != submissionRing)
+                munmap(completionRing, completionSize);
+        if (submissionRing != MAP_FAILED)
+            munmap(submissionRing, submissionSize);
+        close(descriptor);
+    }
+
+    bool AsyncFileReader::Ring::open(
+        Request& request,
+        Path const& path) noexcept
+    {
+        request.descriptor = ::open(path.c_str(),
+            O_RDONLY | O_CLOEXEC);
+        if (request.descriptor < 0)
+            return false;
+        struct stat status{};
+        // special and empty files are left for the fallback
+        if (fstat(request.descriptor, &status) == 0
+            && S_ISREG(status.st_mode) && status.st_size > 0)
+        {
+            try {
+                request.buffer.resize(status.st_size);
+                request.offset = 0;
+                return true;
+            } catch (...) {}
+        }
+        close(std::exchange(request.descriptor, -1));
+        return false;
+    }
+
+    void AsyncFileReader::Ring::prepare(
+        Request const& request,
+        size_type slot)
+    {
+        auto tail = ringIndex(submissionRing, params.sq_off.tail);
+        uint32 position = tail.load(std::memory_order_relaxed);
+        uint32 mask = *reinterpret_cast<uint32 const*>(
+            static_cast<char const*>(submissionRing)
+                + params.sq_off.ring_mask);
+        io_uring_sqe& entry = submissions[position & mask];
+        entry = io_uring_sqe{};
+        entry.opcode = IORING_OP_READ;
+        entry.fd = request.descriptor;
+        entry.addr = reinterpret_cast<std::uintptr_t>(
+            request.buffer.data() + request.offset);
+        entry.len = static_cast<uint32>(std::min<size_type>(
+            request.buffer.size() - request.offset, 0x7FFFF000));
+        entry.off = request.offset;
+        entry.user_data = slot;
+        reinterpret_cast<uint32*>(static_cast<char*>(submissionRing)
+            + params.sq_off.array)[position & mask] = position & mask;
+        tail.store(position + 1, std::memory_order_release);
+        queued.push_back(slot);
+    }
+
+    bool AsyncFileReader::Ring::submit(void) noexcept {
+        for (size_type retries = 0;;) {
+            long submitted = syscall(__NR_io_uring_enter, descriptor,
+                queued.size(), inFlight + queued.size() ? 1 : 0,
+                IORING_ENTER_GETEVENTS, nullptr, 0);
+            if (submitted >= 0) {
+                // the kernel consumes the entries in the queue's order
+                queued.erase(queued.begin(), queued.begin() + submitted);
+                inFlight += submitted;
+                return true;
+            }
+            if (errno != EINTR && errno != EAGAIN && errno != EBUSY)
+                return false;
+            if (inFlight)
+                return true;
+            if (errno != EINTR) {
+                if (++retries == MaxBusyRetries)
+                    return false;
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    void AsyncFileReader::Ring::rewind(void) noexcept {
+        auto tail = ringIndex(submissionRing, params.sq_off.tail);
+        auto head = ringIndex(submissionRing, params.sq_off.head);
+        tail.store(head.load(std::memory_order_acquire),
+            std::memory_order_release);
+        pending.insert(pending.end(), queued.begin(), queued.end());
+        queued.clear();
+    }
+
+    void AsyncFileReader::Ring::wait(void) noexcept {
+        if (syscall(__NR_io_uring_enter, descriptor, 0, 1,
+            IORING_ENTER_GETEVENTS, nullptr, 0) < 0 && errno != EINTR)
+                // the completions are posted anyway
+                std::this_thread::yield();
+    }
+
+    void AsyncFileReader::Ring::finish(
+        size_type slot,
+        Result&& result,
+        Callback const& callback)
+    {
+        Request& request = requests[slot];
+        if (request.descriptor >= 0)
+            close(std::exchange(request.descriptor, -1));
+        request.buffer = MappedFile::Buffer{};
+        freeSlots.push_back(slot);
+        callback(request.index, std::move(result));
+    }
+
+    void AsyncFileReader::Ring::complete(
+        Paths const& paths,
+        Callback const& callback)
+    {
+        auto tail = ringIndex(completionRing, params.cq_off.tail);
+        auto head = ringIndex(completionRing, params.cq_off.head);
+        uint32 mask = *reinterpret_cast<uint32 const*>(
+            static_cast<char const*>(completionRing)
+                + params.cq_off.ring_mask);
+        auto completions = reinterpret_cast<io_uring_cqe const*>(
+            static_cast<char const*>(completionRing)
+                + params.cq_off.cqes);
+        uint32 position = head.load(std::memory_order_relaxed);
+        for (uint32 end = tail.load(std::memory_order_acquire);
+            position != end; ++position)
+        {
+            io_uring_cqe const entry = completions[position & mask];
+            head.store(position + 1, std::memory_order_release);
+            --inFlight;
+            size_type slot = entry.user_data;
+            Request& request = requests[slot];
+            if (entry.res == -EINTR || entry.res == -EAGAIN)
+                pending.push_front(slot);
+            else if (entry.res < 0)
+                // e.g. the kernel does not support the read operation
+                finish(slot, MappedFile::open(paths[request.index]),
+                    callback);
+            else if (entry.res == 0) {
+                // the file has been truncated in the meantime
+                request.buffer.resize(request.offset);
+                finish(slot, MappedFile{std::move(request.buffer)},
+                    callback);
+            } else if ((request.offset += entry.res)
+                < request.buffer.size())
+                    pending.push_front(slot);
+            else
+                finish(slot, MappedFile{std::move(request.buffer)},
+                    callback);
+        }
+    }
+
+    void AsyncFileReader::Ring::operator() (
+        Paths const& paths,
+        Callback const& callback)
+    {
+        std::exception_ptr exception;
+        // the buffers cannot be released until the kernel returns them
+        Callback const guarded = [&](size_type index, Result&& result) {
+            if (!exception) try {
+                callback(index, std::move(result));
+            } catch (...) {
+                exception = std::current_exception();
+            }
+        };
+        requests.assign(std::min<size_type>(paths.size(),
+            params.sq_entries), Request{});
+        freeSlots.clear();
+        for (size_type i = 0; i < requests.size(); ++i)
+            freeSlots.push_back(i);
+        size_type next = 0;
+        while (next < paths.size() || inFlight || !pending.empty()
+            || !queued.empty())
+        {
+            if (exception)
+                next = paths.size();
+            for (; !broken && !freeSlots.empty() && next < paths.size();
+                ++next)
+            {
+                size_type slot = freeSlots.front();
+                Request& request = requests[slot];
+                request.index = next;
+                if (open(request, paths[next])) {
+                    freeSlots.pop_front();
+                    pending.push_back(slot);
+                } else
+                    guarded(next, MappedFile::open(paths[next]));
+            }
+            if (broken) {
+                // the buffers cannot be released until the kernel
+                // returns them
+                if (inFlight) {
+                    wait();
+                    complete(paths, guarded);
+                    continue;
+                }
+                for (; !pending.empty(); pending.pop_front())
+                    finish(pending.front(), MappedFile::open(
+                        paths[requests[pending.front()].index]),
+                        guarded);
+                for (; next < paths.size(); ++next)
+                    guarded(next, MappedFile::open(paths[next]));
+                break;
+            }
+            for (; !pending.empty(); pending.pop_front())
+                prepare(requests[pending.front()], pending.front());
+            if ((broken = !submit()))
+                rewind();
+            complete(paths, guarded);
+        }
+        if (exception)
+            std::rethrow_exception(exception);
+    }
+
+    #else
+
+    /**
+     * The placeholder of the io_uring on the platforms
+     * that do not support it
+     */
+    class AsyncFileReader::Ring {
+    public:
+        /**
+         * Returns the null pointer
+         *
+         * @param entries the number of the submission queue entries
+         * @return the null pointer
+         */
+        [[nodiscard]] static RingPtr make(
+            [[maybe_unused]] uint32 entries) noexcept
+                { return {}; }
+
+        /**
+         * Never called
+         *
+         * @param paths the paths to the files
+         * @param callback the callback receiving the files
+         */
+        void operator() (
+            [[maybe_unused]] Paths const& paths,
+            [[maybe_unused]] Callback const& callback) {}
+
+        /**
+         * Never called
+         *
+         * @return true
+         */
+        [[nodiscard]] bool isBroken(void) const noexcept
+            { return true; }
+    };
+
+    #endif
+
+    AsyncFileReader::AsyncFileReader(uint32 queueDepth)
+        : ring{Ring::make(queueDepth)}, threadpool{nullptr} {}
+
+    AsyncFileReader::AsyncFileReader(
+        async::Threadpool& threadpool,
+        uint32 queueDepth)
+            : ring{Ring::make(queueDepth)}, threadpool{&threadpool} {}
+
+    AsyncFileReader::AsyncFileReader(
+        AsyncFileReader&& reader) noexcept = default;
+
+    AsyncFileReader& AsyncFileReader::operator=(
+        AsyncFileReader&& reader) noexcept = default;
+
+    AsyncFileReader::~AsyncFileReader(void) noexcept = default;
+
+    void AsyncFileReader::operator() (
+        Paths const& paths,
+        Callback const& callback)
+    {
+        // the previous run could have thrown after breaking the ring
+        if (ring && ring->isBroken())
+            ring.reset();
+        if (ring) {
+            (*ring)(paths, callback);
+            if (ring->isBroken())
+                ring.reset();
+        } else if (threadpool)
+            readParallel(paths, callback);
+        else
+            readSequenced(paths, callback);
+    }
+
+    void AsyncFileReader::readSequenced(
+        Paths const& paths,
+        Callback const& callback)
+    {
+        for (size_type i = 0; i < paths.size(); ++i)
+            callback(i, MappedFile::open(paths[i]));
+    }
+
+    void AsyncFileReader::readParallel(
+        Paths const& paths,
+        Callback const& callback)
+    {
+        std::mutex mutex;
+        std::condition_variable condition;
+        std::deque<std::pair<size_type, Result>> results;
+        std::vector<std::future<void>> futures;
+        futures.reserve(paths.size());
+        for (size_type i = 0; i < paths.size(); ++i)
+            futures.push_back(threadpool->appendTask(
+                [&, i]() -> void {
+                    Result result = MappedFile::open(paths[i]);
+                    std::lock_guard guard{mutex};
+                    results.emplace_back(i, std::move(result));
+                    condition.notify_one();
+                }));
+        std::exception_ptr exception;
+        // the tasks refer to the local state until they finish
+        for (size_type delivered = 0; delivered < paths.size();
+            ++delivered)
+        {
+            std::unique_lock guard{mutex};
+            condition.wait(guard, [&]{ return !results.empty(); });
+            auto [index, result] = std::move(results.front());
+            results.pop_front();
+            guard.unlock();
+            if (!exception) try {
+                callback(index, std::move(result));
+            } catch (...) {
+                exception = std::current_exception();
+            }
+        }
+        std::ranges::for_each(futures, &std::future<void>::wait);
+        if (exception)
+            std::rethrow_exception(exception);
+    }
+
+}
@@ -80,10 +80,10 @@ namespace mpgl {
     {
         std::ifstream file(filePath.c_str());
         if (file.is_open() && file.good()) {
-            Stream dataStream;
-            std::copy(std::istreambuf_iterator<char>(file), {},
-                std::ostreambuf_iterator<char>(dataStream));
-            return dataStream;
+            std::string content(fileSize(file), '\0');
+            file.read(content.data(), content.size());
+            content.resize(file.gcount());
+            return Stream{std::move(content)};
         }
         return {};
     }
@@ -102,13 +102,11 @@ namespace mpgl {
         FileIO::readFileToVec(Path const& filePath)
     {
         std::ifstream file{filePath.c_str(), std::ios::binary};
-        file.unsetf(std::ios::skipws);
         if (file.is_open() && file.good()) {
-            Buffer dataStream;
-            dataStream.reserve(fileSize(file));
-            dataStream.insert(dataStream.begin(),
-                std::istream_iterator<char>(file), {});
-            return { dataStream };
+            Buffer dataStream(fileSize(file));
+            file.read(dataStream.data(), dataStream.size());
+            dataStream.resize(file.gcount());
+            return { std::move(dataStream) };
         }
         return {};
     }
@@ -25,7 +25,6 @@
  */
 #include <MPGL/Exceptions/ImageLoading/ImageLoadingFileCorruptionException.hpp>
 #include <MPGL/Exceptions/ImageLoading/ImageLoadingInvalidTypeException.hpp>
-#include <MPGL/Exceptions/ImageLoading/ImageLoadingFileOpenException.hpp>
 #include <MPGL/Exceptions/SecurityUnknownPolicyException.hpp>
 #include <MPGL/IO/ImageLoading/BMPLoader.hpp>
 
@@ -37,13 +36,12 @@ namespace mpgl {
     template <security::SecurityPolicy Policy>
     BMPLoader<Policy>::BMPLoader(
         [[maybe_unused]] Policy policy,
-        Path const& filePath)
+        Path const& filePath,
+        MappedFile::Span file)
             : LoaderInterface{filePath}
     {
-        std::ifstream file{this->filePath.c_str(), std::ios::binary};
-        if (!file.good() || !file.is_open())
-            throw ImageLoadingFileOpenException{this->filePath};
-        FileIter iter = makeIterator<Policy>(StreamBuf{file});
+        FileIter iter = makeIterator<Policy>(file.data(),
+            file.data() + file.size());
         try {
             readHeader(iter);
             readImage(iter);
@@ -52,6 +50,12 @@ namespace mpgl {
         }
     }
 
+    template <security::SecurityPolicy Policy>
+    BMPLoader<Policy>::BMPLoader(
+        Policy policy,
+        Path const& filePath)
+            : BMPLoader{policy, filePath, openFile(filePath).getSpan()} {}
+
     template <security::SecurityPolicy Policy>
     BMPLoader<Policy>::BMPLoader(Path const& filePath)
         : BMPLoader{Policy{}, filePath} {}
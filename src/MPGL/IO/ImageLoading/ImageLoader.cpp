@@ -37,7 +37,19 @@ namespace mpgl {
     ImageLoader<Policy>::ImageLoader(
         Policy policy,
         Path const& filePath)
-            : opener{getLoader(policy, filePath)} {}
+    {
+        auto const& loader = getLoader(filePath);
+        opener = std::invoke(loader, policy, filePath,
+            LoaderInterface::openFile(filePath).getSpan());
+    }
+
+    template <security::SecurityPolicy Policy>
+    ImageLoader<Policy>::ImageLoader(
+        Policy policy,
+        Path const& filePath,
+        MappedFile::Span file)
+            : opener{std::invoke(getLoader(filePath), policy,
+                filePath, file)} {}
 
     template <security::SecurityPolicy Policy>
     ImageLoader<Policy>::ImageLoader(Path const& filePath)
@@ -56,14 +68,13 @@ namespace mpgl {
     }
 
     template <security::SecurityPolicy Policy>
-    ImageLoader<Policy>::LoaderPtr ImageLoader<Policy>::getLoader(
-        Policy policy,
-        Path const& filePath)
+    ImageLoader<Policy>::LoadingFun const&
+        ImageLoader<Policy>::getLoader(Path const& filePath)
     {
         auto iter = loaders.find(extractTag(filePath));
         if (iter == loaders.end())
             throw ImageLoadingUnsuportedFileType{filePath};
-        return std::invoke(iter->second, policy, filePath);
+        return iter->second;
     }
 
     template <security::SecurityPolicy Policy>
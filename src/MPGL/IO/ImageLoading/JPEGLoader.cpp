@@ -25,7 +25,6 @@
  */
 #include <MPGL/Exceptions/ImageLoading/ImageLoadingFileCorruptionException.hpp>
 #include <MPGL/Exceptions/ImageLoading/ImageLoadingInvalidTypeException.hpp>
-#include <MPGL/Exceptions/ImageLoading/ImageLoadingFileOpenException.hpp>
 #include <MPGL/Exceptions/SecurityUnknownPolicyException.hpp>
 #include <MPGL/Utility/Deferred/DeferredConstructor.hpp>
 #include <MPGL/Exceptions/NotSupportedException.hpp>
@@ -33,7 +32,6 @@
 #include <MPGL/Mathematics/Transforms/IFCT.hpp>
 #include <MPGL/IO/ImageLoading/JPEGLoader.hpp>
 #include <MPGL/Utility/Ranges.hpp>
-#include <MPGL/IO/FileIO.hpp>
 
 #include <algorithm>
 #include <bitset>
@@ -47,22 +45,29 @@ namespace mpgl {
     template <security::SecurityPolicy Policy>
     JPEGLoader<Policy>::JPEGLoader(
         [[maybe_unused]] Policy policy,
-        Path const& filePath)
+        Path const& filePath,
+        MappedFile::Span file)
             : LoaderInterface{filePath}, endOfImage{false}
     {
-        if (auto file = FileIO::readFileToVec(this->filePath)) {
-            try {
-                parseChunks(makeIterator<Policy>(file->cbegin(), file->cend()));
-                decodeImage();
-            } catch (std::out_of_range const&) {
-                throw ImageLoadingFileCorruptionException{this->filePath};
-            } catch (HuffmanTreeException const&) {
-                throw ImageLoadingFileCorruptionException{this->filePath};
-            }
-        } else
-            throw ImageLoadingFileOpenException{this->filePath};
+        try {
+            parseChunks(makeIterator<Policy>(file.data(),
+                file.data() + file.size()));
+            decodeImage();
+        } catch (std::out_of_range const&) {
+            throw ImageLoadingFileCorruptionException{this->filePath};
+        } catch (HuffmanTreeException const&) {
+            throw ImageLoadingFileCorruptionException{this->filePath};
+        } catch (BitReaderOutOfRangeException const&) {
+            throw ImageLoadingFileCorruptionException{this->filePath};
+        }
     }
 
+    template <security::SecurityPolicy Policy>
+    JPEGLoader<Policy>::JPEGLoader(
+        Policy policy,
+        Path const& filePath)
+            : JPEGLoader{policy, filePath, openFile(filePath).getSpan()} {}
+
     template <security::SecurityPolicy Policy>
     JPEGLoader<Policy>::JPEGLoader(Path const& filePath)
         : JPEGLoader{Policy{}, filePath} {}
@@ -99,7 +104,7 @@ namespace mpgl {
         int16& coeff)
     {
         uint8 code = huffmanTables.at(DC_CODE).at(id)->decoder(iter);
-        uint16 bits = readRNBits<uint16>(code, iter);
+        uint16 bits = static_cast<uint16>(iter.readBits(code));
         coeff += decodeNumber(code, bits);
         std::array<int16, 64> data{};
         data.front() = coeff
@@ -126,14 +131,15 @@ namespace mpgl {
                     return;
                 code &= 0x0F;
             }
-            data[length] = decodeNumber(code, readRNBits<uint16>(
-                code, iter)) * quant->information.at(length);
+            data[length] = decodeNumber(code, static_cast<uint16>(
+                iter.readBits(code))) * quant->information.at(length);
         }
     }
 
     template <security::SecurityPolicy Policy>
     void JPEGLoader<Policy>::decodeImage(void) {
-        Iter iter{makeIterator<Policy>(imageData.cbegin(), imageData.cend())};
+        Iter iter{makeIterator<Policy>(imageData.cbegin(), imageData.cend()),
+            makeIterator<Policy>(imageData.cend(), imageData.cend())};
         Channels channels;
         channels.resize(componentsTable.size(), 0);
         for (size_type i = 0; i < getBoundry(pixels.getWidth()); ++i) {
@@ -215,7 +221,7 @@ namespace mpgl {
                 this->loader.filePath};
         this->loader.huffmanTables[coding(header)].emplace(
                 static_cast<uint8>(0xF & header),
-                std::make_unique<HuffmanTable>(HuffmanTree<uint16>{
+                std::make_unique<HuffmanTable>(HuffmanLookupTable<true>{
                     symbolsLengths, characters}));
     }
 
@@ -235,8 +241,7 @@ namespace mpgl {
             throw NotSupportedException{
                 "Only 8-pixels quantization tables are supported."};
         table.information.resize(length);
-        std::ranges::for_each(table.information, [&data](uint8& quant)
-            { quant = *data; ++data; });
+        readTypes<uint8>(data, table.information);
         this->loader.quantizationTables.emplace(
             0xF & header, std::make_unique<QuantizationTable>(
                 std::move(table)));
@@ -351,8 +356,8 @@ namespace mpgl {
 
     template <security::SecurityPolicy Policy>
     JPEGLoader<Policy>::HuffmanTable::HuffmanTable(
-        HuffmanTree<uint16> tree)
-            : decoder{std::move(tree)} {}
+        HuffmanLookupTable<true> table)
+            : decoder{std::move(table)} {}
 
     template <security::SecurityPolicy Policy>
     JPEGLoader<Policy>::Component::Component(
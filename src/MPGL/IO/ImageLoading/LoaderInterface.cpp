@@ -23,22 +23,17 @@
  *  3. This notice may not be removed or altered from any source
  *  distribution
  */
-#pragma once
+#include <MPGL/Exceptions/ImageLoading/ImageLoadingFileOpenException.hpp>
+#include <MPGL/IO/ImageLoading/LoaderInterface.hpp>
 
 namespace mpgl {
 
-    template <ByteInputIterator Iter>
-    KernTable::KernTable(Iter& iter) {
-        if (readType<uint16, true>(iter)) return;
-        std::advance(iter, 2);
-        setAxis(readType<uint16, true>(iter));
-        uint16 end = readType<uint16, true>(iter);
-        std::advance(iter, 6);
-        for (uint16 i = 0; i < end; ++i) {
-            uint32 key = readType<uint16, true>(iter) << 0x0010;
-            key += readType<uint16, true>(iter);
-            distance[key] = readType<int16, true>(iter);
-        }
+    [[nodiscard]] MappedFile LoaderInterface::openFile(
+        std::string const& filePath)
+    {
+        if (auto file = MappedFile::open(filePath))
+            return std::move(*file);
+        throw ImageLoadingFileOpenException{filePath};
     }
 
 }
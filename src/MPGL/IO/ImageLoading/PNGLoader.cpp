@@ -25,18 +25,19 @@
  */
 #include <MPGL/Exceptions/ImageLoading/ImageLoadingFileCorruptionException.hpp>
 #include <MPGL/Exceptions/ImageLoading/ImageLoadingInvalidTypeException.hpp>
-#include <MPGL/Exceptions/ImageLoading/ImageLoadingFileOpenException.hpp>
 #include <MPGL/Exceptions/SecurityUnknownPolicyException.hpp>
 #include <MPGL/Exceptions/Inflate/InflateException.hpp>
 #include <MPGL/Exceptions/NotSupportedException.hpp>
 #include <MPGL/Compression/Checksums/CRC32.hpp>
 #include <MPGL/IO/ImageLoading/PNGLoader.hpp>
-#include <MPGL/Compression/ZlibDecoder.hpp>
-#include <MPGL/IO/FileIO.hpp>
+#include <MPGL/IO/MappedFile.hpp>
 
+#include <algorithm>
 #include <iterator>
 #include <numeric>
+#include <memory>
 #include <ranges>
+#include <tuple>
 
 namespace mpgl {
 
@@ -46,22 +47,26 @@ namespace mpgl {
     template <security::SecurityPolicy Policy>
     PNGLoader<Policy>::PNGLoader(
         Policy policy,
-        Path const& filePath)
+        Path const& filePath,
+        MappedFile::Span file)
             : LoaderInterface{filePath}
     {
-        if (auto file = FileIO::readFileToVec(this->filePath)) {
-            try {
-                readImage(policy, makeIterator<Policy>(file->cbegin(),
-                    file->cend()));
-            } catch (std::out_of_range&) {
-                throw ImageLoadingFileCorruptionException{this->filePath};
-            } catch (InflateException&) {
-                throw ImageLoadingFileCorruptionException{this->filePath};
-            }
-        } else
-            throw ImageLoadingFileOpenException{this->filePath};
+        try {
+            readImage(policy, makeIterator<Policy>(file.data(),
+                file.data() + file.size()));
+        } catch (std::out_of_range&) {
+            throw ImageLoadingFileCorruptionException{this->filePath};
+        } catch (InflateException&) {
+            throw ImageLoadingFileCorruptionException{this->filePath};
+        }
     }
 
+    template <security::SecurityPolicy Policy>
+    PNGLoader<Policy>::PNGLoader(
+        Policy policy,
+        Path const& filePath)
+            : PNGLoader{policy, filePath, openFile(filePath).getSpan()} {}
+
     template <security::SecurityPolicy Policy>
     PNGLoader<Policy>::PNGLoader(Path const& filePath)
         : PNGLoader{Policy{}, filePath} {}
@@ -71,9 +76,11 @@ namespace mpgl {
         FileIter begin,
         size_type length)
     {
-        auto const end = std::next(begin, length + 4);
-        uint32 crc = crc32(std::ranges::subrange{begin, end});
-        if (peekType<uint32, true>(end) != crc)
+        auto chunk = checkedRange(begin, length + 8);
+        uint32 expected = peekType<uint32, true>(chunk.end() - 4);
+        uint32 crc = crc32(std::span<char const>{
+            std::to_address(chunk.begin()), length + 4});
+        if (expected != crc)
             throw ImageLoadingFileCorruptionException{filePath};
     }
 
@@ -89,9 +96,33 @@ namespace mpgl {
     }
 
     template <security::SecurityPolicy Policy>
-    void PNGLoader<Policy>::chooseInterlance(Policy policy) {
-        auto decoded = ZlibDecoder{std::move(rawFileData), policy}();
-        auto iter = makeIterator<Policy>(decoded.cbegin(), decoded.cend());
+    void PNGLoader<Policy>::inflateChunk(
+        ZlibStreamDecoder::InputSpan chunk)
+    {
+        while (!decoder.isFinished()) {
+            if (decodedSize == decoded.size())
+                decoded.resize(std::max<size_type>({2 * decoded.size(),
+                    (4 * pixels.getWidth() + 1) * pixels.getHeight(),
+                    InflateStream::WindowSize}));
+            auto [consumed, produced, status] = decoder(chunk,
+                ZlibStreamDecoder::OutputSpan{decoded}.subspan(
+                    decodedSize));
+            chunk = chunk.subspan(consumed);
+            decodedSize += produced;
+            if (status == ZlibStreamDecoder::Status::NeedsInput)
+                return;
+        }
+    }
+
+    template <security::SecurityPolicy Policy>
+    void PNGLoader<Policy>::chooseInterlance(
+        [[maybe_unused]] Policy policy)
+    {
+        if (!decoder.isFinished())
+            throw ImageLoadingFileCorruptionException{filePath};
+        decoded.resize(decodedSize);
+        CharIter const data = decoded.data();
+        auto iter = makeIterator<Policy>(data, data + decoded.size());
         if (headerData.interlance)
             return interlance(iter);
         Filters{pixels, *this}(iter);
@@ -169,7 +200,8 @@ namespace mpgl {
         if (iter == colorSetters.end())
             throw NotSupportedException{
                 "Following PNG image type is not supported"};
-        this->loader.headerData.setter = iter->second;
+        std::tie(this->loader.headerData.setter,
+            this->loader.headerData.channels) = iter->second;
     }
 
     template <security::SecurityPolicy Policy>
@@ -184,10 +216,9 @@ namespace mpgl {
         size_type length,
         FileIter& data)
     {
-        this->loader.rawFileData.resize(
-            this->loader.rawFileData.size() + length);
-        copyTo(data, std::next(data, length),
-            this->loader.rawFileData.end() - length);
+        auto chunk = checkedRange(data, length);
+        this->loader.inflateChunk(ZlibStreamDecoder::InputSpan{
+            std::to_address(chunk.begin()), length});
         std::advance(data, length);
     }
 
@@ -286,7 +317,7 @@ namespace mpgl {
         size_type column,
         uint8 filter,
         uint8 subpixelID,
-        FileIter& iter) noexcept
+        CharIter& iter) noexcept
     {
         switch (filter) {
             case 1:
@@ -306,7 +337,7 @@ namespace mpgl {
         size_type row,
         size_type column,
         uint8 filter,
-        FileIter& iter) noexcept
+        CharIter& iter) noexcept
     {
         for (uint8 sub = 0; sub < 4; ++sub)
             image[row][column][sub]
@@ -318,7 +349,7 @@ namespace mpgl {
         size_type row,
         size_type column,
         uint8 filter,
-        FileIter& iter) noexcept
+        CharIter& iter) noexcept
     {
         for (uint8 sub = 0; sub < 3; ++sub)
             image[row][column][sub]
@@ -330,7 +361,7 @@ namespace mpgl {
         size_type row,
         size_type column,
         uint8 filter,
-        FileIter& iter) noexcept
+        CharIter& iter) noexcept
     {
         uint8 subpixel = filterSubpixel(row, column, filter, 0, iter);
         for (uint8 sub = 0; sub < 3; ++sub)
@@ -342,7 +373,7 @@ namespace mpgl {
         size_type row,
         size_type column,
         uint8 filter,
-        FileIter& iter) noexcept
+        CharIter& iter) noexcept
     {
         setGrayPixels(row, column, filter, iter);
         image[row][column].alpha
@@ -350,15 +381,16 @@ namespace mpgl {
     }
 
     template <security::SecurityPolicy Policy>
-    void PNGLoader<Policy>::Filters::operator()(
-        FileIter& iter) noexcept
-    {
+    void PNGLoader<Policy>::Filters::operator()(FileIter& iter) {
+        size_type const length = 1 + image.getWidth()
+            * loader.headerData.channels;
         for (std::size_t i = image.getHeight() - 1;
-            i < image.getHeight(); --i)
+            i < image.getHeight(); --i, iter += length)
         {
-            uint8 filter = *iter++;
+            CharIter row = checkedRange(iter, length).begin();
+            uint8 filter = *row++;
             for (std::size_t j = 0;j < image.getWidth(); ++j)
-                (this->*loader.headerData.setter)(i, j, filter, iter);
+                (this->*loader.headerData.setter)(i, j, filter, row);
         }
     }
 
@@ -366,10 +398,10 @@ namespace mpgl {
     PNGLoader<Policy>::ColorSetters const
         PNGLoader<Policy>::IHDRChunk::colorSetters
     {
-        {0, &PNGLoader::Filters::setGrayPixels},
-        {2, &PNGLoader::Filters::setRGBPixels},
-        {4, &PNGLoader::Filters::setGrayAlphaPixels},
-        {6, &PNGLoader::Filters::setRGBAPixels}
+        {0, {&PNGLoader::Filters::setGrayPixels, 1}},
+        {2, {&PNGLoader::Filters::setRGBPixels, 3}},
+        {4, {&PNGLoader::Filters::setGrayAlphaPixels, 2}},
+        {6, {&PNGLoader::Filters::setRGBAPixels, 4}}
     };
 
     template <security::SecurityPolicy Policy>
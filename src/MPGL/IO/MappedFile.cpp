@@ -0,0 +1,141 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#include <MPGL/IO/MappedFile.hpp>
+
+#include <algorithm>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <cerrno>
+#else
+#include <fstream>
+#endif
+
+namespace mpgl {
+
+    MappedFile::MappedFile(Buffer&& buffer) noexcept
+        : buffer{std::move(buffer)}, address{this->buffer.data()},
+        length{this->buffer.size()}, mapped{false} {}
+
+    MappedFile::MappedFile(MappedFile&& file) noexcept
+        : buffer{std::move(file.buffer)},
+        address{std::exchange(file.address, nullptr)},
+        length{std::exchange(file.length, 0)},
+        mapped{std::exchange(file.mapped, false)} {}
+
+    MappedFile& MappedFile::operator=(MappedFile&& file) noexcept {
+        unmap();
+        buffer = std::move(file.buffer);
+        address = std::exchange(file.address, nullptr);
+        length = std::exchange(file.length, 0);
+        mapped = std::exchange(file.mapped, false);
+        return *this;
+    }
+
+    MappedFile::~MappedFile(void) noexcept {
+        unmap();
+    }
+
+    #if defined(__unix__) || defined(__APPLE__)
+
+    void MappedFile::unmap(void) noexcept {
+        if (mapped)
+            munmap(const_cast<char*>(address), length);
+        mapped = false;
+    }
+
+    [[nodiscard]] std::optional<MappedFile> MappedFile::open(
+        Path const& filePath,
+        Access access)
+    {
+        int descriptor = ::open(filePath.c_str(), O_RDONLY);
+        if (descriptor < 0)
+            return {};
+        struct stat status{};
+        if (fstat(descriptor, &status) == 0 && S_ISREG(status.st_mode)
+            && status.st_size > 0)
+        {
+            size_type length = status.st_size;
+            void* address = mmap(nullptr, length, PROT_READ,
+                MAP_PRIVATE, descriptor, 0);
+            if (address != MAP_FAILED) {
+                close(descriptor);
+                if (access == Access::Sequential) {
+                    madvise(address, length, MADV_SEQUENTIAL);
+                    madvise(address, length, MADV_WILLNEED);
+                } else
+                    madvise(address, length, MADV_RANDOM);
+                return MappedFile{static_cast<char const*>(address),
+                    length};
+            }
+        }
+        // the size of the special files is unknown, read to the end
+        Buffer buffer(S_ISREG(status.st_mode) ? status.st_size : 0);
+        size_type size = 0;
+        ssize_t count;
+        for (;; size += count) {
+            if (size == buffer.size())
+                buffer.resize(std::max<size_type>(2 * size, ChunkSize));
+            count = read(descriptor, buffer.data() + size,
+                buffer.size() - size);
+            if (count < 0 && errno == EINTR)
+                count = 0;
+            else if (count <= 0)
+                break;
+        }
+        close(descriptor);
+        if (count < 0)
+            return {};
+        buffer.resize(size);
+        return MappedFile{std::move(buffer)};
+    }
+
+    #else
+
+    void MappedFile::unmap(void) noexcept {}
+
+    [[nodiscard]] std::optional<MappedFile> MappedFile::open(
+        Path const& filePath,
+        [[maybe_unused]] Access access)
+    {
+        std::ifstream file{filePath.c_str(), std::ios::binary
+            | std::ios::ate};
+        if (!file.is_open() || !file.good())
+            return {};
+        Buffer buffer(static_cast<size_type>(file.tellg()));
+        file.seekg(0, std::ios::beg);
+        if (!file.read(buffer.data(), buffer.size()))
+            return {};
+        return MappedFile{std::move(buffer)};
+    }
+
+    #endif
+
+}
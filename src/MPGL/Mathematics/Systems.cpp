@@ -25,7 +25,9 @@
  */
 #include <MPGL/Mathematics/Systems.hpp>
 
+#include <algorithm>
 #include <math.h>
+#include <cmath>
 
 namespace mpgl {
 
@@ -44,4 +46,16 @@ namespace mpgl {
         return matrix;
     }
 
+    [[nodiscard]] std::size_t quadraticBezierSegments(
+        Vector2f const& firstVertex,
+        Vector2f const& secondVertex,
+        Vector2f const& thirdVertex,
+        float32 tolerance) noexcept
+    {
+        float32 const deviation = (firstVertex - 2.f * secondVertex
+            + thirdVertex).length();
+        return std::max<std::size_t>(1, static_cast<std::size_t>(
+            std::ceil(std::sqrt(deviation / (4.f * tolerance)))));
+    }
+
 }
@@ -0,0 +1,215 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#include "../TestsFramework/Tests.hpp"
+#include "../../include/MPGL/Exceptions/Inflate/InflateDataCorruptionException.hpp"
+#include "../../include/MPGL/Compression/ZlibStreamDecoder.hpp"
+#include "../../include/MPGL/Compression/GZIPStreamDecoder.hpp"
+#include "../../include/MPGL/Compression/ZlibEncoder.hpp"
+#include "../../include/MPGL/Compression/ZlibDecoder.hpp"
+#include "../../include/MPGL/Compression/GZIPEncoder.hpp"
+#include "../../include/MPGL/Compression/GZIPDecoder.hpp"
+
+#include <algorithm>
+#include <vector>
+#include <array>
+
+namespace {
+
+    typedef std::vector<char>                       Buffer;
+    typedef mpgl::Deflate::CompressionLevel         Level;
+
+    /// The compression levels checked by the round trips
+    constexpr std::array<Level, 5> Levels{Level::Store,
+        Level::Fastest, Level::Fast, Level::Default, Level::Maximum};
+
+    /**
+     * Generates the data mixing the repeated phrases with
+     * the pseudo-random bytes, so both the matches and
+     * the literals are encoded
+     *
+     * @param size the size of the data
+     * @return the generated data
+     */
+    Buffer makeData(std::size_t size) {
+        Buffer data;
+        data.reserve(size);
+        mpgl::uint32 seed = 0x2545F491;
+        while (data.size() < size) {
+            seed = seed * 1664525 + 1013904223;
+            if (seed >> 31) {
+                for (char c : std::string_view{"the quick brown fox "})
+                    data.push_back(c);
+            } else
+                data.push_back(static_cast<char>(seed >> 16));
+        }
+        data.resize(size);
+        return data;
+    }
+
+    /**
+     * Decompresses the stream feeding the decoder with one
+     * input byte at a time and a small output buffer. Returns
+     * an empty vector when the stream is truncated
+     *
+     * @tparam Decoder the type of the stream decoder
+     * @param compressed the constant reference to the stream
+     * @return the decompressed data
+     */
+    template <typename Decoder>
+    Buffer decodeByteWise(Buffer const& compressed) {
+        Decoder decoder;
+        Buffer output;
+        std::array<char, 7> chunk;
+        std::size_t position = 0;
+        while (!decoder.isFinished()) {
+            std::span<char const> input{compressed.data() + position,
+                std::min<std::size_t>(1, compressed.size() - position)};
+            auto const [consumed, produced, status] = decoder(input,
+                chunk);
+            position += consumed;
+            output.insert(output.end(), chunk.begin(),
+                chunk.begin() + produced);
+            if (status == Decoder::Status::NeedsInput
+                && position == compressed.size())
+                    return {};
+        }
+        return output;
+    }
+
+    /**
+     * Decompresses the whole stream with the given decoder
+     *
+     * @tparam Decoder the type of the stream decoder
+     * @param compressed the constant reference to the stream
+     * @return the decompressed data
+     */
+    template <typename Decoder>
+    Buffer decodeAtOnce(Buffer const& compressed) {
+        Decoder decoder;
+        Buffer output(1 << 20);
+        auto const result = decoder(compressed, output);
+        output.resize(result.produced);
+        return output;
+    }
+
+    /**
+     * Returns the zlib stream with the given DEFLATE data
+     * and the checksum of the empty data
+     *
+     * @param deflate the DEFLATE data
+     * @return the zlib stream
+     */
+    Buffer makeZlib(std::initializer_list<unsigned char> deflate) {
+        Buffer stream{0x78, 0x01};
+        for (unsigned char byte : deflate)
+            stream.push_back(static_cast<char>(byte));
+        stream.insert(stream.end(), {0, 0, 0, 1});
+        return stream;
+    }
+
+}
+
+Test(DeflateZlibRoundTrip) {
+    for (std::size_t size : {0, 1, 100, 70000}) {
+        auto const data = makeData(size);
+        for (Level level : Levels) {
+            auto compressed = mpgl::ZlibEncoder{level}(data);
+            Equal(mpgl::ZlibDecoder<Buffer>{std::move(compressed)}(),
+                data)
+        }
+    }
+}
+
+Test(DeflateGZIPRoundTrip) {
+    for (std::size_t size : {0, 1, 100, 70000}) {
+        auto const data = makeData(size);
+        for (Level level : Levels) {
+            auto compressed = mpgl::GZIPEncoder{level}(data);
+            Equal(mpgl::GZIPDecoder<Buffer>{std::move(compressed)}(),
+                data)
+        }
+    }
+}
+
+Test(DeflateBGZFRoundTrip) {
+    mpgl::async::Threadpool threadpool{4};
+    auto const data = makeData(5 * mpgl::GZIPEncoder::BlockSize + 17);
+    auto const compressed = mpgl::GZIPEncoder{}(data, threadpool);
+    Equal(mpgl::GZIPDecoder<Buffer>{Buffer{compressed}}(threadpool),
+        data)
+    Equal(mpgl::GZIPDecoder<Buffer>{Buffer{compressed}}(), data)
+    Equal(decodeByteWise<mpgl::GZIPStreamDecoder>(compressed),
+        Buffer(data.begin(), data.begin() + mpgl::GZIPEncoder::BlockSize))
+}
+
+Test(DeflateStreamingByteWise) {
+    auto const data = makeData(70000);
+    for (Level level : Levels) {
+        Equal(decodeByteWise<mpgl::ZlibStreamDecoder>(
+            mpgl::ZlibEncoder{level}(data)), data)
+        Equal(decodeByteWise<mpgl::GZIPStreamDecoder>(
+            mpgl::GZIPEncoder{level}(data)), data)
+    }
+}
+
+Test(DeflateStreamingTruncated) {
+    auto compressed = mpgl::ZlibEncoder{}(makeData(1000));
+    compressed.pop_back();
+    Assert(decodeByteWise<mpgl::ZlibStreamDecoder>(compressed).empty())
+}
+
+Test(DeflateCorruptedChecksums) {
+    auto const data = makeData(1000);
+    auto zlib = mpgl::ZlibEncoder{}(data);
+    zlib.back() ^= 1;
+    OnThrow((void) decodeByteWise<mpgl::ZlibStreamDecoder>(zlib),
+        mpgl::InflateDataCorruptionException)
+    OnThrow((void) mpgl::ZlibDecoder<Buffer>{Buffer{zlib}}(),
+        mpgl::InflateDataCorruptionException)
+    auto gzip = mpgl::GZIPEncoder{}(data);
+    gzip[gzip.size() - 8] ^= 1;
+    OnThrow((void) decodeByteWise<mpgl::GZIPStreamDecoder>(gzip),
+        mpgl::InflateDataCorruptionException)
+    OnThrow((void) mpgl::GZIPDecoder<Buffer>{Buffer{gzip}}(),
+        mpgl::InflateDataCorruptionException)
+}
+
+Test(DeflateCorruptedBlocks) {
+    /// the final block of the reserved type
+    auto const reserved = makeZlib({0x07});
+    /// the stored block whose length does not match its complement
+    auto const stored = makeZlib({0x01, 0x05, 0x00, 0x00, 0x00});
+    /// the fixed block starting with a match before the data
+    auto const distance = makeZlib({0x03, 0x02, 0x00, 0x00});
+    for (auto const& stream : {reserved, stored, distance}) {
+        /// the stream decoder cannot reach the trailer
+        Buffer const data{stream.begin(), stream.end() - 4};
+        OnThrow((void) decodeAtOnce<mpgl::ZlibStreamDecoder>(data),
+            mpgl::InflateDataCorruptionException)
+        OnThrow((void) mpgl::ZlibDecoder<Buffer>{Buffer{stream}}(),
+            mpgl::InflateDataCorruptionException)
+    }
+}
@@ -0,0 +1,147 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#include "ShaderFunctionsStub.hpp"
+#include "../../include/MPGL/Core/Shaders/ProgramCache.hpp"
+
+#include <filesystem>
+#include <fstream>
+
+namespace {
+
+    using namespace std::literals;
+
+    /// The code of the vertex shader ended with 0
+    constexpr std::string_view Vertex = "void main() { gl_Position; }\0"sv;
+    /// The code of the fragment shader ended with 0
+    constexpr std::string_view Fragment = "void main() {}\0"sv;
+
+    /**
+     * Creates the empty cache directory and the cache using
+     * the stub functions table
+     *
+     * @return the program cache
+     */
+    mpgl::ProgramCache makeCache(void) {
+        namespace fs = std::filesystem;
+
+        auto const path = fs::temp_directory_path() / "MPGLProgramCache";
+        fs::remove_all(path);
+        mpgl::tests::shaderCalls = {};
+        return mpgl::ProgramCache{path, mpgl::tests::shaderFunctionsStub};
+    }
+
+    /**
+     * Overwrites the byte of the cached binary at the given offset
+     *
+     * @param path the path to the cached binary
+     * @param offset the offset of the byte
+     */
+    void corrupt(std::string const& path, std::size_t offset) {
+        std::fstream file{path, std::ios::binary | std::ios::in
+            | std::ios::out};
+        file.seekg(offset);
+        char byte = file.get();
+        file.seekp(offset);
+        file.put(~byte);
+    }
+
+}
+
+Test(ProgramCacheKeyDependencies) {
+    using Driver = mpgl::ProgramCache::Driver;
+
+    Driver const driver{"Vendor", "Renderer", "4.6", {1, 2}};
+    auto const key = mpgl::ProgramCache::makeKey(Vertex, Fragment,
+        driver);
+    auto changed = [&](auto modify) {
+        Driver other = driver;
+        modify(other);
+        return key != mpgl::ProgramCache::makeKey(Vertex, Fragment,
+            other);
+    };
+    Assert(key == mpgl::ProgramCache::makeKey(Vertex, Fragment, driver))
+    Assert(key != mpgl::ProgramCache::makeKey(Fragment, Vertex, driver))
+    Assert(key != mpgl::ProgramCache::makeKey(Vertex, Vertex, driver))
+    Assert(changed([](Driver& other) { other.vendor = "Other"; }))
+    Assert(changed([](Driver& other) { other.renderer = "Other"; }))
+    Assert(changed([](Driver& other) { other.version = "4.5"; }))
+    Assert(changed([](Driver& other) { other.formats = {1}; }))
+    Assert(changed([](Driver& other) { other.formats = {2, 1}; }))
+}
+
+Test(ProgramCacheStoreAndLoad) {
+    using mpgl::tests::shaderCalls;
+
+    auto cache = makeCache();
+    Assert(cache.isEnabled())
+    auto const key = cache.makeKey(Vertex, Fragment);
+    Assert(!cache.load(key))
+    auto program = cache("Program", Vertex, Fragment);
+    Assert(shaderCalls.linked == 1)
+    Assert(std::filesystem::exists(cache.getPath(key)))
+    auto loaded = cache.load(key);
+    Assert(loaded && loaded->isReady())
+    Assert(shaderCalls.loaded == 1)
+    Assert(cache.store(key, program))
+    Assert(cache.load(key).has_value())
+    Assert(shaderCalls.linked == 1)
+}
+
+Test(ProgramCacheCorruptedBinary) {
+    using mpgl::tests::shaderCalls;
+
+    auto cache = makeCache();
+    auto const key = cache.makeKey(Vertex, Fragment);
+    auto const path = cache.getPath(key);
+    (void) cache("Program", Vertex, Fragment);
+    // the magic number
+    corrupt(path, 0);
+    Assert(!cache.load(key))
+    Assert(!std::filesystem::exists(path))
+    Assert(cache("Program", Vertex, Fragment).isReady())
+    Assert(shaderCalls.linked == 2)
+    Assert(std::filesystem::exists(path))
+    // the checksum
+    corrupt(path, 24);
+    Assert(!cache.load(key))
+    Assert(!std::filesystem::exists(path))
+    Assert(cache("Program", Vertex, Fragment).isReady())
+    Assert(shaderCalls.linked == 3)
+    Assert(shaderCalls.loaded == 0)
+}
+
+Test(ProgramCacheRejectedBinary) {
+    using mpgl::tests::shaderCalls;
+
+    auto cache = makeCache();
+    auto const key = cache.makeKey(Vertex, Fragment);
+    (void) cache("Program", Vertex, Fragment);
+    shaderCalls.acceptBinary = false;
+    Assert(cache("Program", Vertex, Fragment).isReady())
+    Assert(shaderCalls.loaded == 1)
+    Assert(shaderCalls.linked == 2)
+    Assert(std::filesystem::exists(cache.getPath(key)))
+}
@@ -0,0 +1,149 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#pragma once
+
+#include "../TestsFramework/Tests.hpp"
+#include "../../include/MPGL/Core/Shaders/ShaderFunctions.hpp"
+
+#include <glad/glad.h>
+
+#include <algorithm>
+#include <vector>
+#include <map>
+
+namespace mpgl::tests {
+
+    /**
+     * Records the calls of the stub OpenGL functions table
+     */
+    struct ShaderCalls {
+        /// The number of the compiled shaders
+        std::size_t                                 compiled = 0;
+        /// The number of the linked programs
+        std::size_t                                 linked = 0;
+        /// The number of the programs loaded from the binaries
+        std::size_t                                 loaded = 0;
+        /// Whether the loaded binaries are accepted
+        bool                                        acceptBinary = true;
+        /// The binary returned by the linked programs
+        std::vector<char>                           binary{'M', 'P', 'G', 'L'};
+        /// The format of the returned binary
+        uint32                                      format = 0x1234;
+        /// The vendor returned by the stub
+        char const*                                 vendor = "Vendor";
+        /// The link status of the programs
+        std::map<uint32, int32>                     linkStatus;
+        /// The identifier of the last created object
+        uint32                                      lastID = 0;
+    };
+
+    /// The calls recorded by the stub functions table
+    inline ShaderCalls shaderCalls;
+
+    /**
+     * The OpenGL functions table that records the compile, link
+     * and program binary calls instead of calling the OpenGL
+     */
+    inline ShaderFunctions const shaderFunctionsStub{
+        .createShader = [](uint32) -> uint32
+            { return ++shaderCalls.lastID; },
+        .shaderSource = [](uint32, int32, char const* const*,
+            int32 const*) {},
+        .compileShader = [](uint32) { ++shaderCalls.compiled; },
+        .getShaderiv = [](uint32, uint32, int32* value)
+            { *value = 1; },
+        .getShaderInfoLog = [](uint32, int32 size, int32* length,
+            char* log)
+        {
+            std::fill_n(log, size, 0);
+            if (length)
+                *length = 0;
+        },
+        .deleteShader = [](uint32) {},
+        .createProgram = [](void) -> uint32
+            { return ++shaderCalls.lastID; },
+        .attachShader = [](uint32, uint32) {},
+        .linkProgram = [](uint32 program) {
+            ++shaderCalls.linked;
+            shaderCalls.linkStatus[program] = 1;
+        },
+        .getProgramiv = [](uint32 program, uint32 parameter,
+            int32* value)
+        {
+            if (parameter == GL_PROGRAM_BINARY_LENGTH)
+                *value = shaderCalls.binary.size();
+            else
+                *value = shaderCalls.linkStatus[program];
+        },
+        .getProgramInfoLog = [](uint32, int32 size, int32* length,
+            char* log)
+        {
+            std::fill_n(log, size, 0);
+            if (length)
+                *length = 0;
+        },
+        .deleteProgram = [](uint32) {},
+        .hasProgramBinary = [](void) -> bool { return true; },
+        .programParameteri = [](uint32, uint32, int32) {},
+        .getProgramBinary = [](uint32, int32 size, int32* length,
+            uint32* format, void* binary)
+        {
+            *length = std::min<int32>(size, shaderCalls.binary.size());
+            *format = shaderCalls.format;
+            std::copy_n(shaderCalls.binary.begin(), *length,
+                static_cast<char*>(binary));
+        },
+        .programBinary = [](uint32 program, uint32 format,
+            void const* binary, int32 length)
+        {
+            auto const data = static_cast<char const*>(binary);
+            ++shaderCalls.loaded;
+            shaderCalls.linkStatus[program] = shaderCalls.acceptBinary
+                && format == shaderCalls.format
+                && std::ranges::equal(shaderCalls.binary,
+                    std::vector<char>(data, data + length));
+        },
+        .getIntegerv = [](uint32 parameter, int32* values) {
+            if (parameter == GL_NUM_PROGRAM_BINARY_FORMATS)
+                *values = 1;
+            else if (parameter == GL_PROGRAM_BINARY_FORMATS)
+                *values = shaderCalls.format;
+        },
+        .getString = [](uint32 name) -> char const* {
+            switch (name) {
+                case GL_VENDOR:
+                    return shaderCalls.vendor;
+                case GL_RENDERER:
+                    return "Renderer";
+                case GL_VERSION:
+                    return "4.6";
+                default:
+                    return nullptr;
+            }
+        }
+    };
+
+}
@@ -0,0 +1,83 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#include "ShaderFunctionsStub.hpp"
+#include "../../include/MPGL/Core/Shaders/ShaderLibrary.hpp"
+
+#include <filesystem>
+#include <fstream>
+
+namespace {
+
+    /**
+     * Creates the shader directory with one shader program
+     *
+     * @return the path to the shader directory
+     */
+    std::string makeShaderDirectory(void) {
+        namespace fs = std::filesystem;
+
+        auto const path = fs::temp_directory_path() / "MPGLShaderTests";
+        fs::create_directories(path / "Vertex");
+        fs::create_directories(path / "Fragment");
+        std::ofstream{path / "Vertex" / "Default.glsl"}
+            << "void main() {}";
+        std::ofstream{path / "Fragment" / "Default.glsl"}
+            << "void main() {}";
+        return path;
+    }
+
+}
+
+Test(ShaderLibraryLazyCompilation) {
+    using mpgl::tests::shaderCalls;
+
+    shaderCalls = {};
+    mpgl::ShaderLibrary library{{makeShaderDirectory()}, {}, {},
+        mpgl::tests::shaderFunctionsStub};
+    Assert(library.contains("Default"))
+    Assert(!library.isCompiled("Default"))
+    Assert(shaderCalls.compiled == 0)
+    Assert(shaderCalls.linked == 0)
+    Assert(library["Default"].isReady())
+    Assert(library.isCompiled("Default"))
+    Assert(shaderCalls.compiled == 2)
+    Assert(shaderCalls.linked == 1)
+}
+
+Test(ShaderLibraryCompiledProgramsReuse) {
+    using mpgl::tests::shaderCalls;
+
+    shaderCalls = {};
+    mpgl::ShaderLibrary library{{makeShaderDirectory()}, {}, {},
+        mpgl::tests::shaderFunctionsStub};
+    (void) library["Default"];
+    shaderCalls.compiled = shaderCalls.linked = 0;
+    (void) library["Default"];
+    library.warmUp({"Default"});
+    Assert(shaderCalls.compiled == 0)
+    Assert(shaderCalls.linked == 0)
+    Assert(shaderCalls.loaded == 0)
+}
@@ -0,0 +1,133 @@
+/**
+ *  MPGL - Modern and Precise Graphics Library
+ *
+ *  Copyright (c) 2021-2023
+ *      Grzegorz Czarnecki (grzegorz.czarnecki.2021@gmail.com)
+ *
+ *  This software is provided 'as-is', without any express or
+ *  implied warranty. In no event will the authors be held liable
+ *  for any damages arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any
+ *  purpose, including commercial applications, and to alter it and
+ *  redistribute it freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented;
+ *  you must not claim that you wrote the original software.
+ *  If you use this software in a product, an acknowledgment in the
+ *  product documentation would be appreciated but is not required.
+ *
+ *  2. Altered source versions must be plainly marked as such,
+ *  and must not be misrepresented as being the original software.
+ *
+ *  3. This notice may not be removed or altered from any source
+ *  distribution
+ */
+#include "../TestsFramework/Tests.hpp"
+#include "../../include/MPGL/Core/Textures/AtlasPacker.hpp"
+
+#include <vector>
+
+namespace {
+
+    /**
+     * The rectangle placed in the atlas page
+     */
+    struct Placement {
+        /// The position of the lower-left corner
+        mpgl::Vector2u                              position;
+        /// The dimensions of the rectangle
+        mpgl::Vector2u                              dimensions;
+    };
+
+    /**
+     * Checks whether the rectangles enlarged by the gutter
+     * overlap
+     *
+     * @param left the constant reference to the first rectangle
+     * @param right the constant reference to the second rectangle
+     * @param gutter the width of the gutter
+     * @return if the rectangles overlap
+     */
+    bool overlap(
+        Placement const& left,
+        Placement const& right,
+        mpgl::uint32 gutter) noexcept
+    {
+        for (std::size_t i = 0; i != 2; ++i) {
+            if (left.position[i] + left.dimensions[i] + gutter
+                    <= right.position[i]
+                || right.position[i] + right.dimensions[i] + gutter
+                    <= left.position[i])
+                        return false;
+        }
+        return true;
+    }
+
+    /**
+     * Checks whether the position lies at the origin
+     *
+     * @param position the constant reference to the position
+     * @return if the position lies at the origin
+     */
+    bool isOrigin(mpgl::Vector2u const& position) noexcept {
+        return !position[0] && !position[1];
+    }
+
+}
+
+Test(AtlasPackerPlacementsDoNotOverlap) {
+    mpgl::AtlasPacker packer{{128, 128}};
+    std::vector<Placement> placements;
+    for (mpgl::uint32 i = 0; i != 200; ++i) {
+        mpgl::Vector2u const dimensions{3 + (i * 7) % 13,
+            2 + (i * 5) % 17};
+        if (auto const position = packer.insert(dimensions))
+            placements.push_back({*position, dimensions});
+    }
+    Assert(placements.size() > 50)
+    bool inside = true, separated = true;
+    for (std::size_t i = 0; i != placements.size(); ++i) {
+        auto const& [position, dimensions] = placements[i];
+        inside = inside && position[0] + dimensions[0] < 128
+            && position[1] + dimensions[1] < 128;
+        for (std::size_t j = 0; j != i; ++j)
+            separated = separated
+                && !overlap(placements[i], placements[j], 1);
+    }
+    Assert(inside)
+    Assert(separated)
+}
+
+Test(AtlasPackerFullPage) {
+    mpgl::AtlasPacker packer{{16, 16}};
+    Assert(!packer.insert({16, 16}))
+    auto const position = packer.insert({15, 15});
+    Assert(position && isOrigin(*position))
+    Assert(packer.getUsedArea() == 256)
+    Assert(!packer.insert({1, 1}))
+}
+
+Test(AtlasPackerClear) {
+    mpgl::AtlasPacker packer{{16, 16}};
+    (void) packer.insert({7, 7});
+    (void) packer.insert({7, 7});
+    (void) packer.insert({7, 7});
+    Assert(!packer.insert({15, 15}))
+    packer.clear();
+    Assert(packer.getUsedArea() == 0)
+    auto const position = packer.insert({15, 15});
+    Assert(position && isOrigin(*position))
+}
+
+Test(AtlasPackerZeroSizeRectangles) {
+    mpgl::AtlasPacker packer{{16, 16}};
+    auto const empty = packer.insert({0, 5});
+    Assert(empty && isOrigin(*empty))
+    Assert(packer.getUsedArea() == 0)
+    auto const position = packer.insert({15, 15});
+    Assert(position && isOrigin(*position))
+    auto const full = packer.insert({5, 0});
+    Assert(full && isOrigin(*full))
+    Assert(packer.getUsedArea() == 256)
+}